@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t buffer_size = 1 << 20;
+inline constexpr std::array<u8, 4> csv_chars{',', '"', '\n', '\r'};
+using CsvClassifier = grex::ByteClassifier<',', '"', '\n', '\r'>;
+
+// printable ASCII in which one of the CSV delimiters occurs every `gap` bytes on average
+std::vector<u8> make_buffer(std::size_t gap) {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg64 rng(seed_source);
+  std::uniform_int_distribution<std::size_t> gdist{0, gap - 1};
+  std::uniform_int_distribution<std::size_t> cdist{0, csv_chars.size() - 1};
+  std::uniform_int_distribution<unsigned> adist{'0', 'z'};
+  std::vector<u8> buf(buffer_size);
+  for (u8& c : buf) {
+    c = (gdist(rng) == 0) ? csv_chars[cdist(rng)] : u8(adist(rng));
+  }
+  return buf;
+}
+
+// count the delimiters by repeatedly searching for the next one
+void bm_impl(benchmark::State& state, auto find) {
+  const std::vector<u8> buf = make_buffer(std::size_t(state.range(0)));
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (std::size_t i = find(buf.data(), buf.size()); i < buf.size();
+         i += find(buf.data() + i + 1, buf.size() - i - 1) + 1) {
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetBytesProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+void bm_std(benchmark::State& state) {
+  bm_impl(state, [](const u8* data, std::size_t num) {
+    return std::size_t(std::find_first_of(data, data + num, csv_chars.begin(), csv_chars.end()) -
+                       data);
+  });
+}
+void bm_grex(benchmark::State& state) {
+  const CsvClassifier classifier{};
+  bm_impl(state, [&](const u8* data, std::size_t num) {
+    return grex::find_first_of(data, num, classifier);
+  });
+}
+
+BENCHMARK(bm_std)->Arg(8)->Arg(64)->Arg(1024);
+BENCHMARK(bm_grex)->Arg(8)->Arg(64)->Arg(1024);
+} // namespace
+
+BENCHMARK_MAIN();
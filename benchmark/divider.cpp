@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t buffer_size = 4096;
+
+template<typename T>
+std::vector<T> make_buffer() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg64 rng(seed_source);
+  // truncating uniformly distributed 64-bit integers, which also works for 8-bit integers
+  std::uniform_int_distribution<u64> dist{};
+  std::vector<T> buf(buffer_size);
+  for (T& v : buf) {
+    v = T(dist(rng));
+  }
+  return buf;
+}
+
+// an odd divisor that is not a power of two, hidden from the optimizer
+template<typename T>
+T make_divisor() {
+  T divisor{7};
+  benchmark::DoNotOptimize(divisor);
+  return divisor;
+}
+
+// the built-in operator, one value at a time
+template<typename T>
+void bm_builtin(benchmark::State& state, auto op) {
+  const std::vector<T> src = make_buffer<T>();
+  std::vector<T> dst(buffer_size);
+  const T divisor = make_divisor<T>();
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < buffer_size; ++i) {
+      dst[i] = T(op(src[i], divisor));
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+// grex using scalars
+template<typename T>
+void bm_grex_scalar(benchmark::State& state, auto op) {
+  const std::vector<T> src = make_buffer<T>();
+  std::vector<T> dst(buffer_size);
+  const grex::Divider<T> divider{make_divisor<T>()};
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < buffer_size; ++i) {
+      dst[i] = op(src[i], divider);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+// grex using native vectors
+template<typename T>
+void bm_grex_vector(benchmark::State& state, auto op) {
+  using Vec = grex::Vector<T, grex::max_native_size<T>>;
+  const std::vector<T> src = make_buffer<T>();
+  std::vector<T> dst(buffer_size);
+  const grex::Divider<T> divider{make_divisor<T>()};
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < buffer_size; i += Vec::size) {
+      op(Vec::load(src.data() + i), divider).store(dst.data() + i);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+#define BM_DIVIDER(NAME, OP, TYPE) \
+  void bm_##NAME##_builtin_##TYPE(benchmark::State& state) { \
+    bm_builtin<TYPE>(state, [](TYPE x, TYPE d) { return x OP d; }); \
+  } \
+  BENCHMARK(bm_##NAME##_builtin_##TYPE); \
+  void bm_##NAME##_grex_scalar_##TYPE(benchmark::State& state) { \
+    bm_grex_scalar<TYPE>(state, [](auto x, const auto& d) { return grex::NAME(x, d); }); \
+  } \
+  BENCHMARK(bm_##NAME##_grex_scalar_##TYPE); \
+  void bm_##NAME##_grex_vector_##TYPE(benchmark::State& state) { \
+    bm_grex_vector<TYPE>(state, [](auto x, const auto& d) { return grex::NAME(x, d); }); \
+  } \
+  BENCHMARK(bm_##NAME##_grex_vector_##TYPE)
+#define BM_DIVIDER_ALL(NAME, OP) \
+  BM_DIVIDER(NAME, OP, u8); \
+  BM_DIVIDER(NAME, OP, u16); \
+  BM_DIVIDER(NAME, OP, u32); \
+  BM_DIVIDER(NAME, OP, u64); \
+  BM_DIVIDER(NAME, OP, i8); \
+  BM_DIVIDER(NAME, OP, i16); \
+  BM_DIVIDER(NAME, OP, i32); \
+  BM_DIVIDER(NAME, OP, i64);
+
+BM_DIVIDER_ALL(divide, /) // NOLINT
+BM_DIVIDER_ALL(modulo, %) // NOLINT
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t index_num = 16384;
+// one native vector of 32-bit indices per gather
+inline constexpr std::size_t vector_size = grex::max_native_size<i32>;
+
+// a dictionary of `table_size` random values and random indices into it
+template<typename TValue, typename TIndex>
+struct Dictionary {
+  std::vector<TValue> table;
+  std::vector<TIndex> indices;
+
+  explicit Dictionary(std::size_t table_size) : table(table_size), indices(index_num) {
+    pcg_extras::seed_seq_from<std::random_device> seed_source;
+    pcg64 rng(seed_source);
+    // truncating uniformly distributed 64-bit integers, whose bits are all we care about
+    std::uniform_int_distribution<u64> vdist{};
+    for (TValue& v : table) {
+      v = TValue(vdist(rng));
+    }
+    std::uniform_int_distribution<std::size_t> idist{0, table_size - 1};
+    for (TIndex& i : indices) {
+      i = TIndex(idist(rng));
+    }
+  }
+};
+
+// decode the indices one by one
+template<typename TValue, typename TIndex>
+void bm_scalar(benchmark::State& state) {
+  const Dictionary<TValue, TIndex> dict(std::size_t(state.range(0)));
+  std::vector<TValue> dst(index_num);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < index_num; ++i) {
+      dst[i] = dict.table[std::size_t(dict.indices[i])];
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(index_num));
+}
+
+// decode the indices using gathers
+template<typename TValue, typename TIndex>
+void bm_grex(benchmark::State& state) {
+  static constexpr std::size_t size = vector_size;
+  const Dictionary<TValue, TIndex> dict(std::size_t(state.range(0)));
+  const std::span<const TValue> table{dict.table};
+  std::vector<TValue> dst(index_num);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < index_num; i += size) {
+      const auto idxs = grex::Vector<TIndex, size>::load(dict.indices.data() + i);
+      grex::gather(table, idxs).store(dst.data() + i);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(index_num));
+}
+
+#define BM_GATHER(VALUE, INDEX) \
+  void bm_gather_scalar_##VALUE##_##INDEX(benchmark::State& state) { \
+    bm_scalar<VALUE, INDEX>(state); \
+  } \
+  BENCHMARK(bm_gather_scalar_##VALUE##_##INDEX)->Arg(256)->Arg(1 << 20); \
+  void bm_gather_grex_##VALUE##_##INDEX(benchmark::State& state) { \
+    bm_grex<VALUE, INDEX>(state); \
+  } \
+  BENCHMARK(bm_gather_grex_##VALUE##_##INDEX)->Arg(256)->Arg(1 << 20)
+
+// byte-sized dictionaries
+BM_GATHER(u8, u8);
+BM_GATHER(u8, u16);
+BM_GATHER(u8, i32);
+BM_GATHER(u8, u32);
+// 16-bit dictionaries
+BM_GATHER(u16, u16);
+BM_GATHER(u16, i32);
+BM_GATHER(u16, u32);
+// native gathers for comparison
+BM_GATHER(f32, i32);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t index_num = 16384;
+
+template<typename T, std::size_t tTableSize>
+struct Data {
+  std::array<T, tTableSize> table{};
+  std::vector<u8> indices;
+
+  Data() : indices(index_num) {
+    pcg_extras::seed_seq_from<std::random_device> seed_source;
+    pcg64 rng(seed_source);
+    // truncating uniformly distributed 64-bit integers, whose bits are all we care about
+    std::uniform_int_distribution<u64> vdist{};
+    for (T& v : table) {
+      v = T(vdist(rng));
+    }
+    std::uniform_int_distribution<std::size_t> idist{0, tTableSize - 1};
+    for (u8& i : indices) {
+      i = u8(idist(rng));
+    }
+  }
+};
+
+// look up `index_num` random `u8` indices into a table of `tTableSize` values
+template<typename T, std::size_t tTableSize>
+void bm_impl(benchmark::State& state, auto lookup) {
+  static constexpr std::size_t size = grex::max_native_size<u8>;
+  const Data<T, tTableSize> data{};
+  std::vector<T> dst(index_num);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < index_num; i += size) {
+      const auto idxs = grex::Vector<u8, size>::load(data.indices.data() + i);
+      lookup(data.table, idxs).store(dst.data() + i);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(index_num));
+}
+
+// a `LookupTable`, which chooses between the approaches below at compile time
+template<typename T, std::size_t tTableSize>
+void bm_table(benchmark::State& state) {
+  const Data<T, tTableSize> data{};
+  const grex::LookupTable<T, tTableSize> table{data.table};
+  bm_impl<T, tTableSize>(state, [&](const auto& /*table*/, auto idxs) {
+    return table.lookup(idxs, grex::full_tag<decltype(idxs)::size>);
+  });
+}
+// shuffles of the table spread across registers
+template<typename T, std::size_t tTableSize>
+void bm_shuffle(benchmark::State& state) {
+  bm_impl<T, tTableSize>(state, [](const auto& table, auto idxs) {
+    return grex::shuffle(grex::Vector<T, tTableSize>::load(table.data()), idxs);
+  });
+}
+// gathers from memory
+template<typename T, std::size_t tTableSize>
+void bm_gather(benchmark::State& state) {
+  bm_impl<T, tTableSize>(
+    state, [](const auto& table, auto idxs) { return grex::gather(std::span{table}, idxs); });
+}
+
+#define BM_LOOKUP(TYPE, SIZE) \
+  void bm_lookup_table_##TYPE##_##SIZE(benchmark::State& state) { \
+    bm_table<TYPE, SIZE>(state); \
+  } \
+  BENCHMARK(bm_lookup_table_##TYPE##_##SIZE); \
+  void bm_lookup_shuffle_##TYPE##_##SIZE(benchmark::State& state) { \
+    bm_shuffle<TYPE, SIZE>(state); \
+  } \
+  BENCHMARK(bm_lookup_shuffle_##TYPE##_##SIZE); \
+  void bm_lookup_gather_##TYPE##_##SIZE(benchmark::State& state) { \
+    bm_gather<TYPE, SIZE>(state); \
+  } \
+  BENCHMARK(bm_lookup_gather_##TYPE##_##SIZE)
+
+BM_LOOKUP(u8, 16);
+BM_LOOKUP(u8, 32);
+BM_LOOKUP(u8, 64);
+BM_LOOKUP(u8, 128);
+BM_LOOKUP(u8, 256);
+BM_LOOKUP(u16, 16);
+BM_LOOKUP(u16, 32);
+BM_LOOKUP(u16, 64);
+BM_LOOKUP(u16, 128);
+BM_LOOKUP(u32, 8);
+BM_LOOKUP(u32, 16);
+BM_LOOKUP(u32, 32);
+BM_LOOKUP(u32, 64);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t buffer_size = 4096;
+
+template<typename T>
+std::vector<T> make_buffer(T lo, T hi) {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg32 rng(seed_source);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<T> buf(buffer_size);
+  for (T& v : buf) {
+    v = dist(rng);
+  }
+  return buf;
+}
+
+// the C standard library, one value at a time
+template<typename T>
+void bm_libm(benchmark::State& state, auto op, T lo, T hi) {
+  const std::vector<T> src = make_buffer(lo, hi);
+  std::vector<T> dst(buffer_size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < buffer_size; ++i) {
+      dst[i] = op(src[i]);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+// grex using native vectors
+template<typename T>
+void bm_grex(benchmark::State& state, auto op, T lo, T hi) {
+  using Vec = grex::Vector<T, grex::max_native_size<T>>;
+  const std::vector<T> src = make_buffer(lo, hi);
+  std::vector<T> dst(buffer_size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < buffer_size; i += Vec::size) {
+      op(Vec::load(src.data() + i)).store(dst.data() + i);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+#define BM_MATH(NAME, TYPE, LO, HI) \
+  void bm_##NAME##_libm_##TYPE(benchmark::State& state) { \
+    bm_libm<TYPE>(state, [](TYPE x) { return std::NAME(x); }, TYPE(LO), TYPE(HI)); \
+  } \
+  BENCHMARK(bm_##NAME##_libm_##TYPE); \
+  void bm_##NAME##_grex_##TYPE(benchmark::State& state) { \
+    bm_grex<TYPE>(state, [](auto x) { return grex::NAME(x); }, TYPE(LO), TYPE(HI)); \
+  } \
+  BENCHMARK(bm_##NAME##_grex_##TYPE)
+#define BM_MATH_ALL(NAME, LO, HI) \
+  BM_MATH(NAME, f32, LO, HI); \
+  BM_MATH(NAME, f64, LO, HI);
+// the trigonometric functions additionally with fast accuracy
+#define BM_TRIG(NAME, TYPE, LO, HI) \
+  BM_MATH(NAME, TYPE, LO, HI); \
+  void bm_##NAME##_grex_fast_##TYPE(benchmark::State& state) { \
+    bm_grex<TYPE>( \
+      state, [](auto x) { return grex::NAME<grex::MathAccuracy::fast>(x); }, TYPE(LO), \
+      TYPE(HI)); \
+  } \
+  BENCHMARK(bm_##NAME##_grex_fast_##TYPE)
+#define BM_TRIG_ALL(NAME, LO, HI) \
+  BM_TRIG(NAME, f32, LO, HI); \
+  BM_TRIG(NAME, f64, LO, HI);
+
+BM_MATH_ALL(exp, -80, 80) // NOLINT
+BM_MATH_ALL(exp2, -120, 120) // NOLINT
+BM_MATH_ALL(expm1, -80, 80) // NOLINT
+BM_MATH_ALL(log, 0, 1000) // NOLINT
+BM_MATH_ALL(log2, 0, 1000) // NOLINT
+BM_MATH_ALL(log1p, -1, 1000) // NOLINT
+BM_TRIG_ALL(sin, -100, 100) // NOLINT
+BM_TRIG_ALL(cos, -100, 100) // NOLINT
+BM_TRIG_ALL(tan, -100, 100) // NOLINT
+BM_TRIG_ALL(atan, -100, 100) // NOLINT
+} // namespace
+
+BENCHMARK_MAIN();
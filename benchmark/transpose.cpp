@@ -0,0 +1,101 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t buffer_size = 16384;
+
+template<typename T>
+std::vector<T> make_buffer() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg64 rng(seed_source);
+  // truncating uniformly distributed 64-bit integers, whose bits are all we care about
+  std::uniform_int_distribution<u64> dist{};
+  std::vector<T> buf(buffer_size);
+  for (T& v : buf) {
+    v = T(dist(rng));
+  }
+  return buf;
+}
+
+// transpose consecutive row-major blocks of `tRows` rows with `tCols` values each, one at a time
+template<typename T, std::size_t tRows, std::size_t tCols>
+void bm_scalar(benchmark::State& state) {
+  static constexpr std::size_t block = tRows * tCols;
+  const std::vector<T> src = make_buffer<T>();
+  std::vector<T> dst(buffer_size);
+  for (auto _ : state) {
+    for (std::size_t b = 0; b < buffer_size; b += block) {
+      for (std::size_t i = 0; i < tRows; ++i) {
+        for (std::size_t j = 0; j < tCols; ++j) {
+          dst[b + j * tRows + i] = src[b + i * tCols + j];
+        }
+      }
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+// the same using a register-block transpose
+template<typename T, std::size_t tRows, std::size_t tCols>
+void bm_grex(benchmark::State& state) {
+  static constexpr std::size_t block = tRows * tCols;
+  const std::vector<T> src = make_buffer<T>();
+  std::vector<T> dst(buffer_size);
+  for (auto _ : state) {
+    for (std::size_t b = 0; b < buffer_size; b += block) {
+      const auto rows = grex::static_apply<tRows>([&]<std::size_t... tIdxs>() {
+        return std::array{grex::Vector<T, tCols>::load(src.data() + b + tIdxs * tCols)...};
+      });
+      const auto cols = grex::transpose(rows);
+      for (std::size_t j = 0; j < tCols; ++j) {
+        cols[j].store(dst.data() + b + j * tRows);
+      }
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(buffer_size));
+}
+
+#define BM_TRANSPOSE(TYPE, ROWS, COLS) \
+  void bm_transpose_scalar_##TYPE##_##ROWS##x##COLS(benchmark::State& state) { \
+    bm_scalar<TYPE, ROWS, COLS>(state); \
+  } \
+  BENCHMARK(bm_transpose_scalar_##TYPE##_##ROWS##x##COLS); \
+  void bm_transpose_grex_##TYPE##_##ROWS##x##COLS(benchmark::State& state) { \
+    bm_grex<TYPE, ROWS, COLS>(state); \
+  } \
+  BENCHMARK(bm_transpose_grex_##TYPE##_##ROWS##x##COLS)
+
+// square blocks of the native sizes of all levels
+BM_TRANSPOSE(f64, 2, 2);
+BM_TRANSPOSE(f64, 4, 4);
+BM_TRANSPOSE(f64, 8, 8);
+BM_TRANSPOSE(f32, 4, 4);
+BM_TRANSPOSE(f32, 8, 8);
+BM_TRANSPOSE(f32, 16, 16);
+BM_TRANSPOSE(u16, 8, 8);
+BM_TRANSPOSE(u16, 16, 16);
+BM_TRANSPOSE(u16, 32, 32);
+BM_TRANSPOSE(u8, 16, 16);
+BM_TRANSPOSE(u8, 32, 32);
+BM_TRANSPOSE(u8, 64, 64);
+// rectangular blocks
+BM_TRANSPOSE(f32, 4, 8);
+BM_TRANSPOSE(f32, 8, 4);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t block_size = 128;
+inline constexpr std::size_t block_num = 1UZ << 9UZ;
+inline constexpr std::size_t value_num = block_size * block_num;
+// bit-packed loads may read beyond the end of the data
+inline constexpr std::size_t padding = 64;
+
+template<std::size_t tBits>
+std::vector<u32> make_values() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg64 rng(seed_source);
+  std::uniform_int_distribution<u32> dist{0, u32((u64{1} << tBits) - 1U)};
+  std::vector<u32> buf(value_num);
+  for (u32& v : buf) {
+    v = dist(rng);
+  }
+  return buf;
+}
+template<std::size_t tBits>
+std::vector<std::byte> make_packed() {
+  const std::vector<u32> values = make_values<tBits>();
+  std::vector<std::byte> packed(value_num * tBits / 8 + padding);
+  for (std::size_t i = 0; i < value_num; ++i) {
+    grex::backend::store_bitpacked(packed.data(), i, values[i], grex::index_tag<tBits>);
+  }
+  return packed;
+}
+
+// one value at a time, assembled byte by byte
+template<std::size_t tBits>
+void bm_unpack_scalar(benchmark::State& state) {
+  const std::vector<std::byte> src = make_packed<tBits>();
+  std::vector<u32> dst(value_num);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; ++i) {
+      dst[i] = grex::backend::load_bitpacked(src.data(), i, grex::index_tag<tBits>,
+                                             grex::type_tag<u32>);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+template<std::size_t tBits>
+void bm_unpack_block(benchmark::State& state) {
+  const std::vector<std::byte> src = make_packed<tBits>();
+  std::vector<u32> dst(value_num);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; i += block_size) {
+      grex::load_bitpacked_block(src.data() + i * tBits / 8, dst.data() + i,
+                                 grex::index_tag<tBits>, grex::index_tag<block_size>);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+
+template<std::size_t tBits>
+void bm_pack_scalar(benchmark::State& state) {
+  const std::vector<u32> src = make_values<tBits>();
+  std::vector<std::byte> dst(value_num * tBits / 8);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; ++i) {
+      grex::backend::store_bitpacked(dst.data(), i, src[i], grex::index_tag<tBits>);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+template<std::size_t tBits>
+void bm_pack_block(benchmark::State& state) {
+  const std::vector<u32> src = make_values<tBits>();
+  std::vector<std::byte> dst(value_num * tBits / 8);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; i += block_size) {
+      grex::store_bitpacked_block(dst.data() + i * tBits / 8, src.data() + i,
+                                  grex::index_tag<tBits>, grex::index_tag<block_size>);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+
+#define BM_BITPACKED(BITS) \
+  void bm_unpack_scalar_##BITS(benchmark::State& state) { \
+    bm_unpack_scalar<BITS>(state); \
+  } \
+  BENCHMARK(bm_unpack_scalar_##BITS); \
+  void bm_unpack_block_##BITS(benchmark::State& state) { \
+    bm_unpack_block<BITS>(state); \
+  } \
+  BENCHMARK(bm_unpack_block_##BITS); \
+  void bm_pack_scalar_##BITS(benchmark::State& state) { \
+    bm_pack_scalar<BITS>(state); \
+  } \
+  BENCHMARK(bm_pack_scalar_##BITS); \
+  void bm_pack_block_##BITS(benchmark::State& state) { \
+    bm_pack_block<BITS>(state); \
+  } \
+  BENCHMARK(bm_pack_block_##BITS)
+
+BM_BITPACKED(3); // NOLINT
+BM_BITPACKED(7); // NOLINT
+BM_BITPACKED(12); // NOLINT
+BM_BITPACKED(17); // NOLINT
+BM_BITPACKED(29); // NOLINT
+} // namespace
+
+BENCHMARK_MAIN();
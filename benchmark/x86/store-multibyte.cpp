@@ -0,0 +1,84 @@
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <pcg_extras.hpp>
+#include <pcg_random.hpp>
+
+#include "grex/grex.hpp"
+
+using namespace grex::primitives;
+
+namespace {
+inline constexpr std::size_t value_num = 1UZ << 16UZ;
+
+template<typename T>
+std::vector<T> make_values() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source;
+  pcg64 rng(seed_source);
+  std::uniform_int_distribution<T> dist{};
+  std::vector<T> buf(value_num);
+  for (T& v : buf) {
+    v = dist(rng);
+  }
+  return buf;
+}
+
+// one value at a time using memcpy
+template<std::size_t tDst>
+void bm_stmb_scalar(benchmark::State& state) {
+  using Value = grex::UnsignedInt<std::bit_ceil(tDst)>;
+  const std::vector<Value> src = make_values<Value>();
+  std::vector<std::byte> dst(value_num * tDst);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; ++i) {
+      grex::store_multibyte(dst.data() + i * tDst, src[i], grex::index_tag<tDst>,
+                            grex::scalar_tag);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+
+// vectors with `tSize` lanes
+template<std::size_t tDst, std::size_t tSize>
+void bm_stmb_vector(benchmark::State& state) {
+  using Value = grex::UnsignedInt<std::bit_ceil(tDst)>;
+  using Vec = grex::Vector<Value, tSize>;
+  const std::vector<Value> src = make_values<Value>();
+  std::vector<std::byte> dst(value_num * tDst);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < value_num; i += tSize) {
+      Vec::load(src.data() + i).store_multibyte(dst.data() + i * tDst, grex::index_tag<tDst>);
+    }
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * std::int64_t(value_num));
+}
+
+#define BM_STMB(DST, SIZE128) \
+  void bm_stmb_scalar_##DST(benchmark::State& state) { \
+    bm_stmb_scalar<DST>(state); \
+  } \
+  BENCHMARK(bm_stmb_scalar_##DST); \
+  void bm_stmb_vector128_##DST(benchmark::State& state) { \
+    bm_stmb_vector<DST, SIZE128>(state); \
+  } \
+  BENCHMARK(bm_stmb_vector128_##DST); \
+  void bm_stmb_vector_native_##DST(benchmark::State& state) { \
+    bm_stmb_vector<DST, grex::max_native_size<grex::UnsignedInt<std::bit_ceil(DST##UZ)>>>(state); \
+  } \
+  BENCHMARK(bm_stmb_vector_native_##DST)
+
+BM_STMB(3, 4); // NOLINT
+BM_STMB(5, 2); // NOLINT
+BM_STMB(6, 2); // NOLINT
+BM_STMB(7, 2); // NOLINT
+} // namespace
+
+BENCHMARK_MAIN();
@@ -29,6 +29,30 @@
   GREX_FOREACH_UINT_TYPE(MACRO, REGISTERBITS __VA_OPT__(, ) __VA_ARGS__) \
   GREX_FOREACH_SINT_TYPE(MACRO, REGISTERBITS __VA_OPT__(, ) __VA_ARGS__)
 
+// Integers in ascending order of width, for operations on wider integers
+// that are implemented in terms of the same operation on narrower integers
+#define GREX_FOREACH_INT_TYPE_ASC(MACRO, REGISTERBITS, ...) \
+  MACRO(u, 8, GREX_DIVIDE(REGISTERBITS, 8) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 8, GREX_DIVIDE(REGISTERBITS, 8) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(u, 16, GREX_DIVIDE(REGISTERBITS, 16) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 16, GREX_DIVIDE(REGISTERBITS, 16) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(u, 32, GREX_DIVIDE(REGISTERBITS, 32) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 32, GREX_DIVIDE(REGISTERBITS, 32) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(u, 64, GREX_DIVIDE(REGISTERBITS, 64) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 64, GREX_DIVIDE(REGISTERBITS, 64) __VA_OPT__(, ) __VA_ARGS__)
+
+// 8/16-bit integers only, for which most saturating instructions are available
+#define GREX_FOREACH_NARROW_INT_TYPE(MACRO, REGISTERBITS, ...) \
+  MACRO(u, 16, GREX_DIVIDE(REGISTERBITS, 16) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(u, 8, GREX_DIVIDE(REGISTERBITS, 8) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 16, GREX_DIVIDE(REGISTERBITS, 16) __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 8, GREX_DIVIDE(REGISTERBITS, 8) __VA_OPT__(, ) __VA_ARGS__)
+// 8/16/32-bit integers only, which have a double-width counterpart
+#define GREX_FOREACH_WIDENABLE_INT_TYPE(MACRO, REGISTERBITS, ...) \
+  MACRO(u, 32, GREX_DIVIDE(REGISTERBITS, 32) __VA_OPT__(, ) __VA_ARGS__) \
+  GREX_FOREACH_NARROW_INT_TYPE(MACRO, REGISTERBITS __VA_OPT__(, ) __VA_ARGS__) \
+  MACRO(i, 32, GREX_DIVIDE(REGISTERBITS, 32) __VA_OPT__(, ) __VA_ARGS__)
+
 #define GREX_FOREACH_TYPE(MACRO, REGISTERBITS, ...) \
   GREX_FOREACH_FP_TYPE(MACRO, REGISTERBITS __VA_OPT__(, ) __VA_ARGS__) \
   GREX_FOREACH_INT_TYPE(MACRO, REGISTERBITS __VA_OPT__(, ) __VA_ARGS__)
@@ -0,0 +1,55 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_NARROW_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_NARROW_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/types.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp" // IWYU pragma: keep
+
+namespace grex::backend {
+// Saturating, averaging and absolute-difference arithmetic on 8/16-bit integers,
+// all of which is supported natively.
+// The absolute difference of signed integers always fits into the unsigned counterpart,
+// which is why the result of vabdq is reinterpreted.
+#define GREX_NARROW(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> add_saturate(NativeVector<KIND##BITS, SIZE> a, \
+                                                     NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_ISUFFIXED(vqaddq, KIND, BITS)(a.r, b.r)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> subtract_saturate(NativeVector<KIND##BITS, SIZE> a, \
+                                                          NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_ISUFFIXED(vqsubq, KIND, BITS)(a.r, b.r)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> average_round(NativeVector<KIND##BITS, SIZE> a, \
+                                                      NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_ISUFFIXED(vrhaddq, KIND, BITS)(a.r, b.r)}; \
+  } \
+  inline NativeVector<u##BITS, SIZE> abs_diff(NativeVector<KIND##BITS, SIZE> a, \
+                                              NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = as<u##BITS>(GREX_ISUFFIXED(vabdq, KIND, BITS)(a.r, b.r))}; \
+  } \
+  inline u64 sum_abs_diff(NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    /* widening horizontal sum, which cannot overflow */ \
+    return GREX_ISUFFIXED(vaddlvq, u, BITS)(abs_diff(a, b).r); \
+  }
+GREX_FOREACH_NARROW_INT_TYPE(GREX_NARROW, 128)
+
+GREX_NNVECTOR_BINARY(add_saturate)
+GREX_NNVECTOR_BINARY(subtract_saturate)
+GREX_NNVECTOR_BINARY(average_round)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/arithmetic-narrow.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_NARROW_HPP
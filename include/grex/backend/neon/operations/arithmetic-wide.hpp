@@ -0,0 +1,58 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_WIDE_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_WIDE_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Double-width products, which are supported natively for the lower and upper halves.
+// The sums of the products of adjacent elements are computed using pairwise addition.
+#define GREX_MULWIDE_LO(KIND, BITS) \
+  GREX_ISUFFIXED(vmull, KIND, BITS) \
+  (GREX_ISUFFIXED(vget_low, KIND, BITS)(a.r), GREX_ISUFFIXED(vget_low, KIND, BITS)(b.r))
+#define GREX_MULWIDE_HI(KIND, BITS) GREX_ISUFFIXED(vmull_high, KIND, BITS)(a.r, b.r)
+#define GREX_MULWIDE(KIND, BITS, SIZE) \
+  inline NativeVector<WideInt<KIND##BITS>, GREX_DIVIDE(SIZE, 2)> multiply_wide_lower( \
+    NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_MULWIDE_LO(KIND, BITS)}; \
+  } \
+  inline VectorFor<WideInt<KIND##BITS>, SIZE> multiply_wide(NativeVector<KIND##BITS, SIZE> a, \
+                                                            NativeVector<KIND##BITS, SIZE> b) { \
+    return {.lower = {.r = GREX_MULWIDE_LO(KIND, BITS)}, \
+            .upper = {.r = GREX_MULWIDE_HI(KIND, BITS)}}; \
+  } \
+  inline NativeVector<WideInt<KIND##BITS>, GREX_DIVIDE(SIZE, 2)> multiply_add_pairs( \
+    NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_ISUFFIXED(vpaddq, KIND, GREX_MULTIPLY(BITS, 2))( \
+              GREX_MULWIDE_LO(KIND, BITS), GREX_MULWIDE_HI(KIND, BITS))}; \
+  }
+GREX_FOREACH_WIDENABLE_INT_TYPE(GREX_MULWIDE, 128)
+
+// Sums of the 16-bit products of adjacent unsigned and signed 8-bit elements, which saturate.
+// The products of the zero-/sign-extended elements always fit into 16 bits, while their sums
+// are computed from the even-numbered and odd-numbered products using saturating addition.
+inline NativeVector<i16, 8> multiply_add_pairs(NativeVector<u8, 16> a, NativeVector<i8, 16> b) {
+  const int16x8_t lo = vmulq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(a.r))),
+                                 vmovl_s8(vget_low_s8(b.r)));
+  const int16x8_t hi = vmulq_s16(vreinterpretq_s16_u16(vmovl_high_u8(a.r)), vmovl_high_s8(b.r));
+  return {.r = vqaddq_s16(vuzp1q_s16(lo, hi), vuzp2q_s16(lo, hi))};
+}
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/arithmetic-wide.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ARITHMETIC_WIDE_HPP
@@ -72,6 +72,45 @@ namespace grex::backend {
     GREX_MUL_##BITS(KIND, BITS) \
   }
 
+// Upper half of the double-width integer product
+// 8–32 bit: Widening multiplication of the lower and upper halves, followed by extracting the
+// upper halves of the products
+#define GREX_MULHI_WIDEN(KIND, BITS) \
+  const auto lo = GREX_ISUFFIXED(vmull, KIND, BITS)(GREX_ISUFFIXED(vget_low, KIND, BITS)(a.r), \
+                                                    GREX_ISUFFIXED(vget_low, KIND, BITS)(b.r)); \
+  const auto hi = GREX_ISUFFIXED(vmull_high, KIND, BITS)(a.r, b.r); \
+  return {.r = GREX_ISUFFIXED(vuzp2q, KIND, BITS)(as<KIND##BITS>(lo), as<KIND##BITS>(hi))};
+// 64 bit: Schoolbook multiplication using four 32×32→64 bit multiplications
+#define GREX_MULHI_u64(...) \
+  const uint32x2_t alo = vmovn_u64(a.r); \
+  const uint32x2_t ahi = vshrn_n_u64(a.r, 32); \
+  const uint32x2_t blo = vmovn_u64(b.r); \
+  const uint32x2_t bhi = vshrn_n_u64(b.r, 32); \
+  /* ahi * blo + ((alo * blo) >> 32), which cannot overflow */ \
+  const uint64x2_t t = vsraq_n_u64(vmull_u32(ahi, blo), vmull_u32(alo, blo), 32); \
+  /* (t & 0xFFFFFFFF) + alo * bhi, which cannot overflow */ \
+  const uint64x2_t w = vmlal_u32(vmovl_u32(vmovn_u64(t)), alo, bhi); \
+  /* ahi * bhi + (t >> 32) + (w >> 32) */ \
+  return {.r = vsraq_n_u64(vsraq_n_u64(vmull_u32(ahi, bhi), t, 32), w, 32)};
+// The signed product is obtained by subtracting b if a < 0 and a if b < 0
+#define GREX_MULHI_i64(...) \
+  const uint64x2_t una = vreinterpretq_u64_s64(a.r); \
+  const uint64x2_t unb = vreinterpretq_u64_s64(b.r); \
+  const uint64x2_t hi = multiply_high(u64x2{.r = una}, u64x2{.r = unb}).r; \
+  const uint64x2_t corra = vandq_u64(vreinterpretq_u64_s64(vshrq_n_s64(a.r, 63)), unb); \
+  const uint64x2_t corrb = vandq_u64(vreinterpretq_u64_s64(vshrq_n_s64(b.r, 63)), una); \
+  return {.r = vreinterpretq_s64_u64(vsubq_u64(hi, vaddq_u64(corra, corrb)))};
+#define GREX_MULHI_64(KIND, BITS) GREX_MULHI_##KIND##BITS(KIND, BITS)
+#define GREX_MULHI_32 GREX_MULHI_WIDEN
+#define GREX_MULHI_16 GREX_MULHI_WIDEN
+#define GREX_MULHI_8 GREX_MULHI_WIDEN
+
+#define GREX_MULHI(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> multiply_high(NativeVector<KIND##BITS, SIZE> a, \
+                                                      NativeVector<KIND##BITS, SIZE> b) { \
+    GREX_MULHI_##BITS(KIND, BITS) \
+  }
+
 #define GREX_ARITH_DIV(KIND, BITS, SIZE) \
   inline NativeVector<KIND##BITS, SIZE> divide(NativeVector<KIND##BITS, SIZE> a, \
                                                NativeVector<KIND##BITS, SIZE> b) { \
@@ -79,12 +118,14 @@ namespace grex::backend {
   }
 
 GREX_FOREACH_TYPE(GREX_ARITH, 128)
+GREX_FOREACH_INT_TYPE(GREX_MULHI, 128)
 GREX_FOREACH_FP_TYPE(GREX_ARITH_DIV, 128)
 
 GREX_NNVECTOR_UNARY(negate)
 GREX_NNVECTOR_BINARY(add)
 GREX_NNVECTOR_BINARY(subtract)
 GREX_NNVECTOR_BINARY(multiply)
+GREX_NNVECTOR_BINARY(multiply_high)
 GREX_NNVECTOR_BINARY(divide)
 } // namespace grex::backend
 
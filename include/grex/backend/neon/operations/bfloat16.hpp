@@ -0,0 +1,30 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BFLOAT16_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BFLOAT16_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/neon/operations/load.hpp"
+#include "grex/backend/neon/operations/store.hpp"
+#include "grex/backend/neon/types.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/bfloat16.hpp" // IWYU pragma: export
+
+// BFDOT computes both products of each pair and adds them to the accumulator,
+// with subnormals flushed to zero and the sum of the products rounded to odd.
+
+namespace grex::backend {
+#if __ARM_FEATURE_BF16_VECTOR_ARITHMETIC
+inline f32x4 dot_accumulate(u32x4 a, u32x4 b, f32x4 acc) {
+  return {.r = vbfdotq_f32(acc.r, vreinterpretq_bf16_u32(a.r), vreinterpretq_bf16_u32(b.r))};
+}
+#endif
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BFLOAT16_HPP
@@ -0,0 +1,88 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BIT_MANIPULATION_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BIT_MANIPULATION_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/types.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Most operations work on bytes, whose results are then reinterpreted or combined
+#define GREX_BITMANIP_BYTES(KIND, BITS) reinterpret(v.r, type_tag<u8>)
+#define GREX_BITMANIP_FROM(KIND, BITS, X) reinterpret(X, type_tag<KIND##BITS>)
+
+// Population count: Count the bits of each byte and add adjacent counts pairwise
+#define GREX_POPCNT_8(KIND) vcntq_u8(GREX_BITMANIP_BYTES(KIND, 8))
+#define GREX_POPCNT_16(KIND) vpaddlq_u8(GREX_POPCNT_8(KIND))
+#define GREX_POPCNT_32(KIND) vpaddlq_u16(GREX_POPCNT_16(KIND))
+#define GREX_POPCNT_64(KIND) vpaddlq_u32(GREX_POPCNT_32(KIND))
+#define GREX_POPCNT(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> popcount(NativeVector<KIND##BITS, SIZE> v) { \
+    return {.r = GREX_BITMANIP_FROM(KIND, BITS, GREX_POPCNT_##BITS(KIND))}; \
+  }
+GREX_FOREACH_INT_TYPE(GREX_POPCNT, 128)
+GREX_NNVECTOR_UNARY(popcount)
+
+// Leading zero count: Native except for 64 bit, which uses the fallback
+#define GREX_CLZ(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> countl_zero(NativeVector<KIND##BITS, SIZE> v) { \
+    return {.r = GREX_ISUFFIXED(vclzq, KIND, BITS)(v.r)}; \
+  }
+GREX_CLZ(u, 8, 16)
+GREX_CLZ(i, 8, 16)
+GREX_CLZ(u, 16, 8)
+GREX_CLZ(i, 16, 8)
+GREX_CLZ(u, 32, 4)
+GREX_CLZ(i, 32, 4)
+
+// Reversal of the bytes within each element
+#define GREX_BYTESWAP_IMPL_8(X) X
+#define GREX_BYTESWAP_IMPL_16(X) vrev16q_u8(X)
+#define GREX_BYTESWAP_IMPL_32(X) vrev32q_u8(X)
+#define GREX_BYTESWAP_IMPL_64(X) vrev64q_u8(X)
+#define GREX_BYTESWAP(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> byteswap(NativeVector<KIND##BITS, SIZE> v) { \
+    const auto swapped = GREX_BYTESWAP_IMPL_##BITS(GREX_BITMANIP_BYTES(KIND, BITS)); \
+    return {.r = GREX_BITMANIP_FROM(KIND, BITS, swapped)}; \
+  }
+GREX_FOREACH_INT_TYPE(GREX_BYTESWAP, 128)
+GREX_NNVECTOR_UNARY(byteswap)
+
+// Bit reversal: Reverse the bits of each byte and then the bytes of each element
+#define GREX_BITREV(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> bit_reverse(NativeVector<KIND##BITS, SIZE> v) { \
+    const auto reversed = GREX_BYTESWAP_IMPL_##BITS(vrbitq_u8(GREX_BITMANIP_BYTES(KIND, BITS))); \
+    return {.r = GREX_BITMANIP_FROM(KIND, BITS, reversed)}; \
+  }
+GREX_FOREACH_INT_TYPE(GREX_BITREV, 128)
+GREX_NNVECTOR_UNARY(bit_reverse)
+
+// Trailing zero count: The leading zeros of the bit reversal, except for 64 bit,
+// which uses the fallback as there is no native leading zero count
+#define GREX_CTZ(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> countr_zero(NativeVector<KIND##BITS, SIZE> v) { \
+    return countl_zero(bit_reverse(v)); \
+  }
+GREX_CTZ(u, 8, 16)
+GREX_CTZ(i, 8, 16)
+GREX_CTZ(u, 16, 8)
+GREX_CTZ(i, 16, 8)
+GREX_CTZ(u, 32, 4)
+GREX_CTZ(i, 32, 4)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/bit-manipulation.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BIT_MANIPULATION_HPP
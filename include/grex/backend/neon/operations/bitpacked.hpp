@@ -0,0 +1,76 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BITPACKED_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BITPACKED_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/operations/store.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/bitpacked.hpp" // IWYU pragma: export
+
+// Bit-packed integers are gathered from and scattered to their bytes using table lookups.
+
+namespace grex::backend {
+template<std::size_t tBits, std::size_t tFirst, typename T, std::size_t tSize>
+requires(sizeof(T) * tSize == 16)
+inline NativeVector<T, tSize> bitpacked_windows_128(const u8* ptr, IndexTag<tBits> /*bits*/,
+                                                    IndexTag<tFirst> /*first*/,
+                                                    TypeTag<NativeVector<T, tSize>> /*tag*/) {
+  static constexpr auto idxs = bp::window_indices_128<sizeof(T), tBits, tFirst>;
+  const uint8x16_t windows = vqtbl1q_u8(vld1q_u8(ptr), vreinterpretq_u8_s8(vld1q_s8(idxs.data())));
+  return {.r = reinterpret(windows, type_tag<T>)};
+}
+
+template<std::size_t tBits, std::size_t tFirst, std::size_t tPart, typename T,
+         std::size_t tSize, bool tHigh>
+requires(sizeof(T) * tSize == 16)
+inline void store_bitpacked_128(u8* ptr, NativeVector<T, tSize> low, NativeVector<T, tSize> high,
+                                IndexTag<tBits> /*bits*/, IndexTag<tFirst> /*first*/,
+                                IndexTag<tPart> /*part*/, BoolTag<tHigh> /*has_high*/) {
+  static constexpr std::size_t groups = bp::group_count<tBits, tFirst, tPart>;
+  static constexpr std::size_t bytes = bp::byte_count<tBits, tFirst, tPart>;
+  const uint8x16_t low8 = reinterpret(low.r, type_tag<u8>);
+  const uint8x16_t high8 = reinterpret(high.r, type_tag<u8>);
+
+  // keep the bits before the first value
+  uint8x16_t out = vdupq_n_u8(0);
+  if constexpr (tFirst != 0) {
+    out = vsetq_lane_u8(u8(ptr[0] & ((1U << tFirst) - 1U)), out, 0);
+  }
+  // lanes which do not share any bytes are scattered by the same table lookup
+  static_apply<groups>([&]<std::size_t... tGroups>() {
+    auto scatter = [&]<std::size_t tGroup>(IndexTag<tGroup> /*group*/) {
+      static constexpr auto idxs =
+        bp::scatter_indices_128<sizeof(T), tBits, tFirst, tPart, groups, tGroup>;
+      out = vorrq_u8(out, vqtbl1q_u8(low8, vreinterpretq_u8_s8(vld1q_s8(idxs.data()))));
+    };
+    (..., scatter(index_tag<tGroups>));
+  });
+  if constexpr (tHigh) {
+    static constexpr auto idxs = bp::high_indices_128<sizeof(T), tBits, tFirst, tPart>;
+    out = vorrq_u8(out, vqtbl1q_u8(high8, vreinterpretq_u8_s8(vld1q_s8(idxs.data()))));
+  }
+  store_part(ptr, u8x16{.r = out}, std::min<std::size_t>(bytes, 16));
+  if constexpr (bytes > 16) {
+    // only possible for 4 × 32-bit lanes, the last of which then ends in the next byte
+    ptr[16] = vgetq_lane_u8(high8, 15);
+  }
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_BITPACKED_HPP
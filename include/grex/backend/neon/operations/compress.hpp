@@ -0,0 +1,72 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_COMPRESS_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_COMPRESS_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/neon/operations/bitwise.hpp"
+#include "grex/backend/neon/operations/load.hpp"
+#include "grex/backend/neon/operations/mask-bits.hpp"
+#include "grex/backend/neon/operations/mask-index.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/operations/split.hpp"
+#include "grex/backend/neon/operations/store.hpp"
+#include "grex/backend/neon/operations/to-array.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+// shared definitions
+#include "grex/backend/shared/operations/compress.hpp" // IWYU pragma: export
+
+namespace grex::backend {
+// Table lookup with an entry selected by the mask bits
+// 8 bit: A table with 2^16 entries would be too big → compress both halves separately
+// and move the compressed upper half right behind the compressed lower half
+inline uint8x16_t compress_bytes(u64 bits, uint8x16_t v) {
+  const auto& table = compress_table<8, 1>;
+  const u64 lo = bits & 0xFFU;
+  const u64 hi = bits >> 8U;
+  const uint8x8_t comp_lo = vqtbl1_u8(v, vld1_u8(table[lo].data()));
+  const uint8x8_t comp_hi = vqtbl1_u8(v, vadd_u8(vld1_u8(table[hi].data()), vdup_n_u8(8)));
+  // result[i] = (i < num_lo) ? comp_lo[i] : comp_hi[i - num_lo]
+  const uint8x16_t num_lo = vdupq_n_u8(u8(std::popcount(lo)));
+  constexpr std::array<u8, 16> iota{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  const uint8x16_t idxs = vld1q_u8(iota.data());
+  const uint8x16_t offset = vandq_u8(vcgeq_u8(idxs, num_lo), vsubq_u8(vdupq_n_u8(8), num_lo));
+  return vqtbl1q_u8(vcombine_u8(comp_lo, comp_hi), vaddq_u8(idxs, offset));
+}
+template<std::size_t tLaneBytes>
+inline uint8x16_t compress_bytes(u64 bits, uint8x16_t v) {
+  const auto& entry = compress_table<16 / tLaneBytes, tLaneBytes>[bits];
+  return vqtbl1q_u8(v, vld1q_u8(entry.data()));
+}
+
+#define GREX_COMPRESS_8(KIND, BITS) compress_bytes(to_bits(m), as<u8>(v.r))
+#define GREX_COMPRESS_16 GREX_COMPRESS_WIDE
+#define GREX_COMPRESS_32 GREX_COMPRESS_WIDE
+#define GREX_COMPRESS_64 GREX_COMPRESS_WIDE
+#define GREX_COMPRESS_WIDE(KIND, BITS) \
+  compress_bytes<GREX_DIVIDE(BITS, 8)>(to_bits(m), as<u8>(v.r))
+
+#define GREX_COMPRESS(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> compress(NativeMask<KIND##BITS, SIZE> m, \
+                                                 NativeVector<KIND##BITS, SIZE> v) { \
+    return {.r = as<KIND##BITS>(GREX_COMPRESS_##BITS(KIND, BITS))}; \
+  }
+GREX_FOREACH_TYPE(GREX_COMPRESS, 128)
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_COMPRESS_HPP
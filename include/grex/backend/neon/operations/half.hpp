@@ -0,0 +1,33 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_HALF_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_HALF_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/neon/operations/load.hpp"
+#include "grex/backend/neon/operations/store.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/half.hpp" // IWYU pragma: export
+
+// FCVTL/FCVTN convert between four f16 and four f32 values, while f64 is converted via f32.
+
+namespace grex::backend {
+inline f32x4 from_f16_bits(SubVector<u16, 4, 8> bits, TypeTag<f32x4> /*tag*/) {
+  return {.r = vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(bits.registr())))};
+}
+inline SubVector<u16, 4, 8> to_f16_bits(f32x4 v) {
+  const uint16x4_t bits = vreinterpret_u16_f16(vcvt_f16_f32(v.r));
+  return SubVector<u16, 4, 8>{vcombine_u16(bits, bits)};
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_HALF_HPP
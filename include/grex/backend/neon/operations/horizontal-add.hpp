@@ -51,6 +51,14 @@ GREX_FOREACH_TYPE(GREX_HADD, 128)
     GREX_CAT(GREX_HADD_, GREX_MULTIPLY(BITS, PART), _##BITS)(KIND, BITS, PART, SIZE) \
   }
 GREX_FOREACH_SUB(GREX_HADD_SUB)
+
+// Pair-wise sums of two vectors: [a0 + a1, a2 + a3, …, b0 + b1, b2 + b3, …]
+#define GREX_PADD(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> add_pairwise(NativeVector<KIND##BITS, SIZE> a, \
+                                                     NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_ISUFFIXED(vpaddq, KIND, BITS)(a.r, b.r)}; \
+  }
+GREX_FOREACH_TYPE(GREX_PADD, 128)
 } // namespace grex::backend
 
 #include "grex/backend/shared/operations/horizontal-add.hpp" // IWYU pragma: export
@@ -0,0 +1,51 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_INTERLEAVE_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_INTERLEAVE_HPP
+
+#include <array>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/blend-static.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/load.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/shuffle-static.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/store.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Native vectors use the structure loads/stores ld2/ld3/ld4 and st2/st3/st4
+#define GREX_INTERLEAVE(KIND, BITS, SIZE, K) \
+  inline std::array<NativeVector<KIND##BITS, SIZE>, K> load_interleaved( \
+    const KIND##BITS* ptr, IndexTag<K> /*k*/, TypeTag<NativeVector<KIND##BITS, SIZE>> /*tag*/) { \
+    const auto regs = GREX_ISUFFIXED(GREX_CAT(vld, K, q), KIND, BITS)(ptr); \
+    return static_apply<K>([&]<std::size_t... tJs>() { \
+      return std::array{NativeVector<KIND##BITS, SIZE>{.r = regs.val[tJs]}...}; \
+    }); \
+  } \
+  inline void store_interleaved(KIND##BITS* dst, \
+                                const std::array<NativeVector<KIND##BITS, SIZE>, K>& srcs) { \
+    using Regs = decltype(GREX_ISUFFIXED(GREX_CAT(vld, K, q), KIND, BITS)(dst)); \
+    static_apply<K>([&]<std::size_t... tJs>() { \
+      GREX_ISUFFIXED(GREX_CAT(vst, K, q), KIND, BITS)(dst, Regs{{srcs[tJs].r...}}); \
+    }); \
+  }
+GREX_FOREACH_TYPE(GREX_INTERLEAVE, 128, 2)
+GREX_FOREACH_TYPE(GREX_INTERLEAVE, 128, 3)
+GREX_FOREACH_TYPE(GREX_INTERLEAVE, 128, 4)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/interleave.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_INTERLEAVE_HPP
@@ -0,0 +1,110 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_BITS_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_BITS_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <optional>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// There is no movemask: Keep one distinct bit per lane and add them up horizontally
+inline constexpr std::array<u8, 16> tobits_weights_8{1, 2, 4, 8, 16, 32, 64, 128,
+                                                     1, 2, 4, 8, 16, 32, 64, 128};
+inline constexpr std::array<u16, 8> tobits_weights_16{1, 2, 4, 8, 16, 32, 64, 128};
+inline constexpr std::array<u32, 4> tobits_weights_32{1, 2, 4, 8};
+inline constexpr std::array<u64, 2> tobits_weights_64{1, 2};
+
+// 8 bit: Each half is summed separately, as the sum would not fit into 8 bits otherwise
+#define GREX_TOBITS_8 \
+  const uint8x16_t bits = vandq_u8(m.r, vld1q_u8(tobits_weights_8.data())); \
+  return u64(vaddv_u8(vget_low_u8(bits))) | (u64(vaddv_u8(vget_high_u8(bits))) << 8);
+#define GREX_TOBITS_16 return vaddvq_u16(vandq_u16(m.r, vld1q_u16(tobits_weights_16.data())));
+#define GREX_TOBITS_32 return vaddvq_u32(vandq_u32(m.r, vld1q_u32(tobits_weights_32.data())));
+#define GREX_TOBITS_64 return vaddvq_u64(vandq_u64(m.r, vld1q_u64(tobits_weights_64.data())));
+
+#define GREX_TOBITS(KIND, BITS, SIZE) \
+  inline u64 to_bits(NativeMask<KIND##BITS, SIZE> m) { \
+    GREX_TOBITS_##BITS \
+  }
+GREX_FOREACH_TYPE(GREX_TOBITS, 128)
+
+#define GREX_TOBITS_SUB(KIND, BITS, PART, SIZE) \
+  inline u64 to_bits(SubMask<KIND##BITS, PART, SIZE> m) { \
+    return to_bits(m.full) & ((u64{1} << PART) - 1); \
+  }
+GREX_FOREACH_SUB(GREX_TOBITS_SUB)
+
+// Broadcast the bits and test the distinct bit of each lane
+#define GREX_FROMBITS_8 \
+  const uint8x16_t bytes = vcombine_u8(vdup_n_u8(u8(bits)), vdup_n_u8(u8(bits >> 8U))); \
+  return {.r = vtstq_u8(bytes, vld1q_u8(tobits_weights_8.data()))};
+#define GREX_FROMBITS_16 \
+  return {.r = vtstq_u16(vdupq_n_u16(u16(bits)), vld1q_u16(tobits_weights_16.data()))};
+#define GREX_FROMBITS_32 \
+  return {.r = vtstq_u32(vdupq_n_u32(u32(bits)), vld1q_u32(tobits_weights_32.data()))};
+#define GREX_FROMBITS_64 \
+  return {.r = vtstq_u64(vdupq_n_u64(bits), vld1q_u64(tobits_weights_64.data()))};
+
+#define GREX_FROMBITS(KIND, BITS, SIZE) \
+  inline NativeMask<KIND##BITS, SIZE> from_bits(u64 bits, \
+                                                TypeTag<NativeMask<KIND##BITS, SIZE>> /*tag*/) { \
+    GREX_FROMBITS_##BITS \
+  }
+GREX_FOREACH_TYPE(GREX_FROMBITS, 128)
+
+#define GREX_FROMBITS_SUB(KIND, BITS, PART, SIZE) \
+  inline SubMask<KIND##BITS, PART, SIZE> from_bits( \
+    u64 bits, TypeTag<SubMask<KIND##BITS, PART, SIZE>> /*tag*/) { \
+    return SubMask<KIND##BITS, PART, SIZE>{ \
+      from_bits(bits, type_tag<NativeMask<KIND##BITS, SIZE>>)}; \
+  }
+GREX_FOREACH_SUB(GREX_FROMBITS_SUB)
+
+// Queries without computing the exact bit mask: Shift each 16-bit lane right by 4 and narrow,
+// which leaves 4 bits per byte, i.e. `BITS / 2` bits per lane
+inline u64 nibble_mask(uint8x16_t m) {
+  return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+#define GREX_MASK_QUERIES(KIND, BITS, SIZE) \
+  inline std::size_t count_true(NativeMask<KIND##BITS, SIZE> m) { \
+    return std::size_t(std::popcount(nibble_mask(as<u8>(m.r)))) / GREX_DIVIDE(BITS, 2); \
+  } \
+  inline bool horizontal_or(NativeMask<KIND##BITS, SIZE> m) { \
+    return nibble_mask(as<u8>(m.r)) != 0; \
+  } \
+  inline std::optional<std::size_t> first_true(NativeMask<KIND##BITS, SIZE> m) { \
+    const u64 nibbles = nibble_mask(as<u8>(m.r)); \
+    if (nibbles == 0) { \
+      return std::nullopt; \
+    } \
+    return std::size_t(std::countr_zero(nibbles)) / GREX_DIVIDE(BITS, 2); \
+  } \
+  inline std::optional<std::size_t> last_true(NativeMask<KIND##BITS, SIZE> m) { \
+    const u64 nibbles = nibble_mask(as<u8>(m.r)); \
+    if (nibbles == 0) { \
+      return std::nullopt; \
+    } \
+    return std::size_t(63 - std::countl_zero(nibbles)) / GREX_DIVIDE(BITS, 2); \
+  }
+GREX_FOREACH_TYPE(GREX_MASK_QUERIES, 128)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/mask-bits.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_BITS_HPP
@@ -0,0 +1,67 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_EXPAND_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_EXPAND_HPP
+
+#include <bit>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/neon/operations/bitwise.hpp"
+#include "grex/backend/neon/operations/load.hpp"
+#include "grex/backend/neon/operations/mask-bits.hpp"
+#include "grex/backend/neon/operations/mask-index.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/operations/split.hpp"
+#include "grex/backend/neon/operations/store.hpp"
+#include "grex/backend/neon/operations/to-array.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+// shared definitions
+#include "grex/backend/shared/operations/mask-expand.hpp" // IWYU pragma: export
+
+namespace grex::backend {
+// Table lookup with an entry selected by the mask bits
+// 8 bit: A table with 2^16 entries would be too big → look up both halves separately
+// and offset the indices of the upper half by the number of values used by the lower half
+inline uint8x16_t mask_expand_bytes(uint8x16_t v, u64 bits) {
+  const auto& table = expand_table<8, 1>;
+  const u64 lo = bits & 0xFFU;
+  const u64 hi = bits >> 8U;
+  // the padding remains out of range after adding the offset
+  const uint8x8_t idxs_lo = vld1_u8(table[lo].data());
+  const uint8x8_t idxs_hi = vadd_u8(vld1_u8(table[hi].data()), vdup_n_u8(u8(std::popcount(lo))));
+  return vqtbl1q_u8(v, vcombine_u8(idxs_lo, idxs_hi));
+}
+template<std::size_t tLaneBytes>
+inline uint8x16_t mask_expand_bytes(uint8x16_t v, u64 bits) {
+  const auto& entry = expand_table<16 / tLaneBytes, tLaneBytes>[bits];
+  return vqtbl1q_u8(v, vld1q_u8(entry.data()));
+}
+
+#define GREX_MASK_EXPAND_8(KIND, BITS) mask_expand_bytes(as<u8>(v.r), to_bits(m))
+#define GREX_MASK_EXPAND_16 GREX_MASK_EXPAND_WIDE
+#define GREX_MASK_EXPAND_32 GREX_MASK_EXPAND_WIDE
+#define GREX_MASK_EXPAND_64 GREX_MASK_EXPAND_WIDE
+#define GREX_MASK_EXPAND_WIDE(KIND, BITS) \
+  mask_expand_bytes<GREX_DIVIDE(BITS, 8)>(as<u8>(v.r), to_bits(m))
+
+#define GREX_MASK_EXPAND(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> mask_expand(NativeVector<KIND##BITS, SIZE> v, \
+                                                    NativeMask<KIND##BITS, SIZE> m) { \
+    return {.r = as<KIND##BITS>(GREX_MASK_EXPAND_##BITS(KIND, BITS))}; \
+  }
+GREX_FOREACH_TYPE(GREX_MASK_EXPAND, 128)
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MASK_EXPAND_HPP
@@ -12,9 +12,12 @@
 
 #include <arm_neon.h>
 
+#include "grex/backend/base.hpp"
 #include "grex/backend/choosers.hpp"
 #include "grex/backend/defs.hpp" // IWYU pragma: keep
 #include "grex/backend/neon/operations/load.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/operations/store.hpp"
 #include "grex/backend/neon/types.hpp"
 #include "grex/base.hpp"
 
@@ -63,6 +66,24 @@ inline SubVector<u32, 2, 4> load_multibyte(const u8* ptr, IndexTag<3> src,
                                            TypeTag<SubVector<u32, 2, 4>> /*dst*/) {
   return SubVector<u32, 2, 4>{load_multibyte(ptr, src, type_tag<u32x4>)};
 }
+
+// Store the lower M bytes of each of the first `num` N-byte integers contiguously, which is the
+// inverse of `load_multibyte`: Gather the data bytes at the bottom of the register using a table
+// lookup and write exactly `num * M` bytes using a partial store.
+template<std::size_t tDst, AnyVector TSrc>
+requires(!AnySuperNativeVector<TSrc> && tDst <= sizeof(typename TSrc::Value))
+inline void store_multibyte_part(u8* ptr, TSrc src, std::size_t num, IndexTag<tDst> /*dst*/) {
+  using Value = TSrc::Value;
+  const uint8x16_t raw = reinterpret(src.registr(), type_tag<u8>);
+  if constexpr (tDst == sizeof(Value)) {
+    store_part(ptr, u8x16{.r = raw}, num * tDst);
+  } else {
+    // 000·|111·|222·|333· → 000111222333····
+    static constexpr auto idxs = mb::pack_indices_128<tDst, sizeof(Value)>;
+    const uint8x16_t packed = vqtbl1q_u8(raw, vreinterpretq_u8_s8(vld1q_s8(idxs.data())));
+    store_part(ptr, u8x16{.r = packed}, num * tDst);
+  }
+}
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_MULTIBYTE_HPP
@@ -0,0 +1,35 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_PREFIX_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_PREFIX_HPP
+
+#include <cstddef>
+
+#include <arm_neon.h>
+
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// vext extracts the lanes of `v` slid up by `tNum`, preceded by the highest lanes of `front`
+#define GREX_SLIDE_UP(KIND, BITS, SIZE) \
+  template<std::size_t tNum> \
+  requires(tNum < SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> slide_up(NativeVector<KIND##BITS, SIZE> front, \
+                                                 NativeVector<KIND##BITS, SIZE> v, \
+                                                 IndexTag<tNum> /*num*/) { \
+    return {.r = GREX_ISUFFIXED(vextq, KIND, BITS)(front.r, v.r, SIZE - tNum)}; \
+  }
+GREX_FOREACH_TYPE(GREX_SLIDE_UP, 128)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/prefix.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_PREFIX_HPP
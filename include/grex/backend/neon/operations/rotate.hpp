@@ -0,0 +1,39 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ROTATE_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ROTATE_HPP
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Rotations by compile-time offsets: Shift right and insert the left-shifted bits (SLI)
+#define GREX_ROTATE(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> rotate_left(NativeVector<KIND##BITS, SIZE> v, \
+                                                    AnyIndexTag auto offset) { \
+    static constexpr int lshift = int(offset.value % BITS); \
+    if constexpr (lshift == 0) { \
+      return v; \
+    } else { \
+      const auto uv = reinterpret(v.r, type_tag<u##BITS>); \
+      const auto rot = vsliq_n_u##BITS(vshrq_n_u##BITS(uv, BITS - lshift), uv, lshift); \
+      return {.r = reinterpret(rot, type_tag<KIND##BITS>)}; \
+    } \
+  }
+GREX_FOREACH_INT_TYPE(GREX_ROTATE, 128)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/rotate.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_ROTATE_HPP
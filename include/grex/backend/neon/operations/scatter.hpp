@@ -0,0 +1,16 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SCATTER_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SCATTER_HPP
+
+#include "grex/backend/neon/operations/mask-bits.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/to-array.hpp" // IWYU pragma: keep
+
+// shared definitions
+#include "grex/backend/shared/operations/scatter.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SCATTER_HPP
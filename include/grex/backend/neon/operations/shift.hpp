@@ -7,12 +7,15 @@
 #ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SHIFT_HPP
 #define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SHIFT_HPP
 
+#include <cstddef>
+
 #include <arm_neon.h>
 
 #include "grex/backend/base.hpp"
 #include "grex/backend/defs.hpp" // IWYU pragma: keep
 #include "grex/backend/macros/for-each.hpp"
 #include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/reinterpret.hpp"
 #include "grex/backend/neon/types.hpp"
 #include "grex/backend/shared/operations/shift.hpp" // IWYU pragma: keep
 #include "grex/base.hpp"
@@ -35,6 +38,33 @@ GREX_FOREACH_INT_TYPE(GREX_LSHIFT, 128)
     } \
   }
 GREX_FOREACH_INT_TYPE(GREX_RSHIFT, 128)
+
+// Shifts by a runtime offset shared by all lanes, which are left shifts by a signed offset
+#define GREX_SHIFTR(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> shift_left(NativeVector<KIND##BITS, SIZE> v, \
+                                                   std::size_t offset) { \
+    return {.r = GREX_ISUFFIXED(vshlq, KIND, BITS)(v.r, vdupq_n_s##BITS(i##BITS(offset)))}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> shift_right(NativeVector<KIND##BITS, SIZE> v, \
+                                                    std::size_t offset) { \
+    const auto neg = vdupq_n_s##BITS(i##BITS(-i##BITS(offset))); \
+    return {.r = GREX_ISUFFIXED(vshlq, KIND, BITS)(v.r, neg)}; \
+  }
+GREX_FOREACH_INT_TYPE(GREX_SHIFTR, 128)
+
+// Shifts by per-lane offsets, which are also left shifts by signed offsets
+#define GREX_SHIFTV(KIND, BITS, SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> shift_left(NativeVector<KIND##BITS, SIZE> v, \
+                                                   NativeVector<u##BITS, SIZE> offsets) { \
+    const auto soffsets = reinterpret(offsets.r, type_tag<i##BITS>); \
+    return {.r = GREX_ISUFFIXED(vshlq, KIND, BITS)(v.r, soffsets)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> shift_right(NativeVector<KIND##BITS, SIZE> v, \
+                                                    NativeVector<u##BITS, SIZE> offsets) { \
+    const auto neg = vnegq_s##BITS(reinterpret(offsets.r, type_tag<i##BITS>)); \
+    return {.r = GREX_ISUFFIXED(vshlq, KIND, BITS)(v.r, neg)}; \
+  }
+GREX_FOREACH_INT_TYPE(GREX_SHIFTV, 128)
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_SHIFT_HPP
@@ -0,0 +1,48 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_NEON_OPERATIONS_TRANSPOSE_HPP
+#define INCLUDE_GREX_BACKEND_NEON_OPERATIONS_TRANSPOSE_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <arm_neon.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/macros/types.hpp"
+#include "grex/backend/neon/operations/merge.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/reinterpret.hpp"
+#include "grex/backend/neon/operations/shuffle-static.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/operations/split.hpp" // IWYU pragma: keep
+#include "grex/backend/neon/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+#define GREX_TRANSPOSE_TRN(BITS, SIZE) \
+  inline std::pair<GREX_REGISTER(u, BITS, SIZE), GREX_REGISTER(u, BITS, SIZE)> transpose_trn( \
+    GREX_REGISTER(u, BITS, SIZE) a, GREX_REGISTER(u, BITS, SIZE) b) { \
+    return {vtrn1q_u##BITS(a, b), vtrn2q_u##BITS(a, b)}; \
+  }
+GREX_TRANSPOSE_TRN(8, 16)
+GREX_TRANSPOSE_TRN(16, 8)
+GREX_TRANSPOSE_TRN(32, 4)
+GREX_TRANSPOSE_TRN(64, 2)
+
+// Native vectors use trn1/trn2 at `tDist` times the lane width to exchange the blocks
+template<std::size_t tDist, Vectorizable T, std::size_t tSize>
+inline std::pair<NativeVector<T, tSize>, NativeVector<T, tSize>>
+transpose_blocks(NativeVector<T, tSize> a, NativeVector<T, tSize> b, IndexTag<tDist> /*dist*/) {
+  using Block = UnsignedInt<sizeof(T) * tDist>;
+  const auto [lo, hi] = transpose_trn(as<Block>(a.r), as<Block>(b.r));
+  return {NativeVector<T, tSize>{as<T>(lo)}, NativeVector<T, tSize>{as<T>(hi)}};
+}
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/transpose.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_NEON_OPERATIONS_TRANSPOSE_HPP
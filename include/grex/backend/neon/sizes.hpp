@@ -42,6 +42,11 @@ static constexpr bool is_subnative = tSize > 1 &&
                                      std::has_single_bit(tSize) && tSize < min_native_size<T>;
 template<Vectorizable T, std::size_t tSize>
 static constexpr bool is_supernative = std::has_single_bit(tSize) && tSize > max_native_size<T>;
+
+// The largest table size in bytes for which dynamic shuffles are used instead of gathers,
+// which are performed element-wise: Four `tbl` instructions with four registers each
+template<Vectorizable T>
+static constexpr std::size_t max_shuffle_table_bytes = 256;
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_NEON_SIZES_HPP
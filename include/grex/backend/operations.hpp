@@ -16,6 +16,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <type_traits>
 #include <utility>
 
 #include "grex/backend/base.hpp"
@@ -36,6 +37,126 @@ inline Scalar<T> max(Scalar<T> a, Scalar<T> b) {
   return {.value = std::max(a.value, b.value)};
 }
 
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 i128; // NOLINT
+__extension__ typedef unsigned __int128 u128; // NOLINT
+#endif
+
+// The upper half of the double-width product
+template<IntVectorizable T>
+inline Scalar<T> multiply_high(Scalar<T> a, Scalar<T> b) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  if constexpr (sizeof(T) < 8) {
+    using Wide = CopySignInt<T, 2 * sizeof(T)>;
+    return {.value = T((Wide{a.value} * Wide{b.value}) >> bits)};
+  } else {
+#ifdef __SIZEOF_INT128__
+    using Wide = std::conditional_t<is_signed<T>, i128, u128>;
+    return {.value = T((Wide{a.value} * Wide{b.value}) >> bits)};
+#else
+    // schoolbook multiplication using 32×32→64 bit products
+    const u64 ua = u64(a.value);
+    const u64 ub = u64(b.value);
+    const u64 al = ua & 0xFFFFFFFFU;
+    const u64 ah = ua >> 32U;
+    const u64 bl = ub & 0xFFFFFFFFU;
+    const u64 bh = ub >> 32U;
+    const u64 t = (ah * bl) + ((al * bl) >> 32U);
+    const u64 w = (t & 0xFFFFFFFFU) + (al * bh);
+    u64 hi = (ah * bh) + (t >> 32U) + (w >> 32U);
+    if constexpr (is_signed<T>) {
+      // (a - 2^64·[a < 0])·(b - 2^64·[b < 0]) modulo 2^128
+      hi -= (a.value < 0 ? ub : 0) + (b.value < 0 ? ua : 0);
+    }
+    return {.value = T(hi)};
+#endif
+  }
+}
+
+// Shifts and rotations by a runtime offset
+template<IntVectorizable T>
+inline Scalar<T> shift_left(Scalar<T> v, std::size_t offset) {
+  return {.value = T(v.value << offset)};
+}
+template<IntVectorizable T>
+inline Scalar<T> shift_right(Scalar<T> v, std::size_t offset) {
+  return {.value = T(v.value >> offset)};
+}
+template<IntVectorizable T>
+inline Scalar<T> rotate_left(Scalar<T> v, std::size_t offset) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  return {.value = T(std::rotl(UnsignedInt<sizeof(T)>(v.value), int(offset % bits)))};
+}
+template<IntVectorizable T>
+inline Scalar<T> rotate_right(Scalar<T> v, std::size_t offset) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  return {.value = T(std::rotr(UnsignedInt<sizeof(T)>(v.value), int(offset % bits)))};
+}
+
+// Bit counts and bit reversal, which operate on the unsigned representation
+template<IntVectorizable T>
+inline Scalar<T> popcount(Scalar<T> v) {
+  return {.value = T(std::popcount(UnsignedInt<sizeof(T)>(v.value)))};
+}
+template<IntVectorizable T>
+inline Scalar<T> countl_zero(Scalar<T> v) {
+  return {.value = T(std::countl_zero(UnsignedInt<sizeof(T)>(v.value)))};
+}
+template<IntVectorizable T>
+inline Scalar<T> countr_zero(Scalar<T> v) {
+  return {.value = T(std::countr_zero(UnsignedInt<sizeof(T)>(v.value)))};
+}
+template<IntVectorizable T>
+inline Scalar<T> byteswap(Scalar<T> v) {
+  return {.value = std::byteswap(v.value)};
+}
+template<IntVectorizable T>
+inline Scalar<T> bit_reverse(Scalar<T> v) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  // swap adjacent bits, bit pairs and nibbles, whose masks are 0x55…, 0x33… and 0x0F…
+  auto swap = [](Unsigned x, int offset, Unsigned mask) {
+    const auto lower = Unsigned(Unsigned(x >> offset) & mask);
+    return Unsigned(lower | Unsigned(Unsigned(x & mask) << offset));
+  };
+  static constexpr Unsigned all = std::numeric_limits<Unsigned>::max();
+  Unsigned u = swap(Unsigned(v.value), 1, Unsigned(all / 3));
+  u = swap(u, 2, Unsigned(all / 5));
+  u = swap(u, 4, Unsigned(all / 17));
+  return {.value = T(std::byteswap(u))};
+}
+
+template<WidenableIntVectorizable T>
+inline Scalar<WideInt<T>> multiply_wide(Scalar<T> a, Scalar<T> b) {
+  return {.value = WideInt<T>(WideInt<T>{a.value} * WideInt<T>{b.value})};
+}
+
+// Saturating, averaging and absolute-difference arithmetic on 8/16-bit integers,
+// which is performed exactly using int
+template<NarrowIntVectorizable T>
+inline Scalar<T> add_saturate(Scalar<T> a, Scalar<T> b) {
+  using Limits = std::numeric_limits<T>;
+  return {.value = T(std::clamp(int{a.value} + int{b.value}, int{Limits::min()},
+                                int{Limits::max()}))};
+}
+template<NarrowIntVectorizable T>
+inline Scalar<T> subtract_saturate(Scalar<T> a, Scalar<T> b) {
+  using Limits = std::numeric_limits<T>;
+  return {.value = T(std::clamp(int{a.value} - int{b.value}, int{Limits::min()},
+                                int{Limits::max()}))};
+}
+template<NarrowIntVectorizable T>
+inline Scalar<T> average_round(Scalar<T> a, Scalar<T> b) {
+  return {.value = T((int{a.value} + int{b.value} + 1) >> 1)};
+}
+template<NarrowIntVectorizable T>
+inline Scalar<UnsignedInt<sizeof(T)>> abs_diff(Scalar<T> a, Scalar<T> b) {
+  return {.value = UnsignedInt<sizeof(T)>(std::abs(int{a.value} - int{b.value}))};
+}
+template<NarrowIntVectorizable T>
+inline u64 sum_abs_diff(Scalar<T> a, Scalar<T> b) {
+  return abs_diff(a, b).value;
+}
+
 inline bool logical_andnot(bool a, bool b) {
   return !a && b;
 }
@@ -70,6 +191,70 @@ inline bool is_finite(Scalar<T> v) {
   return std::isfinite(v.value);
 }
 
+// Conversions between f16 and f32 using integer operations (following Fabian Giesen),
+// which are also used by the vector backends without hardware support.
+// Rounding is to nearest-even, infinities are preserved and NaNs become quiet NaNs.
+inline f32 decode_f16(f16 h) {
+  static constexpr u32 shifted_exp = 0x7C00U << 13U;
+  u32 o = (h.bits & 0x7FFFU) << 13U;
+  const u32 exp = o & shifted_exp;
+  o += (127U - 15U) << 23U;
+  if (exp == shifted_exp) {
+    // infinity/NaN: move the exponent to the top
+    o += (128U - 16U) << 23U;
+  } else if (exp == 0) {
+    // zero/subnormal: renormalize by subtracting the implicit leading one
+    o = std::bit_cast<u32>(std::bit_cast<f32>(o + (1U << 23U)) - 0x1p-14F);
+  }
+  return std::bit_cast<f32>(o | ((h.bits & 0x8000U) << 16U));
+}
+inline f16 encode_f16(f32 x) {
+  u32 f = std::bit_cast<u32>(x);
+  const u32 sign = f & 0x80000000U;
+  f ^= sign;
+  u32 o{};
+  if (f >= 0x47800000U) {
+    // overflow (at least 2^16) to infinity, NaN to a quiet NaN
+    o = (f > 0x7F800000U) ? 0x7E00U : 0x7C00U;
+  } else if (f < 0x38800000U) {
+    // zero/subnormal (below 2^-14): adding 0.5 rounds to a multiple of 2^-24
+    o = std::bit_cast<u32>(std::bit_cast<f32>(f) + 0.5F) - 0x3F000000U;
+  } else {
+    // normal: rebias the exponent and round to nearest-even, which may carry into the exponent
+    const u32 odd = (f >> 13U) & 1U;
+    o = (f + 0xC8000FFFU + odd) >> 13U;
+  }
+  return f16{u16(o | (sign >> 16U))};
+}
+
+// Converts f64 to f32 rounding to odd, i.e. truncating and setting the lowest mantissa bit if
+// the conversion is inexact. Rounding the result to a format with at most 22 mantissa bits is
+// then the same as rounding the f64 value directly, which is not true for round-to-nearest.
+inline f32 round_odd_f32(f64 x) {
+  const f32 y = f32(x);
+  if (std::isnan(x) || f64(y) == x) {
+    return y;
+  }
+  u32 bits = std::bit_cast<u32>(y);
+  if (std::abs(f64(y)) > std::abs(x)) {
+    --bits;
+  }
+  return std::bit_cast<f32>(bits | 1U);
+}
+
+// Conversions between bf16 and f32, which only have to round the mantissa to nearest-even
+// (keeping NaNs quiet, as rounding could turn them into infinities)
+inline f32 decode_bf16(bf16 h) {
+  return std::bit_cast<f32>(u32{h.bits} << 16U);
+}
+inline bf16 encode_bf16(f32 x) {
+  const u32 f = std::bit_cast<u32>(x);
+  if ((f & 0x7FFFFFFFU) > 0x7F800000U) {
+    return bf16{u16((f >> 16U) | 0x40U)};
+  }
+  return bf16{u16((f + 0x7FFFU + ((f >> 16U) & 1U)) >> 16U)};
+}
+
 template<std::size_t tSrcBytes>
 static UnsignedInt<std::bit_ceil(tSrcBytes)> load_multibyte(const std::byte* data,
                                                             IndexTag<tSrcBytes> /*tag*/) {
@@ -88,6 +273,70 @@ static UnsignedInt<std::bit_ceil(tSrcBytes)> load_multibyte(const std::byte* dat
   }
   return output;
 }
+template<std::size_t tSrcBytes>
+static UnsignedInt<std::bit_ceil(tSrcBytes)>
+load_multibyte_big_endian(const std::byte* data, IndexTag<tSrcBytes> /*tag*/) {
+  static constexpr std::size_t dst_bytes = std::bit_ceil(tSrcBytes);
+  static constexpr std::size_t overhead_bits = (dst_bytes - tSrcBytes) * CHAR_BIT;
+  using Dst = UnsignedInt<dst_bytes>;
+
+  // the integer occupies the upper bytes in big-endian order
+  Dst output{};
+  std::memcpy(&output, data, tSrcBytes);
+  if constexpr (std::endian::native == std::endian::little) {
+    output = std::byteswap(output);
+  }
+  if constexpr (overhead_bits == 0) {
+    return output;
+  } else {
+    return output >> overhead_bits;
+  }
+}
+
+template<std::size_t tDstBytes, UnsignedIntVectorizable T>
+requires(tDstBytes <= sizeof(T))
+static void store_multibyte(std::byte* data, T value, IndexTag<tDstBytes> /*tag*/) {
+  const std::byte* bytes = reinterpret_cast<const std::byte*>(&value);
+  if constexpr (std::endian::native == std::endian::big) {
+    bytes += sizeof(T) - tDstBytes;
+  }
+  std::memcpy(data, bytes, tDstBytes);
+}
+
+// The `index`-th unsigned integer with `tBits` bits in a bit-packed sequence starting at the least
+// significant bit of `data[0]`, assembled byte by byte
+template<std::size_t tBits, UnsignedIntVectorizable T>
+requires(tBits <= 32 && tBits <= sizeof(T) * CHAR_BIT)
+static T load_bitpacked(const std::byte* data, std::size_t index, IndexTag<tBits> /*tag*/,
+                        TypeTag<T> /*tag*/) {
+  static constexpr u64 mask = (u64{1} << tBits) - 1U;
+  const std::size_t first = index * tBits;
+  const std::size_t begin = first / CHAR_BIT;
+  const std::size_t end = (first + tBits + CHAR_BIT - 1) / CHAR_BIT;
+
+  u64 window = 0;
+  for (std::size_t i = begin; i < end; ++i) {
+    window |= u64(data[i]) << ((i - begin) * CHAR_BIT);
+  }
+  return T((window >> (first % CHAR_BIT)) & mask);
+}
+// Store the lower `tBits` bits of `value` as the `index`-th integer of a bit-packed sequence,
+// preserving all other bits
+template<std::size_t tBits, UnsignedIntVectorizable T>
+requires(tBits <= 32 && tBits <= sizeof(T) * CHAR_BIT)
+static void store_bitpacked(std::byte* data, std::size_t index, T value, IndexTag<tBits> /*tag*/) {
+  static constexpr u64 mask = (u64{1} << tBits) - 1U;
+  const std::size_t first = index * tBits;
+  const std::size_t begin = first / CHAR_BIT;
+  const std::size_t end = (first + tBits + CHAR_BIT - 1) / CHAR_BIT;
+
+  const u64 bits = (u64{value} & mask) << (first % CHAR_BIT);
+  const u64 keep = ~(mask << (first % CHAR_BIT));
+  for (std::size_t i = begin; i < end; ++i) {
+    const std::size_t shift = (i - begin) * CHAR_BIT;
+    data[i] = std::byte((u64(data[i]) & (keep >> shift)) | (bits >> shift));
+  }
+}
 
 template<std::size_t tIdx, typename THead, typename... TTail>
 GREX_ALWAYS_INLINE inline THead pack_get(THead head, TTail... tail) {
@@ -3,11 +3,15 @@
 
 // IWYU pragma: begin_exports
 #include "operations/arithmetic-mask.hpp"
+#include "operations/arithmetic-narrow.hpp"
+#include "operations/arithmetic-wide.hpp"
+#include "operations/bit-manipulation.hpp"
 #include "operations/blend-static.hpp"
 #include "operations/blend-zero-static.hpp"
 #include "operations/blend.hpp"
 #include "operations/classification.hpp"
 #include "operations/compare.hpp"
+#include "operations/compress.hpp"
 #include "operations/convert.hpp"
 #include "operations/expand.hpp"
 #include "operations/extract.hpp"
@@ -17,17 +21,24 @@
 #include "operations/horizontal-minmax.hpp"
 #include "operations/insert-static.hpp"
 #include "operations/insert.hpp"
+#include "operations/interleave.hpp"
 #include "operations/load.hpp"
+#include "operations/mask-bits.hpp"
 #include "operations/mask-convert.hpp"
+#include "operations/mask-expand.hpp"
 #include "operations/mask-index.hpp"
 #include "operations/multibyte.hpp"
+#include "operations/rotate.hpp"
+#include "operations/scatter.hpp"
 #include "operations/set.hpp"
 #include "operations/shift.hpp"
 #include "operations/shingle.hpp"
 #include "operations/shrink.hpp"
 #include "operations/shuffle-static.hpp"
+#include "operations/sort.hpp"
 #include "operations/store.hpp"
 #include "operations/to-array.hpp"
+#include "operations/transpose.hpp"
 // IWYU pragma: end_exports
 
 #endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HPP
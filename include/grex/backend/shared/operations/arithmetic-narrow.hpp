@@ -0,0 +1,42 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_NARROW_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_NARROW_HPP
+
+#include <cstddef>
+
+#include "grex/backend/active/operations/expand.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// abs_diff changes the value type, which is why GREX_NNVECTOR_BINARY cannot be used
+template<NarrowIntVectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<UnsignedInt<sizeof(T)>, tPart, tSize> abs_diff(SubVector<T, tPart, tSize> a,
+                                                                SubVector<T, tPart, tSize> b) {
+  return SubVector<UnsignedInt<sizeof(T)>, tPart, tSize>{abs_diff(a.full, b.full)};
+}
+template<typename THalf>
+inline auto abs_diff(SuperVector<THalf> a, SuperVector<THalf> b) {
+  using Half = decltype(abs_diff(a.lower, b.lower));
+  return SuperVector<Half>{.lower = abs_diff(a.lower, b.lower),
+                           .upper = abs_diff(a.upper, b.upper)};
+}
+
+// Sub-native: Zero the lanes above the part, whose absolute differences are thus zero
+template<NarrowIntVectorizable T, std::size_t tPart, std::size_t tSize>
+inline u64 sum_abs_diff(SubVector<T, tPart, tSize> a, SubVector<T, tPart, tSize> b) {
+  return sum_abs_diff(expand_zero(a, index_tag<tSize>), expand_zero(b, index_tag<tSize>));
+}
+// Super-native: Add the sums of the two halves
+template<typename THalf>
+inline u64 sum_abs_diff(SuperVector<THalf> a, SuperVector<THalf> b) {
+  return sum_abs_diff(a.lower, b.lower) + sum_abs_diff(a.upper, b.upper);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_NARROW_HPP
@@ -0,0 +1,51 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_WIDE_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_WIDE_HPP
+
+#include <cstddef>
+
+#include "grex/backend/active/operations/merge.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/choosers.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Sub-native: The products of the part fit into the lower half
+template<WidenableIntVectorizable T, std::size_t tPart, std::size_t tSize>
+inline VectorFor<WideInt<T>, tPart> multiply_wide(SubVector<T, tPart, tSize> a,
+                                                  SubVector<T, tPart, tSize> b) {
+  const auto lower = multiply_wide_lower(a.full, b.full);
+  if constexpr (2 * tPart == tSize) {
+    return lower;
+  } else {
+    return VectorFor<WideInt<T>, tPart>{lower};
+  }
+}
+// Super-native: Merge the products of the two halves
+template<typename THalf>
+inline auto multiply_wide(SuperVector<THalf> a, SuperVector<THalf> b) {
+  return merge(multiply_wide(a.lower, b.lower), multiply_wide(a.upper, b.upper));
+}
+
+template<WidenableIntVectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<WideInt<T>, tPart / 2, tSize / 2>
+multiply_add_pairs(SubVector<T, tPart, tSize> a, SubVector<T, tPart, tSize> b) {
+  return SubVector<WideInt<T>, tPart / 2, tSize / 2>{multiply_add_pairs(a.full, b.full)};
+}
+template<std::size_t tPart, std::size_t tSize>
+inline SubVector<i16, tPart / 2, tSize / 2> multiply_add_pairs(SubVector<u8, tPart, tSize> a,
+                                                               SubVector<i8, tPart, tSize> b) {
+  return SubVector<i16, tPart / 2, tSize / 2>{multiply_add_pairs(a.full, b.full)};
+}
+template<typename THalfA, typename THalfB>
+inline auto multiply_add_pairs(SuperVector<THalfA> a, SuperVector<THalfB> b) {
+  return merge(multiply_add_pairs(a.lower, b.lower), multiply_add_pairs(a.upper, b.upper));
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ARITHMETIC_WIDE_HPP
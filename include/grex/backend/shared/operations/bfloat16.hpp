@@ -0,0 +1,166 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BFLOAT16_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BFLOAT16_HPP
+
+#include <concepts>
+#include <cstddef>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/bitwise.hpp"
+#include "grex/backend/active/operations/blend.hpp"
+#include "grex/backend/active/operations/compare.hpp"
+#include "grex/backend/active/operations/convert.hpp"
+#include "grex/backend/active/operations/fmadd-family.hpp"
+#include "grex/backend/active/operations/reinterpret.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shift.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/shared/operations/half.hpp"
+#include "grex/base.hpp"
+
+// bfloat16 values are the upper halves of f32 values, so they are loaded as u16 vectors which are
+// widened and shifted into place, while storing rounds the lower half away using the integer
+// operations of the scalar `encode_bf16` (hardware conversions flush subnormals to zero).
+// f64 is converted via f32, which is exact for bf16 → f64 and rounds correctly for f64 → bf16
+// since the conversion from f64 to f32 rounds to odd (as for half-precision values).
+//
+// `dot_accumulate` operates on u32 vectors, each lane of which contains a pair of bfloat16 values
+// with the first one in the lower half. Backends provide overloads for native vectors if there
+// is hardware support.
+
+namespace grex::backend {
+template<AnyVector TBits, FloatVector TVec>
+requires(std::same_as<ValueOf<TBits>, u16> && TBits::size == TVec::size)
+inline TVec decode_bf16(TBits bits, TypeTag<TVec> /*tag*/) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (std::same_as<Value, f64>) {
+    return convert(decode_bf16(bits, type_tag<VectorFor<f32, size>>), type_tag<f64>);
+  } else {
+    return as<f32>(shift_left(convert(bits, type_tag<u32>), index_tag<16>));
+  }
+}
+
+template<FloatVector TVec>
+inline VectorFor<u16, TVec::size> encode_bf16(TVec v) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (std::same_as<Value, f64>) {
+    return encode_bf16(round_odd_f32(v));
+  } else {
+    using Int = VectorFor<u32, size>;
+    static constexpr TypeTag<Int> itag{};
+    const Int f = as<u32>(v);
+    // round to nearest-even, which may carry into the exponent and overflow to infinity
+    const Int odd = bitwise_and(shift_right(f, index_tag<16>), broadcast(u32{1}, itag));
+    const Int rounded = add(add(f, broadcast(u32{0x7FFFU}, itag)), odd);
+    // NaN: truncate and set the quiet bit
+    const Int nan = bitwise_or(f, broadcast(u32{0x400000U}, itag));
+    const auto is_nan = compare_lt(broadcast(u32{0x7F800000U}, itag),
+                                   bitwise_and(f, broadcast(u32{0x7FFFFFFFU}, itag)));
+    return convert(shift_right(blend(is_nan, rounded, nan), index_tag<16>), type_tag<u16>);
+  }
+}
+
+template<FloatVector TVec>
+inline TVec load_bf16(const bf16* ptr, TypeTag<TVec> tag) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    return {
+      .lower = load_bf16(ptr, type_tag<Half>),
+      .upper = load_bf16(ptr + Half::size, type_tag<Half>),
+    };
+  } else {
+    using Bits = VectorFor<u16, TVec::size>;
+    return decode_bf16(load(reinterpret_cast<const u16*>(ptr), type_tag<Bits>), tag);
+  }
+}
+template<FloatVector TVec>
+inline TVec load_part_bf16(const bf16* ptr, std::size_t size, TypeTag<TVec> tag) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    if (size <= Half::size) {
+      return {
+        .lower = load_part_bf16(ptr, size, type_tag<Half>),
+        .upper = undefined(type_tag<Half>),
+      };
+    }
+    return {
+      .lower = load_bf16(ptr, type_tag<Half>),
+      .upper = load_part_bf16(ptr + Half::size, size - Half::size, type_tag<Half>),
+    };
+  } else {
+    using Bits = VectorFor<u16, TVec::size>;
+    return decode_bf16(load_part(reinterpret_cast<const u16*>(ptr), size, type_tag<Bits>), tag);
+  }
+}
+
+template<FloatVector TVec>
+inline void store_bf16(bf16* ptr, TVec v) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    store_bf16(ptr, v.lower);
+    store_bf16(ptr + decltype(v.lower)::size, v.upper);
+  } else {
+    store(reinterpret_cast<u16*>(ptr), encode_bf16(v));
+  }
+}
+template<FloatVector TVec>
+inline void store_part_bf16(bf16* ptr, TVec v, std::size_t size) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    if (size <= Half::size) {
+      store_part_bf16(ptr, v.lower, size);
+      return;
+    }
+    store_bf16(ptr, v.lower);
+    store_part_bf16(ptr + Half::size, v.upper, size - Half::size);
+  } else {
+    store_part(reinterpret_cast<u16*>(ptr), encode_bf16(v), size);
+  }
+}
+
+// Emulated dot products: Both products are exact in f32 and are accumulated using fmadd
+template<AnyVector TPairs, FloatVector TVec>
+requires(std::same_as<ValueOf<TPairs>, u32> && std::same_as<ValueOf<TVec>, f32> &&
+         TPairs::size == TVec::size)
+inline TVec dot_accumulate(TPairs a, TPairs b, TVec acc) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    return {
+      .lower = dot_accumulate(a.lower, b.lower, acc.lower),
+      .upper = dot_accumulate(a.upper, b.upper, acc.upper),
+    };
+  } else if constexpr (AnySubNativeVector<TVec>) {
+    return TVec{dot_accumulate(a.full, b.full, acc.full)};
+  } else {
+    const TPairs high = broadcast(u32{0xFFFF0000U}, type_tag<TPairs>);
+    const TVec a0 = as<f32>(shift_left(a, index_tag<16>));
+    const TVec b0 = as<f32>(shift_left(b, index_tag<16>));
+    acc = fmadd(a0, b0, acc);
+    return fmadd(as<f32>(bitwise_and(a, high)), as<f32>(bitwise_and(b, high)), acc);
+  }
+}
+
+// Dot products of pairs loaded from memory, where `size` is the number of pairs
+template<FloatVector TVec>
+inline TVec dot_accumulate_bf16(const bf16* a, const bf16* b, TVec acc) {
+  static constexpr TypeTag<VectorFor<u32, TVec::size>> pairs_tag{};
+  const auto* a_pairs = reinterpret_cast<const u32*>(a);
+  const auto* b_pairs = reinterpret_cast<const u32*>(b);
+  return dot_accumulate(load(a_pairs, pairs_tag), load(b_pairs, pairs_tag), acc);
+}
+template<FloatVector TVec>
+inline TVec dot_accumulate_part_bf16(const bf16* a, const bf16* b, TVec acc, std::size_t size) {
+  static constexpr TypeTag<VectorFor<u32, TVec::size>> pairs_tag{};
+  const auto* a_pairs = reinterpret_cast<const u32*>(a);
+  const auto* b_pairs = reinterpret_cast<const u32*>(b);
+  return dot_accumulate(load_part(a_pairs, size, pairs_tag), load_part(b_pairs, size, pairs_tag),
+                        acc);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BFLOAT16_HPP
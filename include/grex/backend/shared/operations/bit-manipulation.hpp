@@ -0,0 +1,47 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BIT_MANIPULATION_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BIT_MANIPULATION_HPP
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/bitwise.hpp"
+#include "grex/backend/active/operations/reinterpret.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shift.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Fallbacks for the zero counts without native instructions, based on the population count
+// Leading zeros: Propagate the highest set bit to all lower bits, which leaves the leading zeros
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> countl_zero(NativeVector<T, tSize> v) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  auto smeared = as<Unsigned>(v);
+  static_apply<std::bit_width(bits - 1)>([&]<std::size_t... tIdxs>() {
+    (..., (smeared = bitwise_or(smeared, shift_right(smeared, index_tag<1U << tIdxs>))));
+  });
+  return as<T>(popcount(bitwise_not(smeared)));
+}
+// Trailing zeros: The set bits of (v - 1) & ~v are exactly the trailing zeros of v
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> countr_zero(NativeVector<T, tSize> v) {
+  const auto ones = broadcast(T{1}, type_tag<NativeVector<T, tSize>>);
+  return popcount(bitwise_and(subtract(v, ones), bitwise_not(v)));
+}
+
+GREX_NNVECTOR_UNARY(countl_zero)
+GREX_NNVECTOR_UNARY(countr_zero)
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BIT_MANIPULATION_HPP
@@ -0,0 +1,269 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BITPACKED_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BITPACKED_HPP
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/bitwise.hpp"
+#include "grex/backend/active/operations/merge.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shift.hpp"
+#include "grex/backend/active/operations/split.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+// Load and store unsigned integers consisting of B bits each, which are stored contiguously
+// starting at the least significant bit of the first byte, i.e. value `i` occupies the bits
+// `[F + i·B, F + (i + 1)·B)` when counting from the least significant bit of `ptr[0]` upwards,
+// where F is the offset of the first bit (below 8).
+// Each lane is decoded from the bytes starting at the byte containing its first bit, which are
+// gathered using a byte shuffle (the “window” of the lane) and shifted by the position of the first
+// bit within that byte. Encoding reverses this: The shifted values are scattered to their bytes,
+// where lanes sharing a byte are handled by separate shuffles that are combined.
+// As for multibyte integers, the underlying memory is assumed to be padded at the end by the
+// number of bytes in the largest supported SIMD register when loading.
+
+namespace grex::backend {
+namespace bp {
+template<std::size_t tBits, std::size_t tFirst>
+inline constexpr std::size_t first_byte(std::size_t lane) {
+  return (tFirst + lane * tBits) / CHAR_BIT;
+}
+template<std::size_t tBits, std::size_t tFirst>
+inline constexpr std::size_t last_byte(std::size_t lane) {
+  return (tFirst + (lane + 1) * tBits - 1) / CHAR_BIT;
+}
+template<std::size_t tBits, std::size_t tFirst>
+inline constexpr std::size_t bit_shift(std::size_t lane) {
+  return (tFirst + lane * tBits) % CHAR_BIT;
+}
+// The number of bytes touched by `tSize` values
+template<std::size_t tBits, std::size_t tFirst, std::size_t tSize>
+inline constexpr std::size_t byte_count = (tFirst + tSize * tBits + CHAR_BIT - 1) / CHAR_BIT;
+
+// Whether any of the first `tSize` lanes extends beyond its `tValue`-byte window
+template<std::size_t tValue, std::size_t tBits, std::size_t tFirst, std::size_t tSize>
+inline constexpr bool needs_high = static_apply<tSize>([]<std::size_t... tIdxs>() {
+  return (... || (bit_shift<tBits, tFirst>(tIdxs) + tBits > tValue * CHAR_BIT));
+});
+// Whether any of the first `tSize` lanes does not start at a byte boundary
+template<std::size_t tBits, std::size_t tFirst, std::size_t tSize>
+inline constexpr bool needs_shift = static_apply<tSize>([]<std::size_t... tIdxs>() {
+  return (... || (bit_shift<tBits, tFirst>(tIdxs) != 0));
+});
+
+// The shifts of the lanes from their windows and the complementary shifts of the high windows
+template<typename T, std::size_t tBits, std::size_t tFirst, std::size_t tSize>
+inline constexpr auto shifts = static_apply<tSize>([]<std::size_t... tIdxs>() {
+  return std::array{T(bit_shift<tBits, tFirst>(tIdxs))...};
+});
+template<typename T, std::size_t tBits, std::size_t tFirst, std::size_t tSize>
+inline constexpr auto high_shifts = static_apply<tSize>([]<std::size_t... tIdxs>() {
+  return std::array{T(CHAR_BIT - bit_shift<tBits, tFirst>(tIdxs))...};
+});
+
+// Byte shuffle indices which gather the window of each `tValue`-byte lane in a 128-bit register
+template<std::size_t tValue, std::size_t tBits, std::size_t tFirst>
+requires(tFirst < CHAR_BIT)
+inline constexpr auto window_indices_128 = static_apply<16>([]<std::size_t... tIdxs>() {
+  auto op = [](std::size_t i) { return i8(first_byte<tBits, tFirst>(i / tValue) + i % tValue); };
+  return std::array{op(tIdxs)...};
+});
+
+// The smallest number of lane groups such that the lanes within each group, which are `tGroups`
+// apart, do not share any bytes
+template<std::size_t tBits, std::size_t tFirst, std::size_t tPart>
+inline constexpr std::size_t group_count = [] {
+  std::size_t groups = 1;
+  for (std::size_t l = 0; l + groups < tPart; ++l) {
+    if (last_byte<tBits, tFirst>(l) >= first_byte<tBits, tFirst>(l + groups)) {
+      ++groups;
+      l = std::size_t(-1);
+    }
+  }
+  return groups;
+}();
+
+// Byte shuffle indices which scatter the (shifted) windows of the lanes in group `tGroup`
+// to the bytes of the output
+template<std::size_t tValue, std::size_t tBits, std::size_t tFirst, std::size_t tPart,
+         std::size_t tGroups, std::size_t tGroup>
+inline constexpr auto scatter_indices_128 = static_apply<16>([]<std::size_t... tIdxs>() {
+  auto op = [](std::size_t p) {
+    for (std::size_t l = tGroup; l < tPart; l += tGroups) {
+      const std::size_t first = first_byte<tBits, tFirst>(l);
+      if (first <= p && p <= last_byte<tBits, tFirst>(l) && p - first < tValue) {
+        return i8(tValue * l + p - first);
+      }
+    }
+    return i8(-1);
+  };
+  return std::array{op(tIdxs)...};
+});
+// Byte shuffle indices which scatter the high windows of the lanes to their last byte
+// if that lies beyond their window
+template<std::size_t tValue, std::size_t tBits, std::size_t tFirst, std::size_t tPart>
+inline constexpr auto high_indices_128 = static_apply<16>([]<std::size_t... tIdxs>() {
+  auto op = [](std::size_t p) {
+    for (std::size_t l = 0; l < tPart; ++l) {
+      const std::size_t last = last_byte<tBits, tFirst>(l);
+      if (last == first_byte<tBits, tFirst>(l) + tValue && p == last) {
+        return i8(tValue * l + tValue - 1);
+      }
+    }
+    return i8(-1);
+  };
+  return std::array{op(tIdxs)...};
+});
+} // namespace bp
+
+// The window of each lane, i.e. the `sizeof(Value)` bytes starting at the byte which contains
+// its first bit, using the backend-specific 128-bit shuffle if there is one
+template<std::size_t tBits, std::size_t tFirst, AnyVector TVec>
+inline TVec bitpacked_windows(const u8* ptr, IndexTag<tBits> bits, IndexTag<tFirst> first,
+                              TypeTag<TVec> tag) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    static constexpr std::size_t upper = tFirst + Half::size * tBits;
+    return {
+      .lower = bitpacked_windows(ptr, bits, first, type_tag<Half>),
+      .upper = bitpacked_windows(ptr + upper / CHAR_BIT, bits, index_tag<upper % CHAR_BIT>,
+                                 type_tag<Half>),
+    };
+  } else if constexpr (AnySubNativeVector<TVec>) {
+    using Full = decltype(TVec::full);
+    return TVec{bitpacked_windows(ptr, bits, first, type_tag<Full>)};
+  } else if constexpr (sizeof(Value) * size > 16) {
+    using Half = VectorFor<Value, size / 2>;
+    static constexpr std::size_t upper = tFirst + Half::size * tBits;
+    return merge(bitpacked_windows(ptr, bits, first, type_tag<Half>),
+                 bitpacked_windows(ptr + upper / CHAR_BIT, bits, index_tag<upper % CHAR_BIT>,
+                                   type_tag<Half>));
+  } else if constexpr (requires { bitpacked_windows_128(ptr, bits, first, tag); }) {
+    return bitpacked_windows_128(ptr, bits, first, tag);
+  } else {
+    // fallback: load each window separately
+    const auto windows = static_apply<size>([&]<std::size_t... tIdxs>() {
+      auto op = [&](std::size_t lane) {
+        Value window{};
+        std::memcpy(&window, ptr + bp::first_byte<tBits, tFirst>(lane), sizeof(Value));
+        return window;
+      };
+      return std::array{op(tIdxs)...};
+    });
+    return load(windows.data(), tag);
+  }
+}
+
+template<std::size_t tBits, std::size_t tFirst, AnyVector TVec>
+requires(tFirst < CHAR_BIT)
+inline TVec load_bitpacked(const u8* ptr, IndexTag<tBits> bits, IndexTag<tFirst> first,
+                           TypeTag<TVec> tag) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  TVec out = bitpacked_windows(ptr, bits, first, tag);
+  if constexpr (bp::needs_shift<tBits, tFirst, size>) {
+    static constexpr auto shifts = bp::shifts<Value, tBits, tFirst, size>;
+    out = shift_right(out, load(shifts.data(), tag));
+  }
+  if constexpr (bp::needs_high<sizeof(Value), tBits, tFirst, size>) {
+    // the bits beyond the window are at the bottom of the window starting one byte later
+    static constexpr auto high_shifts = bp::high_shifts<Value, tBits, tFirst, size>;
+    const TVec high = bitpacked_windows(ptr + 1, bits, first, tag);
+    out = bitwise_or(out, shift_left(high, load(high_shifts.data(), tag)));
+  }
+  if constexpr (tBits < sizeof(Value) * CHAR_BIT) {
+    out = bitwise_and(out, broadcast(Value((Value{1} << tBits) - 1U), tag));
+  }
+  return out;
+}
+
+// Scatter the shifted windows of the first `tPart` lanes of a 128-bit register, using the
+// backend-specific shuffles if there are any
+template<std::size_t tBits, std::size_t tFirst, std::size_t tPart, AnyVector TVec, bool tHigh>
+inline void bitpacked_scatter(u8* ptr, TVec low, TVec high, IndexTag<tBits> bits,
+                              IndexTag<tFirst> first, IndexTag<tPart> part,
+                              BoolTag<tHigh> has_high) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    static constexpr std::size_t upper = tFirst + Half::size * tBits;
+    bitpacked_scatter(ptr, low.lower, high.lower, bits, first, index_tag<Half::size>, has_high);
+    bitpacked_scatter(ptr + upper / CHAR_BIT, low.upper, high.upper, bits,
+                      index_tag<upper % CHAR_BIT>, index_tag<Half::size>, has_high);
+  } else if constexpr (AnySubNativeVector<TVec>) {
+    bitpacked_scatter(ptr, low.full, high.full, bits, first, part, has_high);
+  } else if constexpr (sizeof(Value) * size > 16) {
+    static constexpr std::size_t half = size / 2;
+    static constexpr std::size_t upper = tFirst + half * tBits;
+    bitpacked_scatter(ptr, get_low(low), get_low(high), bits, first, index_tag<half>, has_high);
+    bitpacked_scatter(ptr + upper / CHAR_BIT, get_high(low), get_high(high), bits,
+                      index_tag<upper % CHAR_BIT>, index_tag<half>, has_high);
+  } else if constexpr (requires { store_bitpacked_128(ptr, low, high, bits, first, part,
+                                                      has_high); }) {
+    store_bitpacked_128(ptr, low, high, bits, first, part, has_high);
+  } else {
+    // fallback: combine the bytes in a buffer, keeping the bits before the first value
+    static constexpr std::size_t bytes = bp::byte_count<tBits, tFirst, tPart>;
+    std::array<Value, size> lows{};
+    std::array<Value, size> highs{};
+    store(lows.data(), low);
+    if constexpr (tHigh) {
+      store(highs.data(), high);
+    }
+    std::array<u8, bytes> buffer{};
+    buffer[0] = u8(ptr[0] & ((1U << tFirst) - 1U));
+    for (std::size_t l = 0; l < tPart; ++l) {
+      const std::size_t first_byte = bp::first_byte<tBits, tFirst>(l);
+      for (std::size_t p = first_byte; p <= bp::last_byte<tBits, tFirst>(l); ++p) {
+        const std::size_t j = p - first_byte;
+        buffer[p] |= (j < sizeof(Value)) ? u8(lows[l] >> (j * CHAR_BIT))
+                                         : u8(highs[l] >> ((sizeof(Value) - 1) * CHAR_BIT));
+      }
+    }
+    std::memcpy(ptr, buffer.data(), bytes);
+  }
+}
+
+// Store the lower `tBits` bits of each lane contiguously, starting at bit `tFirst` of `ptr[0]`,
+// whose lower bits are preserved. The remaining upper bits of the last byte are cleared.
+template<std::size_t tBits, std::size_t tFirst, AnyVector TVec>
+requires(tFirst < CHAR_BIT)
+inline void store_bitpacked(u8* ptr, TVec v, IndexTag<tBits> bits, IndexTag<tFirst> first) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  static constexpr TypeTag<TVec> tag{};
+  static constexpr bool has_high = bp::needs_high<sizeof(Value), tBits, tFirst, size>;
+
+  TVec masked = v;
+  if constexpr (tBits < sizeof(Value) * CHAR_BIT) {
+    masked = bitwise_and(v, broadcast(Value((Value{1} << tBits) - 1U), tag));
+  }
+  TVec low = masked;
+  if constexpr (bp::needs_shift<tBits, tFirst, size>) {
+    static constexpr auto shifts = bp::shifts<Value, tBits, tFirst, size>;
+    low = shift_left(masked, load(shifts.data(), tag));
+  }
+  TVec high = low;
+  if constexpr (has_high) {
+    // the bits shifted out of the window, which belong to the byte after it
+    static constexpr auto high_shifts = bp::high_shifts<Value, tBits, tFirst, size>;
+    high = shift_right(masked, load(high_shifts.data(), tag));
+  }
+  bitpacked_scatter(ptr, low, high, bits, first, index_tag<size>, bool_tag<has_high>);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_BITPACKED_HPP
@@ -33,7 +33,7 @@ inline TVec make_finite(TVec v) {
 template<FloatVectorizable T>
 inline Scalar<T> make_finite(Scalar<T> v) {
   const auto vec = expand_any(v, index_tag<16 / sizeof(T)>);
-  return extract_single(blend_zero(is_finite(vec), vec));
+  return Scalar<T>{extract_single(blend_zero(is_finite(vec), vec))};
 }
 } // namespace grex::backend
 
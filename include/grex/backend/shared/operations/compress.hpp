@@ -0,0 +1,110 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_COMPRESS_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_COMPRESS_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// For each bit mask with `tLanes` bits, the byte indices of the selected lanes
+// (each consisting of `tLaneBytes` bytes) in ascending order, padded with 0x80.
+// Both the x86-64 and the ARM64 byte shuffles turn the padding into zeros.
+template<std::size_t tLanes, std::size_t tLaneBytes>
+inline constexpr auto compress_table = [] {
+  std::array<std::array<u8, tLanes * tLaneBytes>, std::size_t{1} << tLanes> table{};
+  for (std::size_t bits = 0; bits < table.size(); ++bits) {
+    auto& entry = table[bits];
+    entry.fill(0x80);
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < tLanes; ++i) {
+      if (((bits >> i) & 1U) == 0) {
+        continue;
+      }
+      for (std::size_t k = 0; k < tLaneBytes; ++k) {
+        entry[j++] = u8(i * tLaneBytes + k);
+      }
+    }
+  }
+  return table;
+}();
+
+// Fallback: Copy the selected lanes one at a time
+template<AnyMask TMask, AnyVector TVec>
+inline std::size_t compress_store_fallback(typename TVec::Value* dst, TMask m, TVec v) {
+  const auto selected = to_array(m);
+  const auto values = to_array(v);
+  std::size_t j = 0;
+  for (std::size_t i = 0; i < TVec::size; ++i) {
+    if (selected[i]) {
+      dst[j++] = values[i];
+    }
+  }
+  return j;
+}
+template<AnyMask TMask, AnyVector TVec>
+inline TVec compress_fallback(TMask m, TVec v) {
+  std::array<typename TVec::Value, TVec::size> buf{};
+  compress_store_fallback(buf.data(), m, v);
+  return load(buf.data(), type_tag<TVec>);
+}
+
+// Split: Compress both halves separately and put the upper result right behind the lower one
+template<AnyMask TMask, AnyVector TVec>
+inline std::size_t compress_store_split(typename TVec::Value* dst, TMask m, TVec v) {
+  const std::size_t num = compress_store(dst, get_low(m), get_low(v));
+  return num + compress_store(dst + num, get_high(m), get_high(v));
+}
+template<AnyMask TMask, AnyVector TVec>
+inline TVec compress_split(TMask m, TVec v) {
+  // the upper half is stored at an offset of at most half the size → everything fits into `buf`
+  std::array<typename TVec::Value, TVec::size> buf{};
+  const auto m0 = get_low(m);
+  store(buf.data(), compress(m0, get_low(v)));
+  store(buf.data() + std::popcount(to_bits(m0)), compress(get_high(m), get_high(v)));
+  return load(buf.data(), type_tag<TVec>);
+}
+
+// Native vectors: Store only the selected lanes of the compressed vector
+template<Vectorizable T, std::size_t tSize>
+inline std::size_t compress_store(T* dst, NativeMask<T, tSize> m, NativeVector<T, tSize> v) {
+  const auto num = std::size_t(std::popcount(to_bits(m)));
+  store_part(dst, compress(m, v), num);
+  return num;
+}
+
+// Sub-native vectors: Ignore the lanes beyond the part
+template<Vectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<T, tPart, tSize> compress(SubMask<T, tPart, tSize> m,
+                                           SubVector<T, tPart, tSize> v) {
+  const auto cutoff = cutoff_mask(tPart, type_tag<NativeMask<T, tSize>>);
+  return SubVector<T, tPart, tSize>{compress(logical_and(m.full, cutoff), v.full)};
+}
+template<Vectorizable T, std::size_t tPart, std::size_t tSize>
+inline std::size_t compress_store(T* dst, SubMask<T, tPart, tSize> m,
+                                  SubVector<T, tPart, tSize> v) {
+  const auto cutoff = cutoff_mask(tPart, type_tag<NativeMask<T, tSize>>);
+  return compress_store(dst, logical_and(m.full, cutoff), v.full);
+}
+
+// Super-native vectors: Split
+template<AnyMask TMaskHalf, AnyVector THalf>
+inline SuperVector<THalf> compress(SuperMask<TMaskHalf> m, SuperVector<THalf> v) {
+  return compress_split(m, v);
+}
+template<AnyMask TMaskHalf, AnyVector THalf>
+inline std::size_t compress_store(typename THalf::Value* dst, SuperMask<TMaskHalf> m,
+                                  SuperVector<THalf> v) {
+  return compress_store_split(dst, m, v);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_COMPRESS_HPP
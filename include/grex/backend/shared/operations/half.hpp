@@ -0,0 +1,177 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HALF_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HALF_HPP
+
+#include <concepts>
+#include <cstddef>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/bitwise.hpp"
+#include "grex/backend/active/operations/blend.hpp"
+#include "grex/backend/active/operations/compare.hpp"
+#include "grex/backend/active/operations/convert.hpp"
+#include "grex/backend/active/operations/reinterpret.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shift.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+// Half-precision values are loaded as u16 vectors of the same size and converted to f32/f64,
+// or converted to u16 vectors and then stored.
+// Backends provide hardware conversions between native f32/f64 vectors and u16 vectors through
+// `from_f16_bits` and `to_f16_bits`, which are also used for sub-native vectors by widening them
+// to the full register. Without a hardware conversion, f64 is converted via f32, which is exact
+// for f16 → f64 and rounds correctly for f64 → f16 if the conversion to f32 rounds to odd
+// (see the scalar `round_odd_f32`). The remaining f32 conversions use the integer operations
+// of the scalar `decode_f16`/`encode_f16`, with blends instead of branches.
+
+namespace grex::backend {
+template<FloatVector TVec>
+requires(std::same_as<ValueOf<TVec>, f64>)
+inline VectorFor<f32, TVec::size> round_odd_f32(TVec v) {
+  using Wide = VectorFor<i64, TVec::size>;
+  static constexpr TypeTag<Wide> wtag{};
+  const auto y = convert(v, type_tag<f32>);
+  // the absolute values are ordered like their bits as long as they are not NaN,
+  // for which the result is still NaN
+  const Wide abs_mask = broadcast(i64{0x7FFF'FFFF'FFFF'FFFF}, wtag);
+  const Wide ax = bitwise_and(as<i64>(v), abs_mask);
+  const Wide ay = bitwise_and(as<i64>(convert(y, type_tag<f64>)), abs_mask);
+  const Wide one = broadcast(i64{1}, wtag);
+  const auto away = convert(blend(compare_lt(ax, ay), zeros(wtag), one), type_tag<u32>);
+  const auto inexact = convert(blend(compare_eq(ax, ay), one, zeros(wtag)), type_tag<u32>);
+  return as<f32>(bitwise_or(subtract(as<u32>(y), away), inexact));
+}
+
+template<AnyVector TBits, FloatVector TVec>
+requires(std::same_as<ValueOf<TBits>, u16> && TBits::size == TVec::size)
+inline TVec decode_f16(TBits bits, TypeTag<TVec> tag) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (requires { from_f16_bits(bits, tag); }) {
+    return from_f16_bits(bits, tag);
+  } else if constexpr (AnySubNativeVector<TVec> &&
+                       requires(VectorFor<u16, TVec::Full::size> full) {
+                         from_f16_bits(full, type_tag<typename TVec::Full>);
+                       }) {
+    using Full = TVec::Full;
+    const auto full = VectorFor<u16, Full::size>{bits.registr()};
+    return TVec{from_f16_bits(full, type_tag<Full>)};
+  } else if constexpr (std::same_as<Value, f64>) {
+    return convert(decode_f16(bits, type_tag<VectorFor<f32, size>>), type_tag<f64>);
+  } else {
+    using Int = VectorFor<u32, size>;
+    static constexpr TypeTag<Int> itag{};
+    static constexpr u32 shifted_exp = 0x7C00U << 13U;
+    const Int h = convert(bits, type_tag<u32>);
+    Int o = shift_left(bitwise_and(h, broadcast(u32{0x7FFFU}, itag)), index_tag<13>);
+    const Int exp = bitwise_and(o, broadcast(shifted_exp, itag));
+    o = add(o, broadcast(u32{(127U - 15U) << 23U}, itag));
+    // infinity/NaN: move the exponent to the top
+    const Int infnan = add(o, broadcast(u32{(128U - 16U) << 23U}, itag));
+    o = blend(compare_eq(exp, broadcast(shifted_exp, itag)), o, infnan);
+    // zero/subnormal: renormalize by subtracting the implicit leading one
+    const TVec renorm = subtract(as<f32>(add(o, broadcast(u32{1U << 23U}, itag))),
+                                 broadcast(0x1p-14F, tag));
+    o = blend(compare_eq(exp, zeros(itag)), o, as<u32>(renorm));
+    const Int sign = shift_left(bitwise_and(h, broadcast(u32{0x8000U}, itag)), index_tag<16>);
+    return as<f32>(bitwise_or(o, sign));
+  }
+}
+
+template<FloatVector TVec>
+inline VectorFor<u16, TVec::size> encode_f16(TVec v) {
+  using Value = TVec::Value;
+  using Bits = VectorFor<u16, TVec::size>;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (requires { to_f16_bits(v); }) {
+    return to_f16_bits(v);
+  } else if constexpr (AnySubNativeVector<TVec> && requires { to_f16_bits(v.full); }) {
+    return Bits{to_f16_bits(v.full).registr()};
+  } else if constexpr (std::same_as<Value, f64>) {
+    return encode_f16(round_odd_f32(v));
+  } else {
+    using Int = VectorFor<u32, size>;
+    static constexpr TypeTag<Int> itag{};
+    Int f = as<u32>(v);
+    const Int sign = bitwise_and(f, broadcast(u32{0x80000000U}, itag));
+    f = bitwise_xor(f, sign);
+    // normal: rebias the exponent and round to nearest-even, which may carry into the exponent
+    const Int odd = bitwise_and(shift_right(f, index_tag<13>), broadcast(u32{1}, itag));
+    Int o = shift_right(add(add(f, broadcast(u32{0xC8000FFFU}, itag)), odd), index_tag<13>);
+    // zero/subnormal (below 2^-14): adding 0.5 rounds to a multiple of 2^-24
+    const Int sub = subtract(as<u32>(add(as<f32>(f), broadcast(0.5F, type_tag<TVec>))),
+                             broadcast(u32{0x3F000000U}, itag));
+    o = blend(compare_lt(f, broadcast(u32{0x38800000U}, itag)), o, sub);
+    // overflow (at least 2^16) to infinity, NaN to a quiet NaN
+    const Int inf = blend(compare_lt(broadcast(u32{0x7F800000U}, itag), f),
+                          broadcast(u32{0x7C00U}, itag), broadcast(u32{0x7E00U}, itag));
+    o = blend(compare_ge(f, broadcast(u32{0x47800000U}, itag)), o, inf);
+    return convert(bitwise_or(o, shift_right(sign, index_tag<16>)), type_tag<u16>);
+  }
+}
+
+template<FloatVector TVec>
+inline TVec load_f16(const f16* ptr, TypeTag<TVec> tag) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    return {
+      .lower = load_f16(ptr, type_tag<Half>),
+      .upper = load_f16(ptr + Half::size, type_tag<Half>),
+    };
+  } else {
+    using Bits = VectorFor<u16, TVec::size>;
+    return decode_f16(load(reinterpret_cast<const u16*>(ptr), type_tag<Bits>), tag);
+  }
+}
+template<FloatVector TVec>
+inline TVec load_part_f16(const f16* ptr, std::size_t size, TypeTag<TVec> tag) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    if (size <= Half::size) {
+      return {
+        .lower = load_part_f16(ptr, size, type_tag<Half>),
+        .upper = undefined(type_tag<Half>),
+      };
+    }
+    return {
+      .lower = load_f16(ptr, type_tag<Half>),
+      .upper = load_part_f16(ptr + Half::size, size - Half::size, type_tag<Half>),
+    };
+  } else {
+    using Bits = VectorFor<u16, TVec::size>;
+    return decode_f16(load_part(reinterpret_cast<const u16*>(ptr), size, type_tag<Bits>), tag);
+  }
+}
+
+template<FloatVector TVec>
+inline void store_f16(f16* ptr, TVec v) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    store_f16(ptr, v.lower);
+    store_f16(ptr + decltype(v.lower)::size, v.upper);
+  } else {
+    store(reinterpret_cast<u16*>(ptr), encode_f16(v));
+  }
+}
+template<FloatVector TVec>
+inline void store_part_f16(f16* ptr, TVec v, std::size_t size) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    if (size <= Half::size) {
+      store_part_f16(ptr, v.lower, size);
+      return;
+    }
+    store_f16(ptr, v.lower);
+    store_part_f16(ptr + Half::size, v.upper, size - Half::size);
+  } else {
+    store_part(reinterpret_cast<u16*>(ptr), encode_f16(v), size);
+  }
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HALF_HPP
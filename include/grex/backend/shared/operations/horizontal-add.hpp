@@ -7,8 +7,18 @@
 #ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_ADD_HPP
 #define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_ADD_HPP
 
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
 #include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/fmadd-family.hpp"
+#include "grex/backend/active/operations/merge.hpp"
+#include "grex/backend/active/operations/split.hpp"
+#include "grex/backend/active/sizes.hpp"
 #include "grex/backend/base.hpp"
+#include "grex/base.hpp"
 
 namespace grex::backend {
 // Super-native: Compute the horizontal sum of the sum of the two halves
@@ -16,6 +26,88 @@ template<AnyVector THalf>
 inline THalf::Value horizontal_add(SuperVector<THalf> v) {
   return horizontal_add(add(v.lower, v.upper));
 }
+
+// Pair-wise sums of two vectors: [a0 + a1, a2 + a3, …, b0 + b1, b2 + b3, …]
+// Super-native: The pairs of each vector are contained in its halves
+template<AnyVector THalf>
+inline SuperVector<THalf> add_pairwise(SuperVector<THalf> a, SuperVector<THalf> b) {
+  return {.lower = add_pairwise(a.lower, a.upper), .upper = add_pairwise(b.lower, b.upper)};
+}
+// Sub-native: The lower half of the pair-wise sums of the merged vectors
+template<Vectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<T, tPart, tSize> add_pairwise(SubVector<T, tPart, tSize> a,
+                                               SubVector<T, tPart, tSize> b) {
+  const auto merged = merge(a, b);
+  return SubVector<T, tPart, tSize>{add_pairwise(merged, merged).registr()};
+}
+
+// Horizontal sums of `tSources` vectors as the lanes of one vector, computed by a tree:
+// - More vectors than lanes: Merge the results for both halves of the vectors.
+// - Vectors wider than the result and the smallest native vector: Fold each vector in half
+//   before the tree starts.
+// - Otherwise: Combine pairs of vectors using pair-wise sums, which keeps the partial sums of
+//   each vector contiguous and in order, until a single vector remains, which is then combined
+//   with itself until each of the vectors has been reduced to a single lane.
+template<std::size_t tSources, AnyVector TVec, std::size_t tNum>
+inline VectorFor<typename TVec::Value, tSources>
+horizontal_add_tree(const std::array<TVec, tNum>& vs) {
+  using Value = TVec::Value;
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (tNum > size) {
+    static constexpr std::size_t half = tNum / 2;
+    const auto lower =
+      static_apply<half>([&]<std::size_t... tIdxs>() { return std::array{vs[tIdxs]...}; });
+    const auto upper =
+      static_apply<half>([&]<std::size_t... tIdxs>() { return std::array{vs[half + tIdxs]...}; });
+    return merge(horizontal_add_tree<half>(lower), horizontal_add_tree<half>(upper));
+  } else if constexpr (tNum == tSources && size > tNum && size > min_native_size<Value>) {
+    return horizontal_add_tree<tSources>(static_apply<tNum>([&]<std::size_t... tIdxs>() {
+      return std::array{add(split(vs[tIdxs], index_tag<0>), split(vs[tIdxs], index_tag<1>))...};
+    }));
+  } else if constexpr (tNum > 1) {
+    return horizontal_add_tree<tSources>(static_apply<tNum / 2>([&]<std::size_t... tIdxs>() {
+      return std::array{add_pairwise(vs[2 * tIdxs], vs[2 * tIdxs + 1])...};
+    }));
+  } else {
+    // each vector has `size / tSources` lanes in `v`
+    TVec v = vs[0];
+    for (std::size_t lanes = size / tSources; lanes > 1; lanes /= 2) {
+      v = add_pairwise(v, v);
+    }
+    if constexpr (size == tSources) {
+      return v;
+    } else {
+      return VectorFor<Value, tSources>{v.registr()};
+    }
+  }
+}
+template<AnyVector TVec, std::same_as<TVec>... TVecs>
+requires(sizeof...(TVecs) > 0 && std::has_single_bit(1 + sizeof...(TVecs)))
+inline VectorFor<typename TVec::Value, 1 + sizeof...(TVecs)> horizontal_add_many(TVec v,
+                                                                               TVecs... vs) {
+  return horizontal_add_tree<1 + sizeof...(TVecs)>(std::array{v, vs...});
+}
+
+// Dot product: The products of the halves of super-native vectors are added (using fused
+// multiply-adds for floating-point values) before the horizontal sum
+template<AnyVector TVec>
+inline auto dot_products(TVec a, TVec b) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    const auto lower = dot_products(a.lower, b.lower);
+    if constexpr (FloatVector<TVec> && !AnySuperNativeVector<Half>) {
+      return fmadd(a.upper, b.upper, lower);
+    } else {
+      return add(lower, dot_products(a.upper, b.upper));
+    }
+  } else {
+    return multiply(a, b);
+  }
+}
+template<AnyVector TVec>
+inline TVec::Value dot(TVec a, TVec b) {
+  return horizontal_add(dot_products(a, b));
+}
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_ADD_HPP
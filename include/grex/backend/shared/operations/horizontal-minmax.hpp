@@ -7,8 +7,18 @@
 #ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_MINMAX_HPP
 #define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_MINMAX_HPP
 
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+#include "grex/backend/active/operations/blend.hpp"
+#include "grex/backend/active/operations/compare.hpp"
+#include "grex/backend/active/operations/extract.hpp"
 #include "grex/backend/active/operations/minmax.hpp"
+#include "grex/backend/active/operations/set.hpp"
 #include "grex/backend/base.hpp"
+#include "grex/backend/shared/operations/shuffle-static.hpp"
+#include "grex/base.hpp"
 
 namespace grex::backend {
 template<typename THalf>
@@ -19,6 +29,60 @@ template<typename THalf>
 inline THalf::Value horizontal_max(SuperVector<THalf> v) {
   return horizontal_max(max(v.lower, v.upper));
 }
+
+// Reduction trees which carry the lane indices along as values of the same type:
+// In step k, lane i is compared with lane i + 2^k, which makes each lane i with i % 2^(k+1) == 0
+// the best of the lanes i, …, i + 2^(k+1) - 1. A lane is only replaced by the lane above it if that
+// is strictly smaller (larger), which ensures that the first lane attaining the minimum (maximum)
+// is found. Super-native vectors combine the results for both halves, preferring the lower half.
+template<bool tMax, AnyVector TVec>
+inline std::pair<typename TVec::Value, std::size_t> horizontal_arg_tree(TVec v,
+                                                                        BoolTag<tMax> /*is_max*/) {
+  static constexpr std::size_t size = TVec::size;
+  auto is_better = [](auto a, auto b) { return tMax ? compare_lt(b, a) : compare_lt(a, b); };
+  TVec idxs = indices(type_tag<TVec>);
+  auto step = [&]<std::size_t tDist>(IndexTag<tDist> /*dist*/) GREX_ALWAYS_INLINE {
+    auto above = [](TVec x) GREX_ALWAYS_INLINE {
+      return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+        return shuffle<(tIdxs + tDist < size ? ShuffleIndex(tIdxs + tDist) : any_sh)...>(x);
+      });
+    };
+    const TVec av = above(v);
+    const auto better = is_better(av, v);
+    v = blend(better, v, av);
+    idxs = blend(better, idxs, above(idxs));
+  };
+  static_apply<std::bit_width(size) - 1>([&]<std::size_t... tSteps>() GREX_ALWAYS_INLINE {
+    (..., step(index_tag<(std::size_t{1} << tSteps)>));
+  });
+  return {extract(v, 0), std::size_t(extract(idxs, 0))};
+}
+template<bool tMax, typename TValue>
+inline std::pair<TValue, std::size_t> arg_combine(std::pair<TValue, std::size_t> lower,
+                                                  std::pair<TValue, std::size_t> upper,
+                                                  std::size_t offset, BoolTag<tMax> /*is_max*/) {
+  const bool better = tMax ? (lower.first < upper.first) : (upper.first < lower.first);
+  return better ? std::make_pair(upper.first, upper.second + offset) : lower;
+}
+
+template<AnyVector TVec>
+inline std::pair<typename TVec::Value, std::size_t> horizontal_argmin(TVec v) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    return arg_combine(horizontal_argmin(v.lower), horizontal_argmin(v.upper), TVec::size / 2,
+                       false_tag);
+  } else {
+    return horizontal_arg_tree(v, false_tag);
+  }
+}
+template<AnyVector TVec>
+inline std::pair<typename TVec::Value, std::size_t> horizontal_argmax(TVec v) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    return arg_combine(horizontal_argmax(v.lower), horizontal_argmax(v.upper), TVec::size / 2,
+                       true_tag);
+  } else {
+    return horizontal_arg_tree(v, true_tag);
+  }
+}
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_HORIZONTAL_MINMAX_HPP
@@ -0,0 +1,184 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_INTERLEAVE_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_INTERLEAVE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/shared/operations/blend-static.hpp"
+#include "grex/backend/shared/operations/load.hpp"
+#include "grex/backend/shared/operations/shuffle-static.hpp"
+#include "grex/backend/shared/operations/store.hpp"
+#include "grex/base.hpp"
+
+// Interleaved loads (stores) of K vectors load (store) K consecutive vectors of K-tuples,
+// whose lanes are redistributed by combining the lanes of up to four vectors: Each pair of vectors
+// is combined using a static pair shuffle, and the results for both pairs are blended statically.
+// Super-native vectors are handled as their halves, which correspond to consecutive halves
+// of the memory, as this keeps the shuffles within native vectors.
+
+namespace grex::backend {
+// Combine the lanes of up to four vectors: Lane i of the result is lane `TSource{}(i) % size`
+// of vector `TSource{}(i) / size`
+template<std::size_t tPair, std::size_t tNum, AnyVector TVec, typename TSource>
+inline TVec combine_lane_pair(const std::array<TVec, tNum>& vs, TSource /*source*/) {
+  static constexpr std::size_t size = TVec::size;
+  static constexpr auto index = [](std::size_t i) {
+    const std::size_t src = TSource{}(i);
+    return (src / (2 * size) == tPair) ? ShuffleIndex(src % (2 * size)) : any_sh;
+  };
+  return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+    if constexpr (2 * tPair + 1 < tNum) {
+      return pair_shuffle<index(tIdxs)...>(vs[2 * tPair], vs[2 * tPair + 1]);
+    } else {
+      return shuffle<index(tIdxs)...>(vs[2 * tPair]);
+    }
+  });
+}
+template<std::size_t tNum, AnyVector TVec, typename TSource>
+requires(tNum <= 4)
+inline TVec combine_lanes(const std::array<TVec, tNum>& vs, TSource source) {
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (tNum <= 2) {
+    return combine_lane_pair<0>(vs, source);
+  } else {
+    static constexpr auto selector = [](std::size_t i) {
+      return (TSource{}(i) < 2 * size) ? lhs_bl : rhs_bl;
+    };
+    const TVec lower = combine_lane_pair<0>(vs, source);
+    const TVec upper = combine_lane_pair<1>(vs, source);
+    return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return blend<selector(tIdxs)...>(lower, upper);
+    });
+  }
+}
+
+// vector j consists of the lanes i * K + j of the concatenated vectors
+template<std::size_t tK, AnyVector TVec>
+inline std::array<TVec, tK> deinterleave(const std::array<TVec, tK>& vs) {
+  return static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+    return std::array{combine_lanes(vs, [](std::size_t i) { return i * tK + tJs; })...};
+  });
+}
+// the inverse of `deinterleave`
+template<std::size_t tK, AnyVector TVec>
+inline std::array<TVec, tK> interleave(const std::array<TVec, tK>& vs) {
+  static constexpr std::size_t size = TVec::size;
+  return static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+    auto source = []<std::size_t tJ>(IndexTag<tJ> /*j*/) {
+      return [](std::size_t i) {
+        const std::size_t flat = tJ * size + i;
+        return flat % tK * size + flat / tK;
+      };
+    };
+    return std::array{combine_lanes(vs, source(index_tag<tJs>))...};
+  });
+}
+
+template<std::size_t tK, AnyVector TVec>
+inline std::array<TVec, tK> load_interleaved(const typename TVec::Value* ptr, IndexTag<tK> k,
+                                             TypeTag<TVec> /*tag*/) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    const auto lower = load_interleaved(ptr, k, type_tag<Half>);
+    const auto upper = load_interleaved(ptr + tK * Half::size, k, type_tag<Half>);
+    return static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      return std::array{TVec{.lower = lower[tJs], .upper = upper[tJs]}...};
+    });
+  } else {
+    return deinterleave(static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      return std::array{load(ptr + tJs * TVec::size, type_tag<TVec>)...};
+    }));
+  }
+}
+// `num` tuples, with undefined upper lanes
+template<std::size_t tK, AnyVector TVec>
+inline std::array<TVec, tK> load_part_interleaved(const typename TVec::Value* ptr,
+                                                  std::size_t num, IndexTag<tK> k,
+                                                  TypeTag<TVec> tag) {
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    auto merge = [](const auto& lower, const auto& upper) GREX_ALWAYS_INLINE {
+      return static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+        return std::array{TVec{.lower = lower[tJs], .upper = upper[tJs]}...};
+      });
+    };
+    if (num <= Half::size) {
+      const auto undef = undefined(type_tag<Half>);
+      return merge(load_part_interleaved(ptr, num, k, type_tag<Half>),
+                   static_apply<tK>([&]<std::size_t... tJs>() {
+                     return std::array{(void(tJs), undef)...};
+                   }));
+    }
+    return merge(load_interleaved(ptr, k, type_tag<Half>),
+                 load_part_interleaved(ptr + tK * Half::size, num - Half::size, k,
+                                       type_tag<Half>));
+  } else {
+    const std::size_t values = tK * num;
+    auto part = [&](std::size_t j) GREX_ALWAYS_INLINE {
+      return (j * size < values)
+               ? load_part(ptr + j * size, std::min(values - j * size, size), tag)
+               : undefined(tag);
+    };
+    return deinterleave(static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      return std::array{part(tJs)...};
+    }));
+  }
+}
+
+template<std::size_t tK, AnyVector TVec>
+inline void store_interleaved(typename TVec::Value* dst, const std::array<TVec, tK>& srcs) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      store_interleaved(dst, std::array{srcs[tJs].lower...});
+      store_interleaved(dst + tK * Half::size, std::array{srcs[tJs].upper...});
+    });
+  } else {
+    const auto vs = interleave(srcs);
+    static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      (..., store(dst + tJs * TVec::size, vs[tJs]));
+    });
+  }
+}
+// only the first `num` tuples are stored
+template<std::size_t tK, AnyVector TVec>
+inline void store_part_interleaved(typename TVec::Value* dst, const std::array<TVec, tK>& srcs,
+                                   std::size_t num) {
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      if (num <= Half::size) {
+        store_part_interleaved(dst, std::array{srcs[tJs].lower...}, num);
+        return;
+      }
+      store_interleaved(dst, std::array{srcs[tJs].lower...});
+      store_part_interleaved(dst + tK * Half::size, std::array{srcs[tJs].upper...},
+                             num - Half::size);
+    });
+  } else {
+    const std::size_t values = tK * num;
+    const auto vs = interleave(srcs);
+    static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+      auto part = [&](std::size_t j) GREX_ALWAYS_INLINE {
+        if (j * size < values) {
+          store_part(dst + j * size, vs[j], std::min(values - j * size, size));
+        }
+      };
+      (..., part(tJs));
+    });
+  }
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_INTERLEAVE_HPP
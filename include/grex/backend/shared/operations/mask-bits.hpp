@@ -0,0 +1,83 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_BITS_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_BITS_HPP
+
+#include <bit>
+#include <cstddef>
+#include <optional>
+
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+template<AnyMask THalf>
+requires(2 * THalf::size <= 64)
+inline u64 to_bits(SuperMask<THalf> m) {
+  return to_bits(m.lower) | (to_bits(m.upper) << THalf::size);
+}
+template<AnyMask THalf>
+requires(2 * THalf::size <= 64)
+inline SuperMask<THalf> from_bits(u64 bits, TypeTag<SuperMask<THalf>> /*tag*/) {
+  return {
+    .lower = from_bits(bits, type_tag<THalf>),
+    .upper = from_bits(bits >> THalf::size, type_tag<THalf>),
+  };
+}
+
+// Queries based on the bit mask
+template<AnyMask TMask>
+inline std::size_t count_true(TMask m) {
+  return std::size_t(std::popcount(to_bits(m)));
+}
+template<AnyMask TMask>
+inline bool horizontal_or(TMask m) {
+  return to_bits(m) != 0;
+}
+template<AnyMask TMask>
+inline std::optional<std::size_t> first_true(TMask m) {
+  const u64 bits = to_bits(m);
+  if (bits == 0) {
+    return std::nullopt;
+  }
+  return std::size_t(std::countr_zero(bits));
+}
+template<AnyMask TMask>
+inline std::optional<std::size_t> last_true(TMask m) {
+  const u64 bits = to_bits(m);
+  if (bits == 0) {
+    return std::nullopt;
+  }
+  return std::size_t(63 - std::countl_zero(bits));
+}
+
+// Super-native masks: Combine the halves, which also works beyond 64 lanes
+template<AnyMask THalf>
+inline std::size_t count_true(SuperMask<THalf> m) {
+  return count_true(m.lower) + count_true(m.upper);
+}
+template<AnyMask THalf>
+inline bool horizontal_or(SuperMask<THalf> m) {
+  return horizontal_or(m.lower) || horizontal_or(m.upper);
+}
+template<AnyMask THalf>
+inline std::optional<std::size_t> first_true(SuperMask<THalf> m) {
+  if (const auto lower = first_true(m.lower)) {
+    return lower;
+  }
+  return first_true(m.upper).transform([](std::size_t i) { return i + THalf::size; });
+}
+template<AnyMask THalf>
+inline std::optional<std::size_t> last_true(SuperMask<THalf> m) {
+  if (const auto upper = last_true(m.upper)) {
+    return *upper + THalf::size;
+  }
+  return last_true(m.lower);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_BITS_HPP
@@ -0,0 +1,104 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_EXPAND_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_EXPAND_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// For each bit mask with `tLanes` bits, the byte indices of the values for the selected lanes
+// (each consisting of `tLaneBytes` bytes), i.e. the lanes of the front of the source vector
+// in ascending order. The unselected lanes are set to 0x80, which the byte shuffles turn
+// into zeros.
+template<std::size_t tLanes, std::size_t tLaneBytes>
+inline constexpr auto expand_table = [] {
+  std::array<std::array<u8, tLanes * tLaneBytes>, std::size_t{1} << tLanes> table{};
+  for (std::size_t bits = 0; bits < table.size(); ++bits) {
+    auto& entry = table[bits];
+    entry.fill(0x80);
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < tLanes; ++i) {
+      if (((bits >> i) & 1U) == 0) {
+        continue;
+      }
+      for (std::size_t k = 0; k < tLaneBytes; ++k) {
+        entry[i * tLaneBytes + k] = u8(j * tLaneBytes + k);
+      }
+      ++j;
+    }
+  }
+  return table;
+}();
+
+// Fallback: Copy the values one lane at a time
+template<AnyVector TVec, AnyMask TMask>
+inline TVec mask_expand_fallback(TVec v, TMask m) {
+  const auto selected = to_array(m);
+  const auto values = to_array(v);
+  std::array<typename TVec::Value, TVec::size> buf{};
+  std::size_t j = 0;
+  for (std::size_t i = 0; i < TVec::size; ++i) {
+    if (selected[i]) {
+      buf[i] = values[j++];
+    }
+  }
+  return load(buf.data(), type_tag<TVec>);
+}
+
+// Split: The upper half starts with the values following those used by the lower half
+template<AnyVector TVec, AnyMask TMask>
+inline TVec mask_expand_split(TVec v, TMask m) {
+  using Half = decltype(get_low(v));
+  std::array<typename TVec::Value, TVec::size> buf{};
+  store(buf.data(), v);
+  const auto m0 = get_low(m);
+  const Half v1 = load(buf.data() + std::popcount(to_bits(m0)), type_tag<Half>);
+  store(buf.data(), mask_expand(get_low(v), m0));
+  store(buf.data() + Half::size, mask_expand(v1, get_high(m)));
+  return load(buf.data(), type_tag<TVec>);
+}
+
+// Native vectors: Only load the values that are actually needed
+template<Vectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> mask_expand_load(const T* src, NativeMask<T, tSize> m) {
+  const auto num = std::size_t(std::popcount(to_bits(m)));
+  return mask_expand(load_part(src, num, type_tag<NativeVector<T, tSize>>), m);
+}
+
+// Sub-native vectors: Ignore the lanes beyond the part
+template<Vectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<T, tPart, tSize> mask_expand(SubVector<T, tPart, tSize> v,
+                                              SubMask<T, tPart, tSize> m) {
+  const auto cutoff = cutoff_mask(tPart, type_tag<NativeMask<T, tSize>>);
+  return SubVector<T, tPart, tSize>{mask_expand(v.full, logical_and(m.full, cutoff))};
+}
+template<Vectorizable T, std::size_t tPart, std::size_t tSize>
+inline SubVector<T, tPart, tSize> mask_expand_load(const T* src, SubMask<T, tPart, tSize> m) {
+  const auto cutoff = cutoff_mask(tPart, type_tag<NativeMask<T, tSize>>);
+  return SubVector<T, tPart, tSize>{mask_expand_load(src, logical_and(m.full, cutoff))};
+}
+
+// Super-native vectors: Split
+template<AnyVector THalf, AnyMask TMaskHalf>
+inline SuperVector<THalf> mask_expand(SuperVector<THalf> v, SuperMask<TMaskHalf> m) {
+  return mask_expand_split(v, m);
+}
+template<AnyMask TMaskHalf>
+inline VectorFor<typename TMaskHalf::VectorValue, 2 * TMaskHalf::size>
+mask_expand_load(const typename TMaskHalf::VectorValue* src, SuperMask<TMaskHalf> m) {
+  const auto lower = mask_expand_load(src, m.lower);
+  const auto num = std::size_t(std::popcount(to_bits(m.lower)));
+  return {.lower = lower, .upper = mask_expand_load(src + num, m.upper)};
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MASK_EXPAND_HPP
@@ -8,23 +8,46 @@
 #define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MULTIBYTE_HPP
 
 #include <array>
+#include <climits>
 #include <cstddef>
 
+#include "grex/backend/active/operations/bit-manipulation.hpp"
+#include "grex/backend/active/operations/shift.hpp"
 #include "grex/backend/base.hpp"
 #include "grex/base.hpp"
 
 namespace grex::backend {
 namespace mb {
-template<std::size_t tSrc, std::size_t tDst, std::size_t tSize, std::size_t tPart = tSize>
+// The source byte of byte `j` within an integer, which is reversed for big-endian integers
+// (padding bytes with `j >= tSrc` are left as they are)
+template<std::size_t tSrc, bool tBigEndian>
+inline constexpr std::size_t byte_index(std::size_t j) {
+  return (tBigEndian && j < tSrc) ? tSrc - 1 - j : j;
+}
+
+template<std::size_t tSrc, std::size_t tDst, std::size_t tSize, std::size_t tPart = tSize,
+         bool tBigEndian = false>
 requires((tDst * tSize) == 16)
 inline constexpr auto shuffle_indices_128 = static_apply<tSize * tDst>([]<std::size_t... tIdxs>() {
   auto op = []<std::size_t tIdx>(IndexTag<tIdx> /*idx*/) {
     constexpr std::size_t j = tIdx % tDst;
     constexpr std::size_t k = tIdx / tDst;
-    return (j < tSrc && k < tPart) ? i8(j + tSrc * k) : i8(-1);
+    return (j < tSrc && k < tPart) ? i8(byte_index<tSrc, tBigEndian>(j) + tSrc * k) : i8(-1);
   };
   return std::array{op(index_tag<tIdxs>)...};
 });
+
+// Byte shuffle indices which gather the lower `tDst` bytes of each `tSrc`-byte integer
+// in a 128-bit register at the bottom of the register
+template<std::size_t tDst, std::size_t tSrc>
+inline constexpr auto pack_indices_128 = static_apply<16>([]<std::size_t... tIdxs>() {
+  auto op = [](std::size_t i) {
+    const std::size_t j = i % tDst;
+    const std::size_t k = i / tDst;
+    return (k < 16 / tSrc) ? i8(j + tSrc * k) : i8(-1);
+  };
+  return std::array{op(tIdxs)...};
+});
 } // namespace mb
 
 // super-native
@@ -36,6 +59,49 @@ inline SuperVector<THalf> load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/,
     .upper = load_multibyte(ptr + tSrc * THalf::size, index_tag<tSrc>, type_tag<THalf>),
   };
 }
+
+// Big-endian integers: Use a single byte shuffle if the backend provides one. Otherwise,
+// reverse the bytes of each integer loaded as little-endian, which moves the padding bytes
+// to the bottom, and shift them out.
+template<std::size_t tSrc, typename TDst>
+requires(!AnySuperNativeVector<TDst>)
+inline TDst load_multibyte_big_endian(const u8* ptr, IndexTag<tSrc> src, TypeTag<TDst> dst) {
+  if constexpr (requires { load_multibyte(ptr, src, dst, true_tag); }) {
+    return load_multibyte(ptr, src, dst, true_tag);
+  } else {
+    const TDst swapped = byteswap(load_multibyte(ptr, src, dst));
+    if constexpr (tSrc == sizeof(typename TDst::Value)) {
+      return swapped;
+    } else {
+      return shift_right(swapped, index_tag<(sizeof(typename TDst::Value) - tSrc) * CHAR_BIT>);
+    }
+  }
+}
+template<std::size_t tSrc, typename THalf>
+inline SuperVector<THalf> load_multibyte_big_endian(const u8* ptr, IndexTag<tSrc> /*src*/,
+                                                    TypeTag<SuperVector<THalf>> /*dst*/) {
+  return {
+    .lower = load_multibyte_big_endian(ptr, index_tag<tSrc>, type_tag<THalf>),
+    .upper =
+      load_multibyte_big_endian(ptr + tSrc * THalf::size, index_tag<tSrc>, type_tag<THalf>),
+  };
+}
+
+// Storing is the inverse of loading: Write the lower `tDst` bytes of each element
+template<std::size_t tDst, typename THalf>
+inline void store_multibyte_part(u8* ptr, SuperVector<THalf> src, std::size_t num,
+                                 IndexTag<tDst> dst) {
+  if (num <= THalf::size) {
+    store_multibyte_part(ptr, src.lower, num, dst);
+    return;
+  }
+  store_multibyte_part(ptr, src.lower, THalf::size, dst);
+  store_multibyte_part(ptr + tDst * THalf::size, src.upper, num - THalf::size, dst);
+}
+template<std::size_t tDst, AnyVector TSrc>
+inline void store_multibyte(u8* ptr, TSrc src, IndexTag<tDst> dst) {
+  store_multibyte_part(ptr, src, TSrc::size, dst);
+}
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_MULTIBYTE_HPP
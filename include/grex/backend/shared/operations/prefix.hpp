@@ -0,0 +1,75 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_PREFIX_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_PREFIX_HPP
+
+#include <bit>
+#include <cstddef>
+#include <limits>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/extract.hpp"
+#include "grex/backend/active/operations/minmax.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shingle.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+// Prefix operations are log-step scans: In step k, each lane is combined with the lane 2^k below
+// it, which is obtained by sliding the vector up by 2^k lanes and shifting in the identity.
+// Sub-native vectors are scanned in the full register, as the inactive lanes only affect lanes
+// above them, while the upper half of super-native vectors is combined with the last lane of the
+// scanned lower half.
+
+namespace grex::backend {
+template<std::size_t tSize, AnyNativeVector TVec>
+inline TVec prefix_scan(TVec v, TVec identity, auto op) {
+  static_apply<std::bit_width(tSize) - 1>([&]<std::size_t... tSteps>() {
+    (..., (v = op(v, slide_up(identity, v, index_tag<std::size_t{1} << tSteps>))));
+  });
+  return v;
+}
+template<AnyVector TVec>
+inline TVec prefix_scan(TVec v, typename TVec::Value identity, auto op) {
+  if constexpr (AnySuperNativeVector<TVec>) {
+    using Half = decltype(TVec::lower);
+    const Half lower = prefix_scan(v.lower, identity, op);
+    const Half last = broadcast(extract(lower, Half::size - 1), type_tag<Half>);
+    return {.lower = lower, .upper = op(last, prefix_scan(v.upper, identity, op))};
+  } else if constexpr (AnySubNativeVector<TVec>) {
+    using Full = TVec::Full;
+    return TVec{prefix_scan<TVec::size>(v.full, broadcast(identity, type_tag<Full>), op)};
+  } else {
+    return prefix_scan<TVec::size>(v, broadcast(identity, type_tag<TVec>), op);
+  }
+}
+
+template<AnyVector TVec>
+inline TVec prefix_sum(TVec v) {
+  return prefix_scan(v, typename TVec::Value{}, [](auto a, auto b) { return add(a, b); });
+}
+// the inclusive prefix sums plus the carry, shifted up by one lane with the carry in front
+template<AnyVector TVec>
+inline TVec exclusive_prefix_sum(TVec v, Scalar<typename TVec::Value> carry) {
+  return shingle_up(carry, add(prefix_sum(v), broadcast(carry.value, type_tag<TVec>)));
+}
+
+template<AnyVector TVec>
+inline TVec prefix_min(TVec v) {
+  using Limits = std::numeric_limits<typename TVec::Value>;
+  const auto identity = Limits::has_infinity ? Limits::infinity() : Limits::max();
+  return prefix_scan(v, identity, [](auto a, auto b) { return min(a, b); });
+}
+template<AnyVector TVec>
+inline TVec prefix_max(TVec v) {
+  using Limits = std::numeric_limits<typename TVec::Value>;
+  const auto identity = Limits::has_infinity ? -Limits::infinity() : Limits::lowest();
+  return prefix_scan(v, identity, [](auto a, auto b) { return max(a, b); });
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_PREFIX_HPP
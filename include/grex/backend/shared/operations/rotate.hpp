@@ -0,0 +1,104 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ROTATE_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ROTATE_HPP
+
+#include <climits>
+#include <cstddef>
+
+#include "grex/backend/active/operations/arithmetic.hpp"
+#include "grex/backend/active/operations/bitwise.hpp"
+#include "grex/backend/active/operations/reinterpret.hpp"
+#include "grex/backend/active/operations/set.hpp"
+#include "grex/backend/active/operations/shift.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Rotations without native instructions: Combine a left shift and a logical right shift,
+// whose offsets are reduced modulo the number of bits to keep them in range
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_left(NativeVector<T, tSize> v, AnyIndexTag auto offset) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  static constexpr std::size_t lshift = offset.value % bits;
+  if constexpr (lshift == 0) {
+    return v;
+  } else {
+    const auto uv = as<Unsigned>(v);
+    return as<T>(bitwise_or(shift_left(uv, index_tag<lshift>),
+                            shift_right(uv, index_tag<bits - lshift>)));
+  }
+}
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_left(NativeVector<T, tSize> v, std::size_t offset) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  const auto uv = as<Unsigned>(v);
+  return as<T>(bitwise_or(shift_left(uv, offset % bits), shift_right(uv, (bits - offset) % bits)));
+}
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_left(NativeVector<T, tSize> v,
+                                          NativeVector<UnsignedInt<sizeof(T)>, tSize> offsets) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  using Offsets = NativeVector<Unsigned, tSize>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  const auto mask = broadcast(Unsigned{bits - 1}, type_tag<Offsets>);
+  const auto uv = as<Unsigned>(v);
+  return as<T>(bitwise_or(shift_left(uv, bitwise_and(offsets, mask)),
+                          shift_right(uv, bitwise_and(negate(offsets), mask))));
+}
+
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_right(NativeVector<T, tSize> v, AnyIndexTag auto offset) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  return rotate_left(v, index_tag<bits - offset.value % bits>);
+}
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_right(NativeVector<T, tSize> v, std::size_t offset) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  return rotate_left(v, bits - offset % bits);
+}
+template<IntVectorizable T, std::size_t tSize>
+inline NativeVector<T, tSize> rotate_right(NativeVector<T, tSize> v,
+                                           NativeVector<UnsignedInt<sizeof(T)>, tSize> offsets) {
+  return rotate_left(v, negate(offsets));
+}
+
+#define GREX_SUBSUPER(NAME) \
+  template<typename THalf> \
+  inline SuperVector<THalf> NAME(SuperVector<THalf> v, AnyIndexTag auto offset) { \
+    return {.lower = NAME(v.lower, offset), .upper = NAME(v.upper, offset)}; \
+  } \
+  template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
+  inline SubVector<T, tPart, tSize> NAME(SubVector<T, tPart, tSize> v, AnyIndexTag auto offset) { \
+    return SubVector<T, tPart, tSize>{NAME(v.full, offset)}; \
+  } \
+  template<typename THalf> \
+  inline SuperVector<THalf> NAME(SuperVector<THalf> v, std::size_t offset) { \
+    return {.lower = NAME(v.lower, offset), .upper = NAME(v.upper, offset)}; \
+  } \
+  template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
+  inline SubVector<T, tPart, tSize> NAME(SubVector<T, tPart, tSize> v, std::size_t offset) { \
+    return SubVector<T, tPart, tSize>{NAME(v.full, offset)}; \
+  } \
+  template<typename THalf, typename TOffsetHalf> \
+  inline SuperVector<THalf> NAME(SuperVector<THalf> v, SuperVector<TOffsetHalf> offsets) { \
+    return {.lower = NAME(v.lower, offsets.lower), .upper = NAME(v.upper, offsets.upper)}; \
+  } \
+  template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
+  inline SubVector<T, tPart, tSize> NAME( \
+    SubVector<T, tPart, tSize> v, SubVector<UnsignedInt<sizeof(T)>, tPart, tSize> offsets) { \
+    return SubVector<T, tPart, tSize>{NAME(v.full, offsets.full)}; \
+  }
+
+GREX_SUBSUPER(rotate_left)
+GREX_SUBSUPER(rotate_right)
+#undef GREX_SUBSUPER
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_ROTATE_HPP
@@ -0,0 +1,60 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SCATTER_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SCATTER_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include "grex/backend/base.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Spill indices and values and store one lane after the other,
+// which keeps the value of the highest lane for duplicate indices
+template<Vectorizable TValue, std::size_t tExtent, AnyVector TIdxVec, AnyVector TValVec>
+requires(std::same_as<typename TValVec::Value, TValue> && TIdxVec::size == TValVec::size)
+inline void scatter(std::span<TValue, tExtent> data, TIdxVec idxs, TValVec v) {
+  const auto idxa = to_array(idxs);
+  const auto vala = to_array(v);
+  for (std::size_t i = 0; i < TValVec::size; ++i) {
+    data[std::size_t(idxa[i])] = vala[i];
+  }
+}
+template<Vectorizable TValue, std::size_t tExtent, AnyMask TMask, AnyVector TIdxVec,
+         AnyVector TValVec>
+requires(std::same_as<typename TValVec::Value, TValue> && TIdxVec::size == TValVec::size &&
+         TMask::size == TValVec::size)
+inline void mask_scatter(std::span<TValue, tExtent> data, TMask m, TIdxVec idxs, TValVec v) {
+  const auto idxa = to_array(idxs);
+  const auto vala = to_array(v);
+  // only visit the selected lanes
+  for (u64 bits = to_bits(m); bits != 0; bits &= bits - 1) {
+    const auto i = std::size_t(std::countr_zero(bits));
+    data[std::size_t(idxa[i])] = vala[i];
+  }
+}
+
+// Super-native indices and values: Lower half first to keep the lane order
+template<Vectorizable TValue, std::size_t tExtent, typename TIdxHalf, typename TValHalf>
+inline void scatter(std::span<TValue, tExtent> data, SuperVector<TIdxHalf> idxs,
+                    SuperVector<TValHalf> v) {
+  scatter(data, idxs.lower, v.lower);
+  scatter(data, idxs.upper, v.upper);
+}
+template<Vectorizable TValue, std::size_t tExtent, typename TMaskHalf, typename TIdxHalf,
+         typename TValHalf>
+inline void mask_scatter(std::span<TValue, tExtent> data, SuperMask<TMaskHalf> m,
+                         SuperVector<TIdxHalf> idxs, SuperVector<TValHalf> v) {
+  mask_scatter(data, m.lower, idxs.lower, v.lower);
+  mask_scatter(data, m.upper, idxs.upper, v.upper);
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SCATTER_HPP
@@ -22,10 +22,35 @@ namespace grex::backend {
   template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
   inline SubVector<T, tPart, tSize> NAME(SubVector<T, tPart, tSize> v, AnyIndexTag auto offset) { \
     return SubVector<T, tPart, tSize>{NAME(v.full, offset)}; \
+  } \
+  template<typename THalf> \
+  inline SuperVector<THalf> NAME(SuperVector<THalf> v, std::size_t offset) { \
+    return {.lower = NAME(v.lower, offset), .upper = NAME(v.upper, offset)}; \
+  } \
+  template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
+  inline SubVector<T, tPart, tSize> NAME(SubVector<T, tPart, tSize> v, std::size_t offset) { \
+    return SubVector<T, tPart, tSize>{NAME(v.full, offset)}; \
+  }
+
+GREX_SUBSUPER(shift_left)
+GREX_SUBSUPER(shift_right)
+#undef GREX_SUBSUPER
+
+// Shifts by per-lane offsets
+#define GREX_SUBSUPER(NAME) \
+  template<typename THalf, typename TOffsetHalf> \
+  inline SuperVector<THalf> NAME(SuperVector<THalf> v, SuperVector<TOffsetHalf> offsets) { \
+    return {.lower = NAME(v.lower, offsets.lower), .upper = NAME(v.upper, offsets.upper)}; \
+  } \
+  template<IntVectorizable T, std::size_t tPart, std::size_t tSize> \
+  inline SubVector<T, tPart, tSize> NAME( \
+    SubVector<T, tPart, tSize> v, SubVector<UnsignedInt<sizeof(T)>, tPart, tSize> offsets) { \
+    return SubVector<T, tPart, tSize>{NAME(v.full, offsets.full)}; \
   }
 
 GREX_SUBSUPER(shift_left)
 GREX_SUBSUPER(shift_right)
+#undef GREX_SUBSUPER
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SHIFT_HPP
@@ -0,0 +1,112 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SORT_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SORT_HPP
+
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+#include "grex/backend/active/operations/minmax.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/shared/operations/blend-static.hpp"
+#include "grex/backend/shared/operations/shuffle-static.hpp"
+#include "grex/base.hpp"
+
+// Sorting uses bitonic networks in the variant in which all comparators point in the same
+// direction: Sorting blocks of size k from sorted blocks of size k/2 first compares lane i with
+// lane i ^ (k - 1), i.e. the upper block is compared in reverse, after which each block consists
+// of two bitonic halves, which are sorted by half-cleaners comparing lane i with lane i ^ j
+// for j = k/4, …, 1. Each of these steps is a static shuffle to get the partner lanes,
+// a minimum and a maximum, and a static blend to choose between them.
+// The steps of super-native vectors which only compare lanes within each half are applied to
+// the halves, while the steps between the halves work on the halves directly without shuffling.
+
+namespace grex::backend {
+template<AnyVector TVec>
+inline TVec reverse(TVec v) {
+  return static_apply<TVec::size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+    return shuffle<ShuffleIndex(TVec::size - 1 - tIdxs)...>(v);
+  });
+}
+
+// compare lane i with lane i ^ tPartner, keeping the minimum iff i & tSelect == 0
+// (the maximum for descending order)
+template<std::size_t tPartner, std::size_t tSelect, bool tDescending, AnyVector TVec>
+inline TVec sort_exchange(TVec v) {
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (AnySuperNativeVector<TVec>) {
+    static constexpr std::size_t half = size / 2;
+    if constexpr (tSelect < half) {
+      return {
+        .lower = sort_exchange<tPartner, tSelect, tDescending>(v.lower),
+        .upper = sort_exchange<tPartner, tSelect, tDescending>(v.upper),
+      };
+    } else {
+      // the upper half is compared in reverse for flips
+      static constexpr bool flip = tPartner != half;
+      const auto upper = flip ? reverse(v.upper) : v.upper;
+      const auto lo = min(v.lower, upper);
+      const auto hi = max(v.lower, upper);
+      const auto new_upper = tDescending ? lo : hi;
+      return {
+        .lower = tDescending ? hi : lo,
+        .upper = flip ? reverse(new_upper) : new_upper,
+      };
+    }
+  } else {
+    const TVec partner = static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return shuffle<ShuffleIndex(tIdxs ^ tPartner)...>(v);
+    });
+    const TVec lo = min(v, partner);
+    const TVec hi = max(v, partner);
+    static constexpr auto sel = [](std::size_t i) {
+      return (((i & tSelect) == 0) != tDescending) ? lhs_bl : rhs_bl;
+    };
+    return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return blend<sel(tIdxs)...>(lo, hi);
+    });
+  }
+}
+
+// sort a bitonic sequence within blocks of size 2 * tDist
+template<std::size_t tDist, bool tDescending, AnyVector TVec>
+inline TVec bitonic_clean(TVec v) {
+  if constexpr (tDist == 0) {
+    return v;
+  } else {
+    return bitonic_clean<tDist / 2, tDescending>(sort_exchange<tDist, tDist, tDescending>(v));
+  }
+}
+
+template<bool tDescending, AnyVector TVec>
+inline TVec sort(TVec v, BoolTag<tDescending> /*descending*/) {
+  static_apply<std::bit_width(TVec::size) - 1>([&]<std::size_t... tSteps>() GREX_ALWAYS_INLINE {
+    auto step = [&]<std::size_t tBlock>(IndexTag<tBlock> /*block*/) GREX_ALWAYS_INLINE {
+      v = sort_exchange<tBlock - 1, tBlock / 2, tDescending>(v);
+      v = bitonic_clean<tBlock / 4, tDescending>(v);
+    };
+    (..., step(index_tag<std::size_t{2} << tSteps>));
+  });
+  return v;
+}
+
+// merge two vectors sorted in the same order: comparing `a` with `b` in reverse
+// results in bitonic vectors containing the lower and the upper values, respectively
+template<bool tDescending, AnyVector TVec>
+inline std::pair<TVec, TVec> merge_sorted(TVec a, TVec b, BoolTag<tDescending> /*descending*/) {
+  const TVec rb = reverse(b);
+  const TVec lo = min(a, rb);
+  const TVec hi = max(a, rb);
+  return {
+    bitonic_clean<TVec::size / 2, tDescending>(tDescending ? hi : lo),
+    bitonic_clean<TVec::size / 2, tDescending>(tDescending ? lo : hi),
+  };
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_SORT_HPP
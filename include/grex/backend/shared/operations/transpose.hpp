@@ -0,0 +1,112 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_TRANSPOSE_HPP
+#define INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_TRANSPOSE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "grex/backend/active/operations/merge.hpp"
+#include "grex/backend/active/operations/split.hpp"
+#include "grex/backend/base.hpp"
+#include "grex/backend/shared/operations/shuffle-static.hpp"
+#include "grex/base.hpp"
+
+// Square transposes swap the off-diagonal blocks of size d×d within each block of size 2d×2d
+// for d = 1, 2, …, N/2: For each x with x & d == 0, lane j + d of vector x (for j & d == 0)
+// is exchanged with lane j of vector x + d, which corresponds to trn1/trn2 at d times the lane
+// width on Arm. Backends can provide more efficient transposes of native vectors by overloading
+// `transpose_square`.
+// Super-native vectors transpose the four quadrants formed by their halves, and rectangular
+// transposes are reduced to square ones by splitting (merging) the vectors.
+
+namespace grex::backend {
+// exchange the lanes j + tDist of `a` with the lanes j of `b` for all j with j & tDist == 0
+template<std::size_t tDist, AnyVector TVec>
+inline std::pair<TVec, TVec> transpose_blocks(TVec a, TVec b, IndexTag<tDist> /*dist*/) {
+  static constexpr std::size_t size = TVec::size;
+  return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+    return std::make_pair(
+      pair_shuffle<ShuffleIndex((tIdxs & tDist) == 0 ? tIdxs : size + tIdxs - tDist)...>(a, b),
+      pair_shuffle<ShuffleIndex((tIdxs & tDist) == 0 ? tIdxs + tDist : size + tIdxs)...>(a, b));
+  });
+}
+
+template<AnyVector TVec>
+GREX_ALWAYS_INLINE inline std::array<TVec, TVec::size>
+transpose_square(std::array<TVec, TVec::size> vs) {
+  static constexpr std::size_t size = TVec::size;
+  auto round = [&]<std::size_t tDist>(IndexTag<tDist> dist) GREX_ALWAYS_INLINE {
+    static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      auto pair = [&](std::size_t x) GREX_ALWAYS_INLINE {
+        if ((x & tDist) == 0) {
+          std::tie(vs[x], vs[x + tDist]) = transpose_blocks(vs[x], vs[x + tDist], dist);
+        }
+      };
+      (..., pair(tIdxs));
+    });
+  };
+  static_apply<std::bit_width(size) - 1>([&]<std::size_t... tRounds>() GREX_ALWAYS_INLINE {
+    (..., round(index_tag<(std::size_t{1} << tRounds)>));
+  });
+  return vs;
+}
+
+template<AnyVector TVec, std::size_t tNum>
+GREX_ALWAYS_INLINE inline std::array<VectorFor<typename TVec::Value, tNum>, TVec::size>
+transpose(const std::array<TVec, tNum>& vs) {
+  static constexpr std::size_t size = TVec::size;
+  if constexpr (tNum < size) {
+    // transpose the lower and the upper halves of the columns separately
+    const auto lower = static_apply<tNum>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return transpose(std::array{get_low(vs[tIdxs])...});
+    });
+    const auto upper = static_apply<tNum>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return transpose(std::array{get_high(vs[tIdxs])...});
+    });
+    return static_apply<size / 2>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return std::array{lower[tIdxs]..., upper[tIdxs]...};
+    });
+  } else if constexpr (tNum > size) {
+    // transpose the lower and the upper halves of the rows separately
+    const auto lower = static_apply<tNum / 2>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return transpose(std::array{vs[tIdxs]...});
+    });
+    const auto upper = static_apply<tNum / 2>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return transpose(std::array{vs[tNum / 2 + tIdxs]...});
+    });
+    return static_apply<size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return std::array{merge(lower[tIdxs], upper[tIdxs])...};
+    });
+  } else if constexpr (AnySuperNativeVector<TVec>) {
+    // transpose the quadrants, swapping the off-diagonal ones
+    static constexpr std::size_t half = size / 2;
+    auto quadrant = [&]<std::size_t tRow>(IndexTag<tRow> /*row*/, auto part) GREX_ALWAYS_INLINE {
+      return static_apply<half>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+        return transpose(std::array{part(vs[tRow + tIdxs])...});
+      });
+    };
+    auto lower = [](TVec v) GREX_ALWAYS_INLINE { return v.lower; };
+    auto upper = [](TVec v) GREX_ALWAYS_INLINE { return v.upper; };
+    const auto q00 = quadrant(index_tag<0>, lower);
+    const auto q01 = quadrant(index_tag<0>, upper);
+    const auto q10 = quadrant(index_tag<half>, lower);
+    const auto q11 = quadrant(index_tag<half>, upper);
+    return static_apply<half>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return std::array{TVec{.lower = q00[tIdxs], .upper = q10[tIdxs]}...,
+                        TVec{.lower = q01[tIdxs], .upper = q11[tIdxs]}...};
+    });
+  } else {
+    return transpose_square(vs);
+  }
+}
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_SHARED_OPERATIONS_TRANSPOSE_HPP
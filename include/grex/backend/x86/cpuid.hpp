@@ -91,6 +91,35 @@ struct CpuId {
   }
   return 4;
 }
+
+// Extensions that are not part of any x86-64 level, but are used if they are available
+struct X86Extensions {
+  bool avx512vbmi;
+  bool avx512vbmi2;
+  bool avx512bitalg;
+  bool avx512vpopcntdq;
+  bool avx512fp16;
+  bool avx512bf16;
+  bool gfni;
+};
+
+[[nodiscard]] inline X86Extensions runtime_x86_64_extensions() {
+  const CpuId leaf7_0 = read_cpuid(7, 0);
+  // sub-leaf 1 only exists if sub-leaf 0 reports it
+  const CpuId leaf7_1 = (leaf7_0.eax >= 1) ? read_cpuid(7, 1) : CpuId{};
+
+  auto read_bit = [](unsigned int value, unsigned int mask) { return (value & mask) != 0; };
+
+  return X86Extensions{
+    .avx512vbmi = read_bit(leaf7_0.ecx, bit_AVX512VBMI),
+    .avx512vbmi2 = read_bit(leaf7_0.ecx, bit_AVX512VBMI2),
+    .avx512bitalg = read_bit(leaf7_0.ecx, bit_AVX512BITALG),
+    .avx512vpopcntdq = read_bit(leaf7_0.ecx, bit_AVX512VPOPCNTDQ),
+    .avx512fp16 = read_bit(leaf7_0.edx, bit_AVX512FP16),
+    .avx512bf16 = read_bit(leaf7_1.eax, bit_AVX512BF16),
+    .gfni = read_bit(leaf7_0.ecx, bit_GFNI),
+  };
+}
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_X86_CPUID_HPP
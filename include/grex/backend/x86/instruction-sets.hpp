@@ -21,15 +21,51 @@
 #endif
 #endif
 
-#if __AVX512VBMI__
+#if GREX_X86_64_LEVEL >= 4 && __AVX512VBMI__
 #define GREX_HAS_AVX512VBMI true
 #else
 #define GREX_HAS_AVX512VBMI false
 #endif
-#if __AVX512VBMI2__
+#if GREX_X86_64_LEVEL >= 4 && __AVX512VBMI2__
 #define GREX_HAS_AVX512VBMI2 true
 #else
 #define GREX_HAS_AVX512VBMI2 false
 #endif
+#if GREX_X86_64_LEVEL >= 4 && __AVX512CD__
+#define GREX_HAS_AVX512CD true
+#else
+#define GREX_HAS_AVX512CD false
+#endif
+#if GREX_X86_64_LEVEL >= 4 && __AVX512BITALG__
+#define GREX_HAS_AVX512BITALG true
+#else
+#define GREX_HAS_AVX512BITALG false
+#endif
+#if GREX_X86_64_LEVEL >= 4 && __AVX512VPOPCNTDQ__
+#define GREX_HAS_AVX512VPOPCNTDQ true
+#else
+#define GREX_HAS_AVX512VPOPCNTDQ false
+#endif
+#if __F16C__
+#define GREX_HAS_F16C true
+#else
+#define GREX_HAS_F16C false
+#endif
+#if GREX_X86_64_LEVEL >= 4 && __AVX512FP16__
+#define GREX_HAS_AVX512FP16 true
+#else
+#define GREX_HAS_AVX512FP16 false
+#endif
+#if GREX_X86_64_LEVEL >= 4 && __AVX512BF16__
+#define GREX_HAS_AVX512BF16 true
+#else
+#define GREX_HAS_AVX512BF16 false
+#endif
+// only the 128-bit instructions are guaranteed, the wider ones need AVX/AVX-512 as well
+#if __GFNI__
+#define GREX_HAS_GFNI true
+#else
+#define GREX_HAS_GFNI false
+#endif
 
 #endif // INCLUDE_GREX_BACKEND_X86_INSTRUCTION_SETS_HPP
@@ -4,33 +4,46 @@
 // IWYU pragma: begin_exports
 #include "operations/abs.hpp"
 #include "operations/arithmetic-mask.hpp"
+#include "operations/arithmetic-narrow.hpp"
+#include "operations/arithmetic-wide.hpp"
 #include "operations/arithmetic.hpp"
+#include "operations/bfloat16.hpp"
+#include "operations/bit-manipulation.hpp"
 #include "operations/bit.hpp"
+#include "operations/bitpacked.hpp"
 #include "operations/bitwise.hpp"
 #include "operations/blend-static.hpp"
 #include "operations/blend-zero-static.hpp"
 #include "operations/blend.hpp"
 #include "operations/classification.hpp"
 #include "operations/compare.hpp"
+#include "operations/compress.hpp"
 #include "operations/convert.hpp"
 #include "operations/expand.hpp"
 #include "operations/extract-single.hpp"
 #include "operations/extract.hpp"
 #include "operations/fmadd-family.hpp"
 #include "operations/gather.hpp"
+#include "operations/half.hpp"
 #include "operations/horizontal-add.hpp"
 #include "operations/horizontal-and.hpp"
 #include "operations/horizontal-minmax.hpp"
 #include "operations/insert-static.hpp"
 #include "operations/insert.hpp"
+#include "operations/interleave.hpp"
 #include "operations/intrinsics.hpp"
 #include "operations/load.hpp"
+#include "operations/mask-bits.hpp"
 #include "operations/mask-convert.hpp"
+#include "operations/mask-expand.hpp"
 #include "operations/mask-index.hpp"
 #include "operations/merge.hpp"
 #include "operations/minmax.hpp"
 #include "operations/multibyte.hpp"
+#include "operations/prefix.hpp"
 #include "operations/reinterpret.hpp"
+#include "operations/rotate.hpp"
+#include "operations/scatter.hpp"
 #include "operations/set.hpp"
 #include "operations/shift.hpp"
 #include "operations/shingle.hpp"
@@ -38,10 +51,12 @@
 #include "operations/shuffle-static.hpp"
 #include "operations/shuffle.hpp"
 #include "operations/split.hpp"
+#include "operations/sort.hpp"
 #include "operations/sqrt.hpp"
 #include "operations/store.hpp"
 #include "operations/subnative.hpp"
 #include "operations/to-array.hpp"
+#include "operations/transpose.hpp"
 // IWYU pragma: end_exports
 
 #endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_HPP
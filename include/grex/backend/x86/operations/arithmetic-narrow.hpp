@@ -0,0 +1,91 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_NARROW_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_NARROW_HPP
+
+#include <limits>
+
+#include <immintrin.h>
+
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/macros/types.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/operations/horizontal-add.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp" // IWYU pragma: keep
+
+namespace grex::backend {
+// Saturating, averaging and absolute-difference arithmetic on 8/16-bit integers.
+// Averaging and absolute differences are only available for unsigned integers, which is why
+// signed integers are mapped to unsigned integers while preserving the order by flipping the
+// sign bit: The results are either invariant (absolute differences) or are flipped back.
+#define GREX_NARROW_FLIP_u(BITS, BITPREFIX, REGISTERBITS, X) X
+#define GREX_NARROW_FLIP_i(BITS, BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_xor_si##REGISTERBITS( \
+    X, BITPREFIX##_set1_epi##BITS(std::numeric_limits<i##BITS>::min()))
+#define GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, X) \
+  GREX_NARROW_FLIP_##KIND(BITS, BITPREFIX, REGISTERBITS, X)
+
+// |a - b| for unsigned integers: One of the two saturated differences is zero
+#define GREX_NARROW_ABSDIFF(BITS, BITPREFIX, REGISTERBITS, A, B) \
+  BITPREFIX##_or_si##REGISTERBITS(BITPREFIX##_subs_epu##BITS(A, B), \
+                                  BITPREFIX##_subs_epu##BITS(B, A))
+
+// 8 bit: psadbw computes the sums of the absolute differences of eight bytes each
+#define GREX_NARROW_SAD_8(KIND, BITPREFIX, REGISTERBITS) \
+  const auto sad = BITPREFIX##_sad_epu8(GREX_NARROW_FLIP(KIND, 8, BITPREFIX, REGISTERBITS, a.r), \
+                                        GREX_NARROW_FLIP(KIND, 8, BITPREFIX, REGISTERBITS, b.r));
+// 16 bit: Sum the lower and upper bytes of the absolute differences separately
+#define GREX_NARROW_SAD_16(KIND, BITPREFIX, REGISTERBITS) \
+  const auto diff = abs_diff(a, b).r; \
+  const auto zero = BITPREFIX##_setzero_si##REGISTERBITS(); \
+  const auto lo = BITPREFIX##_sad_epu8( \
+    BITPREFIX##_and_si##REGISTERBITS(diff, BITPREFIX##_set1_epi16(0x00FF)), zero); \
+  const auto hi = BITPREFIX##_sad_epu8(BITPREFIX##_srli_epi16(diff, 8), zero); \
+  const auto sad = BITPREFIX##_add_epi64(lo, BITPREFIX##_slli_epi64(hi, 8));
+
+#define GREX_NARROW(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> add_saturate(NativeVector<KIND##BITS, SIZE> a, \
+                                                     NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = BITPREFIX##_adds_ep##KIND##BITS(a.r, b.r)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> subtract_saturate(NativeVector<KIND##BITS, SIZE> a, \
+                                                          NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = BITPREFIX##_subs_ep##KIND##BITS(a.r, b.r)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> average_round(NativeVector<KIND##BITS, SIZE> a, \
+                                                      NativeVector<KIND##BITS, SIZE> b) { \
+    const auto avg = \
+      BITPREFIX##_avg_epu##BITS(GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, a.r), \
+                                GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, b.r)); \
+    return {.r = GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, avg)}; \
+  } \
+  inline NativeVector<u##BITS, SIZE> abs_diff(NativeVector<KIND##BITS, SIZE> a, \
+                                              NativeVector<KIND##BITS, SIZE> b) { \
+    return {.r = GREX_NARROW_ABSDIFF(BITS, BITPREFIX, REGISTERBITS, \
+                                     GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, a.r), \
+                                     GREX_NARROW_FLIP(KIND, BITS, BITPREFIX, REGISTERBITS, b.r))}; \
+  } \
+  inline u64 sum_abs_diff(NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    GREX_NARROW_SAD_##BITS(KIND, BITPREFIX, REGISTERBITS) \
+    /* the partial sums are in the 64-bit lanes */ \
+    return horizontal_add(NativeVector<u64, GREX_DIVIDE(REGISTERBITS, 64)>{.r = sad}); \
+  }
+#define GREX_NARROW_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_NARROW_INT_TYPE(GREX_NARROW, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_NARROW_ALL)
+
+GREX_NNVECTOR_BINARY(add_saturate)
+GREX_NNVECTOR_BINARY(subtract_saturate)
+GREX_NNVECTOR_BINARY(average_round)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/arithmetic-narrow.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_NARROW_HPP
@@ -0,0 +1,168 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_WIDE_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_WIDE_HPP
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/operations/arithmetic.hpp"
+#include "grex/backend/x86/operations/merge.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Double-width products.
+// The products of the lower and upper halves of each 128-bit lane are computed separately,
+// as this is what the unpack instructions provide, and are then put into order.
+// 8 bit: 16-bit products of the sign-/zero-extended elements
+#define GREX_MULWIDE_EXTLO_u(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_unpacklo_epi8(X, BITPREFIX##_setzero_si##REGISTERBITS())
+#define GREX_MULWIDE_EXTHI_u(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_unpackhi_epi8(X, BITPREFIX##_setzero_si##REGISTERBITS())
+#define GREX_MULWIDE_EXTLO_i(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_srai_epi16(BITPREFIX##_unpacklo_epi8(X, X), 8)
+#define GREX_MULWIDE_EXTHI_i(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_srai_epi16(BITPREFIX##_unpackhi_epi8(X, X), 8)
+#define GREX_MULWIDE_PREP_8(KIND, BITPREFIX, REGISTERBITS)
+#define GREX_MULWIDE_R0_8(KIND, BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_mullo_epi16(GREX_MULWIDE_EXTLO_##KIND(BITPREFIX, REGISTERBITS, a.r), \
+                          GREX_MULWIDE_EXTLO_##KIND(BITPREFIX, REGISTERBITS, b.r))
+#define GREX_MULWIDE_R1_8(KIND, BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_mullo_epi16(GREX_MULWIDE_EXTHI_##KIND(BITPREFIX, REGISTERBITS, a.r), \
+                          GREX_MULWIDE_EXTHI_##KIND(BITPREFIX, REGISTERBITS, b.r))
+// 16 bit: Interleave the lower and upper halves of the products
+#define GREX_MULWIDE_PREP_16(KIND, BITPREFIX, REGISTERBITS) \
+  const auto lo = BITPREFIX##_mullo_epi16(a.r, b.r); \
+  const auto hi = GREX_MULHI_INT16_##KIND(BITPREFIX)(a.r, b.r);
+#define GREX_MULWIDE_R0_16(KIND, BITPREFIX, REGISTERBITS) BITPREFIX##_unpacklo_epi16(lo, hi)
+#define GREX_MULWIDE_R1_16(KIND, BITPREFIX, REGISTERBITS) BITPREFIX##_unpackhi_epi16(lo, hi)
+// 32 bit: Interleave the 32×32→64 bit products of the even-numbered and odd-numbered elements.
+// Signed multiplication requires level 2, the unsigned products are corrected otherwise.
+#define GREX_MULWIDE_EVENODD(BITPREFIX, MUL) \
+  const auto even = BITPREFIX##_##MUL(a.r, b.r); \
+  const auto odd = \
+    BITPREFIX##_##MUL(BITPREFIX##_srli_epi64(a.r, 32), BITPREFIX##_srli_epi64(b.r, 32));
+#define GREX_MULWIDE_EVENODD_u(BITPREFIX) GREX_MULWIDE_EVENODD(BITPREFIX, mul_epu32)
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_MULWIDE_EVENODD_i(BITPREFIX) GREX_MULWIDE_EVENODD(BITPREFIX, mul_epi32)
+#else
+#define GREX_MULWIDE_EVENODD_i(BITPREFIX) \
+  const auto evenu = _mm_mul_epu32(a.r, b.r); \
+  const auto oddu = _mm_mul_epu32(_mm_srli_epi64(a.r, 32), _mm_srli_epi64(b.r, 32)); \
+  /* subtract 2^32·b if a < 0 and 2^32·a if b < 0 */ \
+  const auto corr = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a.r, 31), b.r), \
+                                  _mm_and_si128(_mm_srai_epi32(b.r, 31), a.r)); \
+  const auto even = _mm_sub_epi64(evenu, _mm_slli_epi64(corr, 32)); \
+  const auto odd = \
+    _mm_sub_epi64(oddu, _mm_and_si128(corr, _mm_slli_epi64(_mm_set1_epi32(-1), 32)));
+#endif
+#define GREX_MULWIDE_PREP_32(KIND, BITPREFIX, REGISTERBITS) \
+  GREX_MULWIDE_EVENODD_##KIND(BITPREFIX)
+#define GREX_MULWIDE_R0_32(KIND, BITPREFIX, REGISTERBITS) BITPREFIX##_unpacklo_epi64(even, odd)
+#define GREX_MULWIDE_R1_32(KIND, BITPREFIX, REGISTERBITS) BITPREFIX##_unpackhi_epi64(even, odd)
+
+// Put the products into order: [r0₀, r1₀, r0₁, r1₁, …] for the 128-bit lanes r0ᵢ and r1ᵢ
+#define GREX_MULWIDE_ORDER_128 \
+  const auto lower = r0; \
+  const auto upper = r1;
+#define GREX_MULWIDE_ORDER_256 \
+  const auto lower = _mm256_permute2x128_si256(r0, r1, 0x20); \
+  const auto upper = _mm256_permute2x128_si256(r0, r1, 0x31);
+#define GREX_MULWIDE_ORDER_512 \
+  const auto lower = \
+    _mm512_permutex2var_epi64(r0, _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0), r1); \
+  const auto upper = \
+    _mm512_permutex2var_epi64(r0, _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4), r1);
+
+#define GREX_MULWIDE(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline VectorFor<WideInt<KIND##BITS>, SIZE> multiply_wide(NativeVector<KIND##BITS, SIZE> a, \
+                                                            NativeVector<KIND##BITS, SIZE> b) { \
+    using Half = NativeVector<WideInt<KIND##BITS>, GREX_DIVIDE(SIZE, 2)>; \
+    GREX_MULWIDE_PREP_##BITS(KIND, BITPREFIX, REGISTERBITS) \
+    const auto r0 = GREX_MULWIDE_R0_##BITS(KIND, BITPREFIX, REGISTERBITS); \
+    const auto r1 = GREX_MULWIDE_R1_##BITS(KIND, BITPREFIX, REGISTERBITS); \
+    GREX_MULWIDE_ORDER_##REGISTERBITS \
+    return merge(Half{.r = lower}, Half{.r = upper}); \
+  }
+#define GREX_MULWIDE_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_WIDENABLE_INT_TYPE(GREX_MULWIDE, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_MULWIDE_ALL)
+
+// The products of the lower half of a 128-bit vector, as needed for sub-native vectors
+#define GREX_MULWIDE_LOWER(KIND, BITS, SIZE) \
+  inline NativeVector<WideInt<KIND##BITS>, GREX_DIVIDE(SIZE, 2)> multiply_wide_lower( \
+    NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    GREX_MULWIDE_PREP_##BITS(KIND, _mm, 128) \
+    return {.r = GREX_MULWIDE_R0_##BITS(KIND, _mm, 128)}; \
+  }
+GREX_FOREACH_WIDENABLE_INT_TYPE(GREX_MULWIDE_LOWER, 128)
+
+// Sums of the double-width products of adjacent elements, wrapping around on overflow
+// 8 bit: 16-bit products of the sign-/zero-extended even-numbered and odd-numbered elements
+#define GREX_MULADDPAIRS_8(KIND, BITPREFIX, REGISTERBITS) \
+  const auto muleven = \
+    BITPREFIX##_mullo_epi16(GREX_MULHI_EVEN_##KIND(BITPREFIX, REGISTERBITS, a.r), \
+                            GREX_MULHI_EVEN_##KIND(BITPREFIX, REGISTERBITS, b.r)); \
+  const auto mulodd = BITPREFIX##_mullo_epi16(GREX_MULHI_ODD_##KIND(BITPREFIX, a.r), \
+                                              GREX_MULHI_ODD_##KIND(BITPREFIX, b.r)); \
+  return {.r = BITPREFIX##_add_epi16(muleven, mulodd)};
+// 16 bit: pmaddwd for signed integers, the unsigned products are assembled from their halves
+#define GREX_MULADDPAIRS_i16(BITPREFIX, REGISTERBITS) \
+  return {.r = BITPREFIX##_madd_epi16(a.r, b.r)};
+#define GREX_MULADDPAIRS_u16(BITPREFIX, REGISTERBITS) \
+  GREX_MULWIDE_PREP_16(u, BITPREFIX, REGISTERBITS) \
+  const auto lomask = BITPREFIX##_set1_epi32(0xFFFF); \
+  const auto muleven = BITPREFIX##_or_si##REGISTERBITS( \
+    BITPREFIX##_and_si##REGISTERBITS(lo, lomask), BITPREFIX##_slli_epi32(hi, 16)); \
+  const auto mulodd = BITPREFIX##_or_si##REGISTERBITS( \
+    BITPREFIX##_srli_epi32(lo, 16), BITPREFIX##_andnot_si##REGISTERBITS(lomask, hi)); \
+  return {.r = BITPREFIX##_add_epi32(muleven, mulodd)};
+#define GREX_MULADDPAIRS_16(KIND, BITPREFIX, REGISTERBITS) \
+  GREX_MULADDPAIRS_##KIND##16(BITPREFIX, REGISTERBITS)
+// 32 bit: Add the 32×32→64 bit products of the even-numbered and odd-numbered elements
+#define GREX_MULADDPAIRS_32(KIND, BITPREFIX, REGISTERBITS) \
+  GREX_MULWIDE_EVENODD_##KIND(BITPREFIX) \
+  return {.r = BITPREFIX##_add_epi64(even, odd)};
+
+#define GREX_MULADDPAIRS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<WideInt<KIND##BITS>, GREX_DIVIDE(SIZE, 2)> multiply_add_pairs( \
+    NativeVector<KIND##BITS, SIZE> a, NativeVector<KIND##BITS, SIZE> b) { \
+    GREX_MULADDPAIRS_##BITS(KIND, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_MULADDPAIRS_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_WIDENABLE_INT_TYPE(GREX_MULADDPAIRS, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_MULADDPAIRS_ALL)
+
+// Sums of the 16-bit products of adjacent unsigned and signed 8-bit elements, which saturate.
+// pmaddubsw requires level 2, level 1 multiplies the zero-/sign-extended elements instead,
+// whose products always fit into 16 bits.
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_MULADDPAIRS_US8(BITPREFIX, REGISTERBITS) BITPREFIX##_maddubs_epi16(a.r, b.r)
+#else
+#define GREX_MULADDPAIRS_US8(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_adds_epi16( \
+    BITPREFIX##_mullo_epi16(GREX_MULHI_EVEN_u(BITPREFIX, REGISTERBITS, a.r), \
+                            GREX_MULHI_EVEN_i(BITPREFIX, REGISTERBITS, b.r)), \
+    BITPREFIX##_mullo_epi16(GREX_MULHI_ODD_u(BITPREFIX, a.r), GREX_MULHI_ODD_i(BITPREFIX, b.r)))
+#endif
+#define GREX_MULADDPAIRS_US(REGISTERBITS, BITPREFIX) \
+  inline NativeVector<i16, GREX_DIVIDE(REGISTERBITS, 16)> multiply_add_pairs( \
+    NativeVector<u8, GREX_DIVIDE(REGISTERBITS, 8)> a, \
+    NativeVector<i8, GREX_DIVIDE(REGISTERBITS, 8)> b) { \
+    return {.r = GREX_MULADDPAIRS_US8(BITPREFIX, REGISTERBITS)}; \
+  }
+GREX_FOREACH_X86_64_LEVEL(GREX_MULADDPAIRS_US)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/arithmetic-wide.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_ARITHMETIC_WIDE_HPP
@@ -130,6 +130,104 @@ namespace grex::backend {
   }
 #define GREX_MUL_ALL(REGISTERBITS, BITPREFIX) GREX_FOREACH_TYPE(GREX_MUL, REGISTERBITS, BITPREFIX)
 
+// Upper half of the double-width integer product
+// 8 bit: No intrinsic, two 16 bit multiplications of the sign-/zero-extended even-numbered
+// and odd-numbered elements, respectively.
+#define GREX_MULHI_EVEN_u(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_and_si##REGISTERBITS(X, BITPREFIX##_set1_epi16(0x00FF))
+#define GREX_MULHI_EVEN_i(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_srai_epi16(BITPREFIX##_slli_epi16(X, 8), 8)
+#define GREX_MULHI_ODD_u(BITPREFIX, X) BITPREFIX##_srli_epi16(X, 8)
+#define GREX_MULHI_ODD_i(BITPREFIX, X) BITPREFIX##_srai_epi16(X, 8)
+#define GREX_MULHI_INT8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  /* products of the even-numbered elements, whose upper halves are moved into place */ \
+  const auto muleven = \
+    BITPREFIX##_mullo_epi16(GREX_MULHI_EVEN_##KIND(BITPREFIX, REGISTERBITS, a.r), \
+                            GREX_MULHI_EVEN_##KIND(BITPREFIX, REGISTERBITS, b.r)); \
+  const auto hieven = BITPREFIX##_srli_epi16(muleven, 8); \
+  /* products of the odd-numbered elements, whose upper halves are already in place */ \
+  const auto mulodd = BITPREFIX##_mullo_epi16(GREX_MULHI_ODD_##KIND(BITPREFIX, a.r), \
+                                              GREX_MULHI_ODD_##KIND(BITPREFIX, b.r)); \
+  const auto hiodd = \
+    BITPREFIX##_and_si##REGISTERBITS(mulodd, BITPREFIX##_set1_epi16(i16(0xFF00))); \
+  return {.r = BITPREFIX##_or_si##REGISTERBITS(hieven, hiodd)};
+// 16 bit: Use the existing intrinsics
+#define GREX_MULHI_INT16_u(BITPREFIX) BITPREFIX##_mulhi_epu16
+#define GREX_MULHI_INT16_i(BITPREFIX) BITPREFIX##_mulhi_epi16
+#define GREX_MULHI_INT16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_MULHI_INT16_##KIND(BITPREFIX)(a.r, b.r)};
+// 32 bit: Two 32×32→64 bit multiplications of the even-numbered and odd-numbered elements,
+// whose upper halves are combined. Signed multiplication requires level 2, the unsigned
+// product is corrected otherwise.
+#define GREX_MULHI_INT32_BASE(BITPREFIX, REGISTERBITS, MUL) \
+  /* [a0 * b0, a2 * b2, …] (32×32→64 bit) */ \
+  const auto muleven = BITPREFIX##_##MUL(a.r, b.r); \
+  /* [a1 * b1, a3 * b3, …] (32×32→64 bit) */ \
+  const auto mulodd = \
+    BITPREFIX##_##MUL(BITPREFIX##_srli_epi64(a.r, 32), BITPREFIX##_srli_epi64(b.r, 32)); \
+  const auto himask = BITPREFIX##_slli_epi64(BITPREFIX##_set1_epi32(-1), 32); \
+  const auto hi = BITPREFIX##_or_si##REGISTERBITS( \
+    BITPREFIX##_srli_epi64(muleven, 32), BITPREFIX##_and_si##REGISTERBITS(mulodd, himask));
+#define GREX_MULHI_u32(BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_INT32_BASE(BITPREFIX, REGISTERBITS, mul_epu32) \
+  return {.r = hi};
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_MULHI_i32(BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_INT32_BASE(BITPREFIX, REGISTERBITS, mul_epi32) \
+  return {.r = hi};
+#else
+#define GREX_MULHI_i32(BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_INT32_BASE(BITPREFIX, REGISTERBITS, mul_epu32) \
+  /* subtract b if a < 0 and a if b < 0 */ \
+  const auto corra = _mm_and_si128(_mm_srai_epi32(a.r, 31), b.r); \
+  const auto corrb = _mm_and_si128(_mm_srai_epi32(b.r, 31), a.r); \
+  return {.r = _mm_sub_epi32(hi, _mm_add_epi32(corra, corrb))};
+#endif
+#define GREX_MULHI_INT32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_##KIND##32(BITPREFIX, REGISTERBITS)
+// 64 bit: No intrinsic, schoolbook multiplication using four 32×32→64 bit multiplications.
+// The signed product is obtained by correcting the unsigned product.
+#define GREX_MULHI_INT64_BASE(BITPREFIX, REGISTERBITS) \
+  const auto ah = BITPREFIX##_srli_epi64(a.r, 32); \
+  const auto bh = BITPREFIX##_srli_epi64(b.r, 32); \
+  const auto lomask = BITPREFIX##_srli_epi64(BITPREFIX##_set1_epi32(-1), 32); \
+  /* the partial products */ \
+  const auto ll = BITPREFIX##_mul_epu32(a.r, b.r); \
+  const auto lh = BITPREFIX##_mul_epu32(a.r, bh); \
+  const auto hl = BITPREFIX##_mul_epu32(ah, b.r); \
+  const auto hh = BITPREFIX##_mul_epu32(ah, bh); \
+  /* middle sums, which cannot overflow */ \
+  const auto t = BITPREFIX##_add_epi64(hl, BITPREFIX##_srli_epi64(ll, 32)); \
+  const auto w = \
+    BITPREFIX##_add_epi64(BITPREFIX##_and_si##REGISTERBITS(t, lomask), lh); \
+  const auto hi = BITPREFIX##_add_epi64( \
+    BITPREFIX##_add_epi64(hh, BITPREFIX##_srli_epi64(t, 32)), BITPREFIX##_srli_epi64(w, 32));
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_MULHI_SIGN64(BITPREFIX, X) BITPREFIX##_srai_epi64(X, 63)
+#else
+#define GREX_MULHI_SIGN64(BITPREFIX, X) \
+  BITPREFIX##_srai_epi32(BITPREFIX##_shuffle_epi32(X, 0xF5), 31)
+#endif
+#define GREX_MULHI_u64(BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_INT64_BASE(BITPREFIX, REGISTERBITS) \
+  return {.r = hi};
+#define GREX_MULHI_i64(BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_INT64_BASE(BITPREFIX, REGISTERBITS) \
+  /* subtract b if a < 0 and a if b < 0 */ \
+  const auto corra = BITPREFIX##_and_si##REGISTERBITS(GREX_MULHI_SIGN64(BITPREFIX, a.r), b.r); \
+  const auto corrb = BITPREFIX##_and_si##REGISTERBITS(GREX_MULHI_SIGN64(BITPREFIX, b.r), a.r); \
+  return {.r = BITPREFIX##_sub_epi64(hi, BITPREFIX##_add_epi64(corra, corrb))};
+#define GREX_MULHI_INT64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_MULHI_##KIND##64(BITPREFIX, REGISTERBITS)
+
+#define GREX_MULHI(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> multiply_high(NativeVector<KIND##BITS, SIZE> a, \
+                                                      NativeVector<KIND##BITS, SIZE> b) { \
+    GREX_MULHI_INT##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_MULHI_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE(GREX_MULHI, REGISTERBITS, BITPREFIX, REGISTERBITS)
+
 // Floating-point division (integer division is not available because it is very slow)
 #define GREX_DIV_ALL(REGISTERBITS, BITPREFIX) \
   GREX_FOREACH_FP_TYPE(GREX_ARITH_BASE, REGISTERBITS, divide, BITPREFIX##_div)
@@ -137,12 +235,14 @@ namespace grex::backend {
 GREX_FOREACH_X86_64_LEVEL(GREX_NEGATE_ALL)
 GREX_FOREACH_X86_64_LEVEL(GREX_ADDSUB_ALL)
 GREX_FOREACH_X86_64_LEVEL(GREX_MUL_ALL)
+GREX_FOREACH_X86_64_LEVEL(GREX_MULHI_ALL)
 GREX_FOREACH_X86_64_LEVEL(GREX_DIV_ALL)
 
 GREX_NNVECTOR_UNARY(negate)
 GREX_NNVECTOR_BINARY(add)
 GREX_NNVECTOR_BINARY(subtract)
 GREX_NNVECTOR_BINARY(multiply)
+GREX_NNVECTOR_BINARY(multiply_high)
 GREX_NNVECTOR_BINARY(divide)
 } // namespace grex::backend
 
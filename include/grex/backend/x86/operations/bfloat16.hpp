@@ -0,0 +1,44 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_BFLOAT16_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_BFLOAT16_HPP
+
+#include <bit>
+
+#include <immintrin.h>
+
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+#include "grex/backend/x86/types.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/bfloat16.hpp" // IWYU pragma: export
+
+// VDPBF16PS computes both products of each pair and adds them to the accumulator.
+// Subnormal inputs and outputs are flushed to zero and the rounding mode is nearest-even,
+// independently of MXCSR.
+
+namespace grex::backend {
+#if GREX_HAS_AVX512BF16
+inline f32x4 dot_accumulate(u32x4 a, u32x4 b, f32x4 acc) {
+  return {.r = _mm_dpbf16_ps(acc.r, std::bit_cast<__m128bh>(a.r), std::bit_cast<__m128bh>(b.r))};
+}
+inline f32x8 dot_accumulate(u32x8 a, u32x8 b, f32x8 acc) {
+  return {
+    .r = _mm256_dpbf16_ps(acc.r, std::bit_cast<__m256bh>(a.r), std::bit_cast<__m256bh>(b.r)),
+  };
+}
+inline f32x16 dot_accumulate(u32x16 a, u32x16 b, f32x16 acc) {
+  return {
+    .r = _mm512_dpbf16_ps(acc.r, std::bit_cast<__m512bh>(a.r), std::bit_cast<__m512bh>(b.r)),
+  };
+}
+#endif
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_BFLOAT16_HPP
@@ -0,0 +1,259 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_BIT_MANIPULATION_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_BIT_MANIPULATION_HPP
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/macros/types.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/operations/set.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Byte shuffles operate on 128-bit lanes, which is why lookup tables are repeated for each lane
+#define GREX_BITMANIP_TABLE_128(...) _mm_setr_epi8(__VA_ARGS__)
+#define GREX_BITMANIP_TABLE_256(...) _mm256_broadcastsi128_si256(_mm_setr_epi8(__VA_ARGS__))
+#define GREX_BITMANIP_TABLE_512(...) _mm512_broadcast_i32x4(_mm_setr_epi8(__VA_ARGS__))
+// The lower and upper nibbles of the bytes, which are used as indices into the tables
+#define GREX_BITMANIP_NIBBLES(BITPREFIX, REGISTERBITS) \
+  const auto nibble_mask = BITPREFIX##_set1_epi8(0x0F); \
+  const auto lo = BITPREFIX##_and_si##REGISTERBITS(v.r, nibble_mask); \
+  const auto hi = BITPREFIX##_and_si##REGISTERBITS(BITPREFIX##_srli_epi16(v.r, 4), nibble_mask);
+// The wider types operate on the bytes of the register
+#define GREX_BITMANIP_BYTES(NAME, REGISTERBITS) \
+  NAME(NativeVector<u8, REGISTERBITS / 8>{.r = v.r}).r
+
+// Population count
+// 8 bit: Native with BITALG, the counts of the nibbles are looked up from level 2,
+// the bits are counted in parallel within each byte at level 1
+#if GREX_HAS_AVX512BITALG
+#define GREX_POPCNT_8(KIND, BITPREFIX, REGISTERBITS) return {.r = BITPREFIX##_popcnt_epi8(v.r)};
+#elif GREX_X86_64_LEVEL >= 2
+#define GREX_POPCNT_8(KIND, BITPREFIX, REGISTERBITS) \
+  const auto table = \
+    GREX_BITMANIP_TABLE_##REGISTERBITS(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4); \
+  GREX_BITMANIP_NIBBLES(BITPREFIX, REGISTERBITS) \
+  return {.r = BITPREFIX##_add_epi8(BITPREFIX##_shuffle_epi8(table, lo), \
+                                    BITPREFIX##_shuffle_epi8(table, hi))};
+#else
+#define GREX_POPCNT_8(KIND, BITPREFIX, REGISTERBITS) \
+  /* the counts of the bit pairs, the nibbles, and the bytes */ \
+  const auto m1 = _mm_set1_epi8(0x55); \
+  const auto m2 = _mm_set1_epi8(0x33); \
+  const auto c2 = _mm_sub_epi8(v.r, _mm_and_si128(_mm_srli_epi16(v.r, 1), m1)); \
+  const auto c4 = _mm_add_epi8(_mm_and_si128(c2, m2), _mm_and_si128(_mm_srli_epi16(c2, 2), m2)); \
+  return {.r = _mm_and_si128(_mm_add_epi8(c4, _mm_srli_epi16(c4, 4)), _mm_set1_epi8(0x0F))};
+#endif
+// 16 bit: Native with BITALG, otherwise the sum of the byte counts
+#if GREX_HAS_AVX512BITALG
+#define GREX_POPCNT_16(KIND, BITPREFIX, REGISTERBITS) return {.r = BITPREFIX##_popcnt_epi16(v.r)};
+#elif GREX_X86_64_LEVEL >= 2
+#define GREX_POPCNT_16(KIND, BITPREFIX, REGISTERBITS) \
+  const auto bytes = GREX_BITMANIP_BYTES(popcount, REGISTERBITS); \
+  return {.r = BITPREFIX##_maddubs_epi16(bytes, BITPREFIX##_set1_epi8(1))};
+#else
+#define GREX_POPCNT_16(KIND, BITPREFIX, REGISTERBITS) \
+  const auto bytes = GREX_BITMANIP_BYTES(popcount, REGISTERBITS); \
+  return {.r = _mm_add_epi16(_mm_srli_epi16(bytes, 8), _mm_and_si128(bytes, _mm_set1_epi16(0xFF)))};
+#endif
+// 32/64 bit: Native with VPOPCNTDQ, otherwise the sum of the 16-bit or byte counts
+#if GREX_HAS_AVX512VPOPCNTDQ
+#define GREX_POPCNT_32(KIND, BITPREFIX, REGISTERBITS) return {.r = BITPREFIX##_popcnt_epi32(v.r)};
+#define GREX_POPCNT_64(KIND, BITPREFIX, REGISTERBITS) return {.r = BITPREFIX##_popcnt_epi64(v.r)};
+#else
+#define GREX_POPCNT_32(KIND, BITPREFIX, REGISTERBITS) \
+  const auto halves = popcount(NativeVector<u16, REGISTERBITS / 16>{.r = v.r}).r; \
+  return {.r = BITPREFIX##_madd_epi16(halves, BITPREFIX##_set1_epi16(1))};
+#define GREX_POPCNT_64(KIND, BITPREFIX, REGISTERBITS) \
+  const auto bytes = GREX_BITMANIP_BYTES(popcount, REGISTERBITS); \
+  return {.r = BITPREFIX##_sad_epu8(bytes, BITPREFIX##_setzero_si##REGISTERBITS())};
+#endif
+
+#define GREX_POPCNT(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> popcount(NativeVector<KIND##BITS, SIZE> v) { \
+    GREX_POPCNT_##BITS(KIND, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_POPCNT_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE_ASC(GREX_POPCNT, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_POPCNT_ALL)
+GREX_NNVECTOR_UNARY(popcount)
+
+// Leading zero count
+// 8/16 bit from level 2: Look up the counts of the nibbles, with the upper nibble taking
+// precedence unless it is zero, and combine the counts of the bytes in the same way
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_CLZ_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##8, SIZE> countl_zero(NativeVector<KIND##8, SIZE> v) { \
+    const auto table_hi = \
+      GREX_BITMANIP_TABLE_##REGISTERBITS(8, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0); \
+    const auto table_lo = \
+      GREX_BITMANIP_TABLE_##REGISTERBITS(8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4); \
+    GREX_BITMANIP_NIBBLES(BITPREFIX, REGISTERBITS) \
+    return {.r = BITPREFIX##_min_epu8(BITPREFIX##_shuffle_epi8(table_hi, hi), \
+                                      BITPREFIX##_shuffle_epi8(table_lo, lo))}; \
+  }
+#define GREX_CLZ_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##16, SIZE> countl_zero(NativeVector<KIND##16, SIZE> v) { \
+    const auto bytes = GREX_BITMANIP_BYTES(countl_zero, REGISTERBITS); \
+    /* map an upper count of 8 to 16, which exceeds the lower count plus 8 */ \
+    const auto upper8 = BITPREFIX##_and_si##REGISTERBITS(bytes, BITPREFIX##_set1_epi16(0x0800)); \
+    const auto adjusted = BITPREFIX##_add_epi8(bytes, upper8); \
+    const auto lower = BITPREFIX##_and_si##REGISTERBITS(adjusted, BITPREFIX##_set1_epi16(0xFF)); \
+    return {.r = BITPREFIX##_min_epu16(BITPREFIX##_srli_epi16(adjusted, 8), \
+                                       BITPREFIX##_add_epi16(lower, BITPREFIX##_set1_epi16(8)))}; \
+  }
+#else
+#define GREX_CLZ_8(...)
+#define GREX_CLZ_16(...)
+#endif
+// 32/64 bit: Native with AVX-512CD
+#if GREX_HAS_AVX512CD
+#define GREX_CLZ_WIDE(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> countl_zero(NativeVector<KIND##BITS, SIZE> v) { \
+    return {.r = BITPREFIX##_lzcnt_epi##BITS(v.r)}; \
+  }
+#define GREX_CLZ_32 GREX_CLZ_WIDE
+#define GREX_CLZ_64 GREX_CLZ_WIDE
+#else
+#define GREX_CLZ_32(...)
+#define GREX_CLZ_64(...)
+#endif
+// The other cases are handled by the fallback in terms of the population count
+#define GREX_CLZ(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_CLZ_##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS)
+#define GREX_CLZ_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE_ASC(GREX_CLZ, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_CLZ_ALL)
+
+// Trailing zero count
+// 32/64 bit with AVX-512CD, but without VPOPCNTDQ: The trailing zeros are the lowest set bits of
+// (v - 1) & ~v, whose leading zeros are cheaper to count than their population.
+// All other cases are handled by the fallback in terms of the population count.
+#if GREX_HAS_AVX512CD && !GREX_HAS_AVX512VPOPCNTDQ
+#define GREX_CTZ(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> countr_zero(NativeVector<KIND##BITS, SIZE> v) { \
+    using Vec = NativeVector<KIND##BITS, SIZE>; \
+    const auto ones = broadcast(KIND##BITS{1}, type_tag<Vec>).r; \
+    const auto trailing = \
+      BITPREFIX##_andnot_si##REGISTERBITS(v.r, BITPREFIX##_sub_epi##BITS(v.r, ones)); \
+    return {.r = BITPREFIX##_sub_epi##BITS(broadcast(KIND##BITS{BITS}, type_tag<Vec>).r, \
+                                           BITPREFIX##_lzcnt_epi##BITS(trailing))}; \
+  }
+#define GREX_CTZ_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_CTZ(u, 32, GREX_DIVIDE(REGISTERBITS, 32), BITPREFIX, REGISTERBITS) \
+  GREX_CTZ(i, 32, GREX_DIVIDE(REGISTERBITS, 32), BITPREFIX, REGISTERBITS) \
+  GREX_CTZ(u, 64, GREX_DIVIDE(REGISTERBITS, 64), BITPREFIX, REGISTERBITS) \
+  GREX_CTZ(i, 64, GREX_DIVIDE(REGISTERBITS, 64), BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_CTZ_ALL)
+#endif
+
+// Reversal of the bytes within each element
+// Byte shuffles from level 2, shifts and 16-bit shuffles at level 1
+#define GREX_BYTESWAP_TABLE_16 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+#define GREX_BYTESWAP_TABLE_32 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+#define GREX_BYTESWAP_TABLE_64 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+#define GREX_BYTESWAP_SWAP16(X) _mm_or_si128(_mm_slli_epi16(X, 8), _mm_srli_epi16(X, 8))
+#define GREX_BYTESWAP_SHUFFLE16(X, IMM) _mm_shufflehi_epi16(_mm_shufflelo_epi16(X, IMM), IMM)
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_BYTESWAP_IMPL(BITS, BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_shuffle_epi8( \
+    v.r, GREX_BITMANIP_TABLE_##REGISTERBITS(GREX_BYTESWAP_TABLE_##BITS))
+#else
+#define GREX_BYTESWAP_IMPL_16 GREX_BYTESWAP_SWAP16(v.r)
+#define GREX_BYTESWAP_IMPL_32 GREX_BYTESWAP_SWAP16(GREX_BYTESWAP_SHUFFLE16(v.r, 0xB1))
+#define GREX_BYTESWAP_IMPL_64 GREX_BYTESWAP_SWAP16(GREX_BYTESWAP_SHUFFLE16(v.r, 0x1B))
+#define GREX_BYTESWAP_IMPL(BITS, BITPREFIX, REGISTERBITS) GREX_BYTESWAP_IMPL_##BITS
+#endif
+#define GREX_BYTESWAP_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##8, SIZE> byteswap(NativeVector<KIND##8, SIZE> v) { \
+    return v; \
+  }
+#define GREX_BYTESWAP_WIDE(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> byteswap(NativeVector<KIND##BITS, SIZE> v) { \
+    return {.r = GREX_BYTESWAP_IMPL(BITS, BITPREFIX, REGISTERBITS)}; \
+  }
+#define GREX_BYTESWAP_16 GREX_BYTESWAP_WIDE
+#define GREX_BYTESWAP_32 GREX_BYTESWAP_WIDE
+#define GREX_BYTESWAP_64 GREX_BYTESWAP_WIDE
+#define GREX_BYTESWAP(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_BYTESWAP_##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS)
+#define GREX_BYTESWAP_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE(GREX_BYTESWAP, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_BYTESWAP_ALL)
+GREX_NNVECTOR_UNARY(byteswap)
+
+// Bit reversal
+// 8 bit: An affine transformation over GF(2) with GFNI, the bit reversals of the nibbles are
+// looked up from level 2, and the bits are swapped in parallel within each byte at level 1.
+// GFNI is chosen per register width, as its 256/512-bit forms also need AVX/AVX-512.
+#define GREX_BITREV_8_GFNI(BITPREFIX, REGISTERBITS) \
+  const auto matrix = \
+    broadcast(u64{0x8040201008040201}, type_tag<NativeVector<u64, REGISTERBITS / 64>>).r; \
+  return {.r = BITPREFIX##_gf2p8affine_epi64_epi8(v.r, matrix, 0)};
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_BITREV_8_BASE(BITPREFIX, REGISTERBITS) \
+  const auto table = \
+    GREX_BITMANIP_TABLE_##REGISTERBITS(0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15); \
+  GREX_BITMANIP_NIBBLES(BITPREFIX, REGISTERBITS) \
+  /* the reversed lower nibble becomes the upper nibble, which does not overflow the byte */ \
+  return {.r = BITPREFIX##_or_si##REGISTERBITS( \
+            BITPREFIX##_slli_epi16(BITPREFIX##_shuffle_epi8(table, lo), 4), \
+            BITPREFIX##_shuffle_epi8(table, hi))};
+#else
+#define GREX_BITREV_SWAP(X, OFFSET, MASK) \
+  _mm_or_si128(_mm_and_si128(_mm_srli_epi16(X, OFFSET), _mm_set1_epi8(MASK)), \
+               _mm_slli_epi16(_mm_and_si128(X, _mm_set1_epi8(MASK)), OFFSET))
+#define GREX_BITREV_8_BASE(BITPREFIX, REGISTERBITS) \
+  /* swap adjacent bits, then adjacent bit pairs, and finally the nibbles */ \
+  const auto swap1 = GREX_BITREV_SWAP(v.r, 1, 0x55); \
+  const auto swap2 = GREX_BITREV_SWAP(swap1, 2, 0x33); \
+  return {.r = GREX_BITREV_SWAP(swap2, 4, 0x0F)};
+#endif
+#if GREX_HAS_GFNI
+#define GREX_BITREV_8_128 GREX_BITREV_8_GFNI
+#else
+#define GREX_BITREV_8_128 GREX_BITREV_8_BASE
+#endif
+#if GREX_HAS_GFNI && GREX_X86_64_LEVEL >= 3
+#define GREX_BITREV_8_256 GREX_BITREV_8_GFNI
+#else
+#define GREX_BITREV_8_256 GREX_BITREV_8_BASE
+#endif
+#if GREX_HAS_GFNI && GREX_X86_64_LEVEL >= 4
+#define GREX_BITREV_8_512 GREX_BITREV_8_GFNI
+#else
+#define GREX_BITREV_8_512 GREX_BITREV_8_BASE
+#endif
+#define GREX_BITREV_8(BITPREFIX, REGISTERBITS) \
+  GREX_BITREV_8_##REGISTERBITS(BITPREFIX, REGISTERBITS)
+// Wider types: Reverse the bits within each byte and the bytes within each element
+#define GREX_BITREV_WIDE(BITPREFIX, REGISTERBITS) \
+  const auto bytes = GREX_BITMANIP_BYTES(bit_reverse, REGISTERBITS); \
+  return byteswap(decltype(v){.r = bytes});
+#define GREX_BITREV_IMPL_8 GREX_BITREV_8
+#define GREX_BITREV_IMPL_16 GREX_BITREV_WIDE
+#define GREX_BITREV_IMPL_32 GREX_BITREV_WIDE
+#define GREX_BITREV_IMPL_64 GREX_BITREV_WIDE
+#define GREX_BITREV(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> bit_reverse(NativeVector<KIND##BITS, SIZE> v) { \
+    GREX_BITREV_IMPL_##BITS(BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_BITREV_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE_ASC(GREX_BITREV, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_BITREV_ALL)
+GREX_NNVECTOR_UNARY(bit_reverse)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/bit-manipulation.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_BIT_MANIPULATION_HPP
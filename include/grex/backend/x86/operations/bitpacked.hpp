@@ -0,0 +1,81 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_BITPACKED_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_BITPACKED_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/bitpacked.hpp" // IWYU pragma: export
+
+// Bit-packed integers are gathered from and scattered to their bytes using PSHUFB,
+// while the fallback for level 1 loads and stores each lane separately.
+
+namespace grex::backend {
+#if GREX_X86_64_LEVEL >= 2
+inline __m128i bitpacked_indices(const std::array<i8, 16>& idxs) {
+  return static_apply<16>([&]<std::size_t... tIdxs> { return _mm_setr_epi8(idxs[tIdxs]...); });
+}
+
+template<std::size_t tBits, std::size_t tFirst, typename T, std::size_t tSize>
+requires(sizeof(T) * tSize == 16)
+inline NativeVector<T, tSize> bitpacked_windows_128(const u8* ptr, IndexTag<tBits> /*bits*/,
+                                                    IndexTag<tFirst> /*first*/,
+                                                    TypeTag<NativeVector<T, tSize>> /*tag*/) {
+  // e.g. B = 5: 00000111|11222223|33334444|4... → 00000111|11222223|·|33334444|4...|·|...
+  static constexpr auto idxs = bp::window_indices_128<sizeof(T), tBits, tFirst>;
+  const __m128i raw = load(ptr, type_tag<u8x16>).r;
+  return {.r = _mm_shuffle_epi8(raw, bitpacked_indices(idxs))};
+}
+
+template<std::size_t tBits, std::size_t tFirst, std::size_t tPart, typename T,
+         std::size_t tSize, bool tHigh>
+requires(sizeof(T) * tSize == 16)
+inline void store_bitpacked_128(u8* ptr, NativeVector<T, tSize> low, NativeVector<T, tSize> high,
+                                IndexTag<tBits> /*bits*/, IndexTag<tFirst> /*first*/,
+                                IndexTag<tPart> /*part*/, BoolTag<tHigh> /*has_high*/) {
+  static constexpr std::size_t groups = bp::group_count<tBits, tFirst, tPart>;
+  static constexpr std::size_t bytes = bp::byte_count<tBits, tFirst, tPart>;
+
+  // keep the bits before the first value
+  __m128i out = _mm_setzero_si128();
+  if constexpr (tFirst != 0) {
+    out = _mm_cvtsi32_si128(int(ptr[0] & ((1U << tFirst) - 1U)));
+  }
+  // lanes which do not share any bytes are scattered by the same shuffle
+  static_apply<groups>([&]<std::size_t... tGroups>() {
+    (..., (out = _mm_or_si128(
+             out, _mm_shuffle_epi8(low.r, bitpacked_indices(
+                                            bp::scatter_indices_128<sizeof(T), tBits, tFirst,
+                                                                    tPart, groups, tGroups>)))));
+  });
+  if constexpr (tHigh) {
+    static constexpr auto idxs = bp::high_indices_128<sizeof(T), tBits, tFirst, tPart>;
+    out = _mm_or_si128(out, _mm_shuffle_epi8(high.r, bitpacked_indices(idxs)));
+  }
+  store_part(ptr, u8x16{.r = out}, std::min<std::size_t>(bytes, 16));
+  if constexpr (bytes > 16) {
+    // only possible for 4 × 32-bit lanes, the last of which then ends in the next byte
+    ptr[16] = u8(_mm_extract_epi8(high.r, 15));
+  }
+}
+#endif
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_BITPACKED_HPP
@@ -0,0 +1,185 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_COMPRESS_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_COMPRESS_HPP
+
+#include <bit>
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/macros/intrinsics.hpp"
+#include "grex/backend/x86/operations/bitwise.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/mask-bits.hpp"
+#include "grex/backend/x86/operations/mask-index.hpp"
+#include "grex/backend/x86/operations/reinterpret.hpp"
+#include "grex/backend/x86/operations/split.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+#include "grex/backend/x86/operations/to-array.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+// shared definitions
+#include "grex/backend/shared/operations/compress.hpp" // IWYU pragma: export
+
+namespace grex::backend {
+// AVX-512: Use the compress instructions, which require AVX512-VBMI2 for 8 and 16 bits
+// SSSE3 and newer, 128 bit: Byte shuffle with a table entry selected by the mask bits
+// AVX2, 256 bit: 32/64 bits use a lane permutation, 8/16 bits compress both halves
+// SSE2: Compress one lane at a time
+
+#if GREX_X86_64_LEVEL >= 2
+// 8 bit: A table with 2^16 entries would be too big → compress both halves separately
+// and shift the compressed upper half behind the compressed lower half
+inline u8x16 compress_bytes(u64 bits, u8x16 v) {
+  const auto& table = compress_table<8, 1>;
+  const u64 lo = bits & 0xFFU;
+  const u64 hi = bits >> 8U;
+  const auto* entry_lo = reinterpret_cast<const __m128i*>(table[lo].data());
+  const auto* entry_hi = reinterpret_cast<const __m128i*>(table[hi].data());
+  // set the upper halves of the indices to 0x80 to zero them out
+  const __m128i pad = _mm_set1_epi8(i8(0x80));
+  const __m128i idxs_lo = _mm_unpacklo_epi64(_mm_loadl_epi64(entry_lo), pad);
+  const __m128i idxs_hi =
+    _mm_add_epi8(_mm_unpacklo_epi64(_mm_loadl_epi64(entry_hi), pad), _mm_set1_epi8(8));
+  const __m128i comp_lo = _mm_shuffle_epi8(v.r, idxs_lo);
+  const __m128i comp_hi = _mm_shuffle_epi8(v.r, idxs_hi);
+  // negative indices have the highest bit set, which leads to zeros
+  const __m128i shift =
+    _mm_sub_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                 _mm_set1_epi8(i8(std::popcount(lo))));
+  return {.r = _mm_or_si128(comp_lo, _mm_shuffle_epi8(comp_hi, shift))};
+}
+template<std::size_t tLaneBytes>
+inline u8x16 compress_bytes(u64 bits, u8x16 v) {
+  const auto& entry = compress_table<16 / tLaneBytes, tLaneBytes>[bits];
+  const __m128i idxs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entry.data()));
+  return {.r = _mm_shuffle_epi8(v.r, idxs)};
+}
+#endif
+
+#if GREX_X86_64_LEVEL >= 3
+// 32 bit: Widen the byte lane indices and permute, zeroing out the lanes with padded indices
+inline u32x8 compress_words(u64 bits, u32x8 v) {
+  const auto& entry = compress_table<8, 1>[bits];
+  const auto* ptr = reinterpret_cast<const __m128i*>(entry.data());
+  const __m256i idxs = _mm256_cvtepu8_epi32(_mm_loadl_epi64(ptr));
+  const __m256i perm = _mm256_permutevar8x32_epi32(v.r, idxs);
+  return {.r = _mm256_and_si256(perm, _mm256_cmpgt_epi32(_mm256_set1_epi32(8), idxs))};
+}
+// 64 bit: Duplicate each mask bit and permute pairs of 32-bit lanes
+inline u32x8 compress_words(u64 bits, u64x4 v) {
+  bits = (bits | (bits << 2U)) & 0x33U;
+  bits = (bits | (bits << 1U)) & 0x55U;
+  return compress_words(bits * 3U, as<u32>(v));
+}
+#endif
+
+#define GREX_COMPRESS_AVX512(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_CAT(BITPREFIX##_maskz_compress_, GREX_EPI_SUFFIX(KIND, BITS))(m.r, v.r)};
+#define GREX_COMPRESS_BYTES_8(KIND) return as<KIND##8>(compress_bytes(to_bits(m), as<u8>(v)));
+#define GREX_COMPRESS_BYTES(KIND, BITS, ...) \
+  return as<KIND##BITS>(compress_bytes<GREX_DIVIDE(BITS, 8)>(to_bits(m), as<u8>(v)));
+#define GREX_COMPRESS_WORDS(KIND, BITS, ...) \
+  return as<KIND##BITS>(compress_words(to_bits(m), as<u##BITS>(v)));
+#define GREX_COMPRESS_SPLIT(...) return compress_split(m, v);
+#define GREX_COMPRESS_FALLBACK(...) return compress_fallback(m, v);
+
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_COMPRESS_128_8(KIND, ...) GREX_COMPRESS_BYTES_8(KIND)
+#define GREX_COMPRESS_128_16 GREX_COMPRESS_BYTES
+#define GREX_COMPRESS_128_32 GREX_COMPRESS_BYTES
+#define GREX_COMPRESS_128_64 GREX_COMPRESS_BYTES
+#else
+#define GREX_COMPRESS_128_8 GREX_COMPRESS_FALLBACK
+#define GREX_COMPRESS_128_16 GREX_COMPRESS_FALLBACK
+#define GREX_COMPRESS_128_32 GREX_COMPRESS_FALLBACK
+#define GREX_COMPRESS_128_64 GREX_COMPRESS_FALLBACK
+#endif
+#define GREX_COMPRESS_256_8 GREX_COMPRESS_SPLIT
+#define GREX_COMPRESS_256_16 GREX_COMPRESS_SPLIT
+#define GREX_COMPRESS_256_32 GREX_COMPRESS_WORDS
+#define GREX_COMPRESS_256_64 GREX_COMPRESS_WORDS
+#define GREX_COMPRESS_512_8 GREX_COMPRESS_SPLIT
+#define GREX_COMPRESS_512_16 GREX_COMPRESS_SPLIT
+
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_COMPRESS_AVX512_32 GREX_COMPRESS_AVX512
+#define GREX_COMPRESS_AVX512_64 GREX_COMPRESS_AVX512
+#if GREX_HAS_AVX512VBMI2
+#define GREX_COMPRESS_AVX512_8 GREX_COMPRESS_AVX512
+#define GREX_COMPRESS_AVX512_16 GREX_COMPRESS_AVX512
+#else
+#define GREX_COMPRESS_AVX512_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_COMPRESS_##REGISTERBITS##_8(KIND, BITS, SIZE)
+#define GREX_COMPRESS_AVX512_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_COMPRESS_##REGISTERBITS##_16(KIND, BITS, SIZE)
+#endif
+#define GREX_COMPRESS_IMPL(KIND, BITS, ...) GREX_COMPRESS_AVX512_##BITS(KIND, BITS, __VA_ARGS__)
+#else
+#define GREX_COMPRESS_IMPL(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_COMPRESS_##REGISTERBITS##_##BITS(KIND, BITS, SIZE)
+#endif
+
+#define GREX_COMPRESS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> compress(NativeMask<KIND##BITS, SIZE> m, \
+                                                 NativeVector<KIND##BITS, SIZE> v) { \
+    GREX_COMPRESS_IMPL(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_COMPRESS_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_COMPRESS, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_COMPRESS_ALL)
+
+// AVX-512: Store the selected lanes directly
+// 8/16 bit beyond 128 bit without AVX512-VBMI2: Store both compressed halves separately
+// Otherwise: Compress and store the selected part (generic definition)
+#define GREX_COMPRESS_STORE_AVX512(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline std::size_t compress_store(KIND##BITS* dst, NativeMask<KIND##BITS, SIZE> m, \
+                                    NativeVector<KIND##BITS, SIZE> v) { \
+    GREX_CAT(BITPREFIX##_mask_compressstoreu_, GREX_EPI_SUFFIX(KIND, BITS))(dst, m.r, v.r); \
+    return std::size_t(std::popcount(to_bits(m))); \
+  }
+#define GREX_COMPRESS_STORE_SPLIT(KIND, BITS, SIZE, ...) \
+  inline std::size_t compress_store(KIND##BITS* dst, NativeMask<KIND##BITS, SIZE> m, \
+                                    NativeVector<KIND##BITS, SIZE> v) { \
+    return compress_store_split(dst, m, v); \
+  }
+#define GREX_COMPRESS_STORE_SMALL_128(...)
+#define GREX_COMPRESS_STORE_SMALL_256 GREX_COMPRESS_STORE_SPLIT
+#define GREX_COMPRESS_STORE_SMALL_512 GREX_COMPRESS_STORE_SPLIT
+#define GREX_COMPRESS_STORE_SMALL(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_COMPRESS_STORE_SMALL_##REGISTERBITS(KIND, BITS, SIZE)
+
+#if GREX_X86_64_LEVEL >= 4 && GREX_HAS_AVX512VBMI2
+#define GREX_COMPRESS_STORE_8 GREX_COMPRESS_STORE_AVX512
+#define GREX_COMPRESS_STORE_16 GREX_COMPRESS_STORE_AVX512
+#else
+#define GREX_COMPRESS_STORE_8 GREX_COMPRESS_STORE_SMALL
+#define GREX_COMPRESS_STORE_16 GREX_COMPRESS_STORE_SMALL
+#endif
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_COMPRESS_STORE_32 GREX_COMPRESS_STORE_AVX512
+#define GREX_COMPRESS_STORE_64 GREX_COMPRESS_STORE_AVX512
+#else
+#define GREX_COMPRESS_STORE_32(...)
+#define GREX_COMPRESS_STORE_64(...)
+#endif
+
+#define GREX_COMPRESS_STORE(KIND, BITS, ...) GREX_COMPRESS_STORE_##BITS(KIND, BITS, __VA_ARGS__)
+#define GREX_COMPRESS_STORE_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_COMPRESS_STORE, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_COMPRESS_STORE_ALL)
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_COMPRESS_HPP
@@ -20,13 +20,23 @@
 #include "grex/backend/x86/types.hpp" // IWYU pragma: keep
 
 #if GREX_X86_64_LEVEL >= 3
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
 #include <span>
 
 #include <immintrin.h>
 
 #include "grex/backend/base.hpp"
 #include "grex/backend/choosers.hpp"
+#include "grex/backend/x86/operations/arithmetic.hpp"
+#include "grex/backend/x86/operations/bitwise.hpp"
 #include "grex/backend/x86/operations/convert.hpp"
+#include "grex/backend/x86/operations/minmax.hpp"
+#include "grex/backend/x86/operations/reinterpret.hpp"
+#include "grex/backend/x86/operations/shift.hpp"
+#include "grex/backend/x86/operations/subnative.hpp"
 #include "grex/base.hpp"
 #endif
 #if GREX_X86_64_LEVEL >= 4
@@ -103,7 +113,6 @@ namespace grex::backend {
 GREX_GATHER_DEFINE(f, 64, i, 32, 2, 128)
 GREX_GATHER_DEFINE(i, 64, i, 32, 2, 128)
 GREX_GATHER_DEFINE(u, 64, i, 32, 2, 128)
-// TODO Add sub-native variants!
 GREX_GATHER_DEFINE(f, 32, i, 32, 4, 128)
 GREX_GATHER_DEFINE(i, 32, i, 32, 4, 128)
 GREX_GATHER_DEFINE(u, 32, i, 32, 4, 128)
@@ -176,18 +185,33 @@ GREX_GATHER_DEFINE(u, 32, u, 64, 8, 512)
 
 // 8- and 16-bit indices: convert to i32
 template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
-requires(sizeof(TValue) >= 4 && sizeof(TIndex) <= 2)
+requires(sizeof(TIndex) <= 2)
 inline VectorFor<TValue, tSize> gather(std::span<const TValue, tExtent> data,
                                        NativeVector<TIndex, tSize> idxs) {
   return gather(data, convert(idxs, type_tag<i32>));
 }
 template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tPart,
          std::size_t tSize>
-requires(sizeof(TValue) >= 4 && sizeof(TIndex) <= 2)
+requires(sizeof(TIndex) <= 2)
 inline VectorFor<TValue, tPart> gather(std::span<const TValue, tExtent> data,
                                        SubVector<TIndex, tPart, tSize> idxs) {
   return gather(data, convert(idxs, type_tag<i32>));
 }
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+requires(sizeof(TIndex) <= 2)
+inline VectorFor<TValue, tSize> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tSize> m,
+                                            NativeVector<TIndex, tSize> idxs) {
+  return mask_gather(data, m, convert(idxs, type_tag<i32>));
+}
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tPart,
+         std::size_t tSize>
+requires(sizeof(TIndex) <= 2)
+inline VectorFor<TValue, tPart> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tPart> m,
+                                            SubVector<TIndex, tPart, tSize> idxs) {
+  return mask_gather(data, m, convert(idxs, type_tag<i32>));
+}
 
 // u32:
 // - data.size() < 2^31: idxs < 2^31 → cast to i32 is safe
@@ -207,6 +231,160 @@ inline VectorFor<TValue, tSize> gather(std::span<const TValue, tExtent> data,
   }
   return gather(data, convert(idxs, type_tag<i32>));
 }
+template<Vectorizable TValue, std::size_t tExtent, std::size_t tSize>
+requires(sizeof(TValue) >= 4)
+inline VectorFor<TValue, tSize> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tSize> m,
+                                            NativeVector<u32, tSize> idxs) {
+  constexpr u32 limit = std::size_t{1} << 31;
+  if (data.size() >= limit) {
+    return mask_gather(
+      std::span{data.data() + limit, data.size() - limit}, m,
+      convert(bitwise_xor(idxs, broadcast(limit, type_tag<NativeVector<u32, tSize>>)),
+              type_tag<i32>));
+  }
+  return mask_gather(data, m, convert(idxs, type_tag<i32>));
+}
+// sub-native u32 indices for 64-bit values: convert to i32 as above
+template<Vectorizable TValue, std::size_t tExtent, std::size_t tPart, std::size_t tSize>
+requires(sizeof(TValue) == 8)
+inline VectorFor<TValue, tPart> gather(std::span<const TValue, tExtent> data,
+                                       SubVector<u32, tPart, tSize> idxs) {
+  constexpr u32 limit = std::size_t{1} << 31;
+  if (data.size() >= limit) {
+    return gather(
+      std::span{data.data() + limit, data.size() - limit},
+      convert(bitwise_xor(idxs, broadcast(limit, type_tag<SubVector<u32, tPart, tSize>>)),
+              type_tag<i32>));
+  }
+  return gather(data, convert(idxs, type_tag<i32>));
+}
+template<Vectorizable TValue, std::size_t tExtent, std::size_t tPart, std::size_t tSize>
+requires(sizeof(TValue) == 8)
+inline VectorFor<TValue, tPart> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tPart> m,
+                                            SubVector<u32, tPart, tSize> idxs) {
+  constexpr u32 limit = std::size_t{1} << 31;
+  if (data.size() >= limit) {
+    return mask_gather(
+      std::span{data.data() + limit, data.size() - limit}, m,
+      convert(bitwise_xor(idxs, broadcast(limit, type_tag<SubVector<u32, tPart, tSize>>)),
+              type_tag<i32>));
+  }
+  return mask_gather(data, m, convert(idxs, type_tag<i32>));
+}
+
+// sub-native 32-bit indices for values with at most 32 bits: gather using the full index vector
+// with the surplus indices set to zero, which is in bounds for non-empty data
+template<Vectorizable TValue, std::size_t tExtent, IntVectorizable TIndex, std::size_t tPart,
+         std::size_t tSize>
+requires(sizeof(TValue) <= 4 && sizeof(TIndex) == 4)
+inline VectorFor<TValue, tPart> gather(std::span<const TValue, tExtent> data,
+                                       SubVector<TIndex, tPart, tSize> idxs) {
+  return VectorFor<TValue, tPart>{gather(data, full_cutoff(idxs)).registr()};
+}
+template<Vectorizable TValue, std::size_t tExtent, IntVectorizable TIndex, std::size_t tPart,
+         std::size_t tSize>
+requires(sizeof(TValue) <= 4 && sizeof(TIndex) == 4)
+inline VectorFor<TValue, tPart> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tPart> m,
+                                            SubVector<TIndex, tPart, tSize> idxs) {
+  const MaskFor<TValue, tSize> full{m.registr()};
+  return VectorFor<TValue, tPart>{mask_gather(data, full, full_cutoff(idxs)).registr()};
+}
+
+// 8- and 16-bit values: Gather the 32-bit words starting at the values using a scale of
+// sizeof(TValue) and truncate them. To stay within `data`, indices past the last one at which
+// a whole word fits are clamped to it, and the word is shifted right by the difference.
+// Data smaller than a word is copied into a zero-padded buffer first.
+#define GREX_GATHER_WORDS_AVX(REGISTERBITS, BITPREFIX) \
+  BITPREFIX##_i32gather_epi32(static_cast<const int*>(base), idxs.r, scale.value)
+#define GREX_GATHER_WORDS_AVX512(REGISTERBITS, BITPREFIX) \
+  GREX_BITNS(REGISTERBITS)::i32gather_epi32(idxs.r, base, scale)
+#define GREX_GATHER_WORDS_128 GREX_GATHER_WORDS_AVX
+#define GREX_GATHER_WORDS_256 GREX_GATHER_WORDS_AVX
+#define GREX_GATHER_WORDS_512 GREX_GATHER_WORDS_AVX512
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_MGATHER_WORDS(REGISTERBITS, BITPREFIX) \
+  GREX_BITNS(REGISTERBITS)::GREX_CAT(GREX_MGATHER_MMASK(REGISTERBITS), _i32gather_epi32)( \
+    BITPREFIX##_setzero_si##REGISTERBITS(), m.r, idxs.r, base, scale)
+#else
+#define GREX_MGATHER_WORDS(REGISTERBITS, BITPREFIX) \
+  BITPREFIX##_mask_i32gather_epi32(BITPREFIX##_setzero_si##REGISTERBITS(), \
+                                   static_cast<const int*>(base), idxs.r, m.r, scale.value)
+#endif
+#define GREX_GATHER_WORDS(REGISTERBITS, BITPREFIX) \
+  inline NativeVector<u32, GREX_DIVIDE(REGISTERBITS, 32)> gather_words( \
+    const void* base, NativeVector<i32, GREX_DIVIDE(REGISTERBITS, 32)> idxs, \
+    AnyIntTag auto scale) { \
+    return {.r = GREX_GATHER_WORDS_##REGISTERBITS(REGISTERBITS, BITPREFIX)}; \
+  } \
+  inline NativeVector<u32, GREX_DIVIDE(REGISTERBITS, 32)> mask_gather_words( \
+    const void* base, NativeMask<u32, GREX_DIVIDE(REGISTERBITS, 32)> m, \
+    NativeVector<i32, GREX_DIVIDE(REGISTERBITS, 32)> idxs, AnyIntTag auto scale) { \
+    return {.r = GREX_MGATHER_WORDS(REGISTERBITS, BITPREFIX)}; \
+  }
+GREX_FOREACH_X86_64_LEVEL(GREX_GATHER_WORDS)
+
+// `last` is the last index relative to `base` at which a whole word fits into the data
+template<Vectorizable TValue, std::size_t tSize>
+requires(sizeof(TValue) <= 2)
+inline VectorFor<TValue, tSize> gather_truncated(const TValue* base, std::ptrdiff_t last,
+                                                 NativeVector<i32, tSize> idxs, auto gather_op) {
+  using IdxVec = NativeVector<i32, tSize>;
+  const auto clamped =
+    min(idxs, broadcast(i32(std::min<std::ptrdiff_t>(last, std::numeric_limits<i32>::max())),
+                        type_tag<IdxVec>));
+  const NativeVector<u32, tSize> words = gather_op(base, clamped, int_tag<int{sizeof(TValue)}>);
+  const auto offsets = shift_left(reinterpret(subtract(idxs, clamped), type_tag<u32>),
+                                  index_tag<(sizeof(TValue) == 1) ? 3 : 4>);
+  return convert(shift_right(words, offsets), type_tag<TValue>);
+}
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+inline VectorFor<TValue, tSize> gather_truncated(std::span<const TValue, tExtent> data,
+                                                 NativeVector<TIndex, tSize> idxs,
+                                                 auto gather_op) {
+  static constexpr std::size_t word_size = 4 / sizeof(TValue);
+  if (data.size() < word_size) {
+    std::array<TValue, word_size> padded{};
+    std::ranges::copy(data, padded.begin());
+    return gather_truncated(padded.data(), 0, convert(idxs, type_tag<i32>), gather_op);
+  }
+  if constexpr (std::same_as<TIndex, u32>) {
+    // see the u32 case above
+    constexpr u32 limit = std::size_t{1} << 31;
+    if (data.size() >= limit) {
+      const auto shifted = bitwise_xor(idxs, broadcast(limit, type_tag<NativeVector<u32, tSize>>));
+      return gather_truncated(data.data() + limit,
+                              std::ptrdiff_t(data.size() - word_size) - std::ptrdiff_t{limit},
+                              convert(shifted, type_tag<i32>), gather_op);
+    }
+    return gather_truncated(data.data(), std::ptrdiff_t(data.size() - word_size),
+                            convert(idxs, type_tag<i32>), gather_op);
+  } else {
+    return gather_truncated(data.data(), std::ptrdiff_t(data.size() - word_size), idxs,
+                            gather_op);
+  }
+}
+
+template<Vectorizable TValue, std::size_t tExtent, Int32 TIndex, std::size_t tSize>
+requires(sizeof(TValue) <= 2)
+inline VectorFor<TValue, tSize> gather(std::span<const TValue, tExtent> data,
+                                       NativeVector<TIndex, tSize> idxs) {
+  return gather_truncated(data, idxs, [](const void* base, auto clamped, auto scale) {
+    return gather_words(base, clamped, scale);
+  });
+}
+template<Vectorizable TValue, std::size_t tExtent, Int32 TIndex, std::size_t tSize>
+requires(sizeof(TValue) <= 2)
+inline VectorFor<TValue, tSize> mask_gather(std::span<const TValue, tExtent> data,
+                                            MaskFor<TValue, tSize> m,
+                                            NativeVector<TIndex, tSize> idxs) {
+  const NativeMask<u32, tSize> wm = convert(m, type_tag<u32>);
+  return gather_truncated(data, idxs, [wm](const void* base, auto clamped, auto scale) {
+    return mask_gather_words(base, wm, clamped, scale);
+  });
+}
 #endif
 } // namespace grex::backend
 
@@ -0,0 +1,77 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_HALF_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_HALF_HPP
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+// Shared definitions.
+#include "grex/backend/shared/operations/half.hpp" // IWYU pragma: export
+
+// F16C converts between f16 and f32, while AVX512-FP16 also converts between f16 and f64.
+// The rounding mode is fixed to nearest-even instead of using MXCSR.
+
+namespace grex::backend {
+#if GREX_HAS_F16C
+#define GREX_F16_ROUND (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+inline f32x4 from_f16_bits(SubVector<u16, 4, 8> bits, TypeTag<f32x4> /*tag*/) {
+  return {.r = _mm_cvtph_ps(bits.registr())};
+}
+inline SubVector<u16, 4, 8> to_f16_bits(f32x4 v) {
+  return SubVector<u16, 4, 8>{_mm_cvtps_ph(v.r, GREX_F16_ROUND)};
+}
+#if GREX_X86_64_LEVEL >= 3
+inline f32x8 from_f16_bits(u16x8 bits, TypeTag<f32x8> /*tag*/) {
+  return {.r = _mm256_cvtph_ps(bits.r)};
+}
+inline u16x8 to_f16_bits(f32x8 v) {
+  return {.r = _mm256_cvtps_ph(v.r, GREX_F16_ROUND)};
+}
+#endif
+#if GREX_X86_64_LEVEL >= 4
+inline f32x16 from_f16_bits(u16x16 bits, TypeTag<f32x16> /*tag*/) {
+  return {.r = _mm512_cvtph_ps(bits.r)};
+}
+inline u16x16 to_f16_bits(f32x16 v) {
+  return {.r = _mm512_cvtps_ph(v.r, GREX_F16_ROUND)};
+}
+#endif
+
+#undef GREX_F16_ROUND
+#endif
+
+#if GREX_HAS_AVX512FP16
+inline f64x2 from_f16_bits(SubVector<u16, 2, 8> bits, TypeTag<f64x2> /*tag*/) {
+  return {.r = _mm_cvtph_pd(_mm_castsi128_ph(bits.registr()))};
+}
+inline SubVector<u16, 2, 8> to_f16_bits(f64x2 v) {
+  return SubVector<u16, 2, 8>{_mm_castph_si128(_mm_cvtpd_ph(v.r))};
+}
+inline f64x4 from_f16_bits(SubVector<u16, 4, 8> bits, TypeTag<f64x4> /*tag*/) {
+  return {.r = _mm256_cvtph_pd(_mm_castsi128_ph(bits.registr()))};
+}
+inline SubVector<u16, 4, 8> to_f16_bits(f64x4 v) {
+  return SubVector<u16, 4, 8>{_mm_castph_si128(_mm256_cvtpd_ph(v.r))};
+}
+inline f64x8 from_f16_bits(u16x8 bits, TypeTag<f64x8> /*tag*/) {
+  return {.r = _mm512_cvtph_pd(_mm_castsi128_ph(bits.r))};
+}
+inline u16x8 to_f16_bits(f64x8 v) {
+  return {.r = _mm_castph_si128(_mm512_cvtpd_ph(v.r))};
+}
+#endif
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_HALF_HPP
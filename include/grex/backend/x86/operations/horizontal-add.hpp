@@ -12,6 +12,7 @@
 #include <immintrin.h>
 
 #include "grex/backend/base.hpp"
+#include "grex/backend/macros/base.hpp"
 #include "grex/backend/macros/for-each.hpp"
 #include "grex/backend/x86/instruction-sets.hpp"
 #include "grex/backend/x86/macros/for-each.hpp"
@@ -155,6 +156,84 @@ GREX_FOREACH_X86_64_LEVEL(GREX_HADD_ALL)
 
 // SubVector
 GREX_FOREACH_SUB(GREX_HADD_SUB)
+
+// Pair-wise sums of two vectors: [a0 + a1, a2 + a3, …, b0 + b1, b2 + b3, …]
+// The sums are computed within each 128-bit lane, which yields [a pairs, b pairs] per lane,
+// and the 64-bit halves of the lanes are then reordered for 256 and 512 bits.
+#define GREX_PADD_CASTSHUF_128(IMM) \
+  _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a.r), _mm_castsi128_ps(b.r), IMM))
+#define GREX_PADD_CASTSHUF_256(IMM) \
+  _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a.r), _mm256_castsi256_ps(b.r), IMM))
+#define GREX_PADD_CASTSHUF_512(IMM) \
+  _mm512_castps_si512(_mm512_shuffle_ps(_mm512_castsi512_ps(a.r), _mm512_castsi512_ps(b.r), IMM))
+// f32/i32: even and odd elements using shufps
+#define GREX_PADD_LANES_f32(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_add_ps(BITPREFIX##_shuffle_ps(a.r, b.r, 0b10001000), \
+                     BITPREFIX##_shuffle_ps(a.r, b.r, 0b11011101))
+#define GREX_PADD_LANES_i32(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_add_epi32(GREX_PADD_CASTSHUF_##REGISTERBITS(0b10001000), \
+                        GREX_PADD_CASTSHUF_##REGISTERBITS(0b11011101))
+// f64/i64: even and odd elements using unpacklo/unpackhi
+#define GREX_PADD_LANES_f64(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_add_pd(BITPREFIX##_unpacklo_pd(a.r, b.r), BITPREFIX##_unpackhi_pd(a.r, b.r))
+#define GREX_PADD_LANES_i64(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_add_epi64(BITPREFIX##_unpacklo_epi64(a.r, b.r), BITPREFIX##_unpackhi_epi64(a.r, b.r))
+// i16: add the upper element of each 32-bit pair to the lower one, sign-extend the lower 16 bits
+// to avoid saturation, and pack. SSSE3/AVX2 provide phaddw, which is used instead.
+#define GREX_PADD_SUMS_i16(BITPREFIX, X) \
+  BITPREFIX##_srai_epi32( \
+    BITPREFIX##_slli_epi32(BITPREFIX##_add_epi16(X, BITPREFIX##_srli_epi32(X, 16)), 16), 16)
+#define GREX_PADD_LANES_i16_SHIFT(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_packs_epi32(GREX_PADD_SUMS_i16(BITPREFIX, a.r), GREX_PADD_SUMS_i16(BITPREFIX, b.r))
+#define GREX_PADD_LANES_i16_HADD(BITPREFIX, REGISTERBITS) BITPREFIX##_hadd_epi16(a.r, b.r)
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_PADD_LANES_i16_128 GREX_PADD_LANES_i16_HADD
+#else
+#define GREX_PADD_LANES_i16_128 GREX_PADD_LANES_i16_SHIFT
+#endif
+#define GREX_PADD_LANES_i16_256 GREX_PADD_LANES_i16_HADD
+#define GREX_PADD_LANES_i16_512 GREX_PADD_LANES_i16_SHIFT
+#define GREX_PADD_LANES_i16(BITPREFIX, REGISTERBITS) \
+  GREX_PADD_LANES_i16_##REGISTERBITS(BITPREFIX, REGISTERBITS)
+// i8: add the upper element of each 16-bit pair to the lower one, mask the lower 8 bits, and pack
+#define GREX_PADD_SUMS_i8(BITPREFIX, REGISTERBITS, X) \
+  BITPREFIX##_and_si##REGISTERBITS(BITPREFIX##_add_epi8(X, BITPREFIX##_srli_epi16(X, 8)), \
+                                   BITPREFIX##_set1_epi16(0xFF))
+#define GREX_PADD_LANES_i8(BITPREFIX, REGISTERBITS) \
+  BITPREFIX##_packus_epi16(GREX_PADD_SUMS_i8(BITPREFIX, REGISTERBITS, a.r), \
+                           GREX_PADD_SUMS_i8(BITPREFIX, REGISTERBITS, b.r))
+#define GREX_PADD_LANES_u64 GREX_PADD_LANES_i64
+#define GREX_PADD_LANES_u32 GREX_PADD_LANES_i32
+#define GREX_PADD_LANES_u16 GREX_PADD_LANES_i16
+#define GREX_PADD_LANES_u8 GREX_PADD_LANES_i8
+// Reordering of the 64-bit halves of the lanes: [a0, b0, a1, b1, …] → [a0, a1, …, b0, b1, …]
+#define GREX_PADD_REORDER_128(KIND, BITS, X) X
+#define GREX_PADD_REORDER_256_f32(X) \
+  _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(X), 0b11011000))
+#define GREX_PADD_REORDER_256_f64(X) _mm256_permute4x64_pd(X, 0b11011000)
+#define GREX_PADD_REORDER_256_i(X) _mm256_permute4x64_epi64(X, 0b11011000)
+#define GREX_PADD_IDX_512 _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7)
+#define GREX_PADD_REORDER_512_f32(X) \
+  _mm512_castpd_ps(_mm512_permutexvar_pd(GREX_PADD_IDX_512, _mm512_castps_pd(X)))
+#define GREX_PADD_REORDER_512_f64(X) _mm512_permutexvar_pd(GREX_PADD_IDX_512, X)
+#define GREX_PADD_REORDER_512_i(X) _mm512_permutexvar_epi64(GREX_PADD_IDX_512, X)
+#define GREX_PADD_REORDER_KIND_f(BITS) f##BITS
+#define GREX_PADD_REORDER_KIND_i(BITS) i
+#define GREX_PADD_REORDER_KIND_u(BITS) i
+#define GREX_PADD_REORDER_256(KIND, BITS, X) \
+  GREX_CAT(GREX_PADD_REORDER_256_, GREX_PADD_REORDER_KIND_##KIND(BITS))(X)
+#define GREX_PADD_REORDER_512(KIND, BITS, X) \
+  GREX_CAT(GREX_PADD_REORDER_512_, GREX_PADD_REORDER_KIND_##KIND(BITS))(X)
+
+#define GREX_PADD(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> add_pairwise(NativeVector<KIND##BITS, SIZE> a, \
+                                                     NativeVector<KIND##BITS, SIZE> b) { \
+    const auto lanes = GREX_PADD_LANES_##KIND##BITS(BITPREFIX, REGISTERBITS); \
+    return {.r = GREX_PADD_REORDER_##REGISTERBITS(KIND, BITS, lanes)}; \
+  }
+#define GREX_PADD_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_PADD, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_PADD_ALL)
 } // namespace grex::backend
 
 #include "grex/backend/shared/operations/horizontal-add.hpp" // IWYU pragma: export
@@ -7,6 +7,9 @@
 #ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_HORIZONTAL_MINMAX_HPP
 #define INCLUDE_GREX_BACKEND_X86_OPERATIONS_HORIZONTAL_MINMAX_HPP
 
+#include <cstddef>
+#include <utility>
+
 #include <immintrin.h>
 
 #include "grex/backend/base.hpp"
@@ -188,6 +191,59 @@ GREX_FOREACH_X86_64_LEVEL(GREX_HMINMAX_ALL)
   GREX_HMINMAX_SUB(KIND, BITS, PART, SIZE, min) \
   GREX_HMINMAX_SUB(KIND, BITS, PART, SIZE, max)
 GREX_FOREACH_SUB(GREX_HMINMAX_SUB_ALL)
+
+#if GREX_X86_64_LEVEL >= 2
+// horizontal_argmin/horizontal_argmax for 16-bit integers using phminposuw, which finds
+// the minimum of eight u16 values and the first lane attaining it: The other cases are mapped
+// to it by flipping all bits for the maximum and flipping the sign bit for i16.
+// Inactive lanes of sub-native vectors become 0xFFFF, which never precedes an active lane.
+#define GREX_HARGMINMAX_FLIP_u16_min 0x0000
+#define GREX_HARGMINMAX_FLIP_u16_max 0xFFFF
+#define GREX_HARGMINMAX_FLIP_i16_min 0x8000
+#define GREX_HARGMINMAX_FLIP_i16_max 0x7FFF
+#define GREX_HARGMINMAX_BETTER_min(A, B) ((A) < (B))
+#define GREX_HARGMINMAX_BETTER_max(A, B) ((A) > (B))
+inline std::pair<u16, std::size_t> minpos_u16(__m128i v, u16 flip, __m128i pad) {
+  const __m128i flipped = _mm_or_si128(_mm_xor_si128(v, _mm_set1_epi16(i16(flip))), pad);
+  const auto pos = u32(_mm_cvtsi128_si32(_mm_minpos_epu16(flipped)));
+  return {u16(pos ^ flip), (pos >> 16U) & 7U};
+}
+
+#define GREX_HARGMINMAX_16(KIND, OP) \
+  inline std::pair<KIND##16, std::size_t> horizontal_arg##OP(NativeVector<KIND##16, 8> v) { \
+    const auto [value, index] = \
+      minpos_u16(v.r, GREX_HARGMINMAX_FLIP_##KIND##16_##OP, _mm_setzero_si128()); \
+    return {KIND##16(value), index}; \
+  } \
+  template<std::size_t tPart> \
+  inline std::pair<KIND##16, std::size_t> horizontal_arg##OP(SubVector<KIND##16, tPart, 8> v) { \
+    const __m128i pad = _mm_bslli_si128(_mm_set1_epi32(-1), 2 * tPart); \
+    const auto [value, index] = minpos_u16(v.full.r, GREX_HARGMINMAX_FLIP_##KIND##16_##OP, pad); \
+    return {KIND##16(value), index}; \
+  }
+// wider vectors: combine the results for both halves, preferring the lower half
+#define GREX_HARGMINMAX_16_HALVES(KIND, SIZE, OP) \
+  inline std::pair<KIND##16, std::size_t> horizontal_arg##OP(NativeVector<KIND##16, SIZE> v) { \
+    const auto lower = horizontal_arg##OP(split(v, index_tag<0>)); \
+    const auto upper = horizontal_arg##OP(split(v, index_tag<1>)); \
+    if (GREX_HARGMINMAX_BETTER_##OP(upper.first, lower.first)) { \
+      return {upper.first, upper.second + SIZE / 2}; \
+    } \
+    return lower; \
+  }
+#define GREX_HARGMINMAX_16_ALL(MACRO, ...) \
+  MACRO(u, __VA_ARGS__ __VA_OPT__(, ) min) \
+  MACRO(u, __VA_ARGS__ __VA_OPT__(, ) max) \
+  MACRO(i, __VA_ARGS__ __VA_OPT__(, ) min) \
+  MACRO(i, __VA_ARGS__ __VA_OPT__(, ) max)
+GREX_HARGMINMAX_16_ALL(GREX_HARGMINMAX_16)
+#if GREX_X86_64_LEVEL >= 3
+GREX_HARGMINMAX_16_ALL(GREX_HARGMINMAX_16_HALVES, 16)
+#endif
+#if GREX_X86_64_LEVEL >= 4
+GREX_HARGMINMAX_16_ALL(GREX_HARGMINMAX_16_HALVES, 32)
+#endif
+#endif
 } // namespace grex::backend
 
 #include "grex/backend/shared/operations/horizontal-minmax.hpp" // IWYU pragma: export
@@ -0,0 +1,18 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_INTERLEAVE_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_INTERLEAVE_HPP
+
+// IWYU pragma: begin_exports
+#include "grex/backend/shared/operations/interleave.hpp"
+#include "grex/backend/x86/operations/blend-static.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/shuffle-static.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+// IWYU pragma: end_exports
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_INTERLEAVE_HPP
@@ -0,0 +1,132 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_BITS_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_BITS_HPP
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/macros/intrinsics.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// A mask with the lowest SIZE bits set
+#define GREX_TOBITS_LOW_2 u64{0x3}
+#define GREX_TOBITS_LOW_4 u64{0xF}
+#define GREX_TOBITS_LOW_8 u64{0xFF}
+#define GREX_TOBITS_LOW_16 u64{0xFFFF}
+#define GREX_TOBITS_LOW_32 u64{0xFFFFFFFF}
+#define GREX_TOBITS_LOW_64 ~u64{}
+#define GREX_TOBITS_LOW(SIZE) GREX_TOBITS_LOW_##SIZE
+
+// AVX-512: The mask is already a bit mask, but the bits beyond the size may be set
+#define GREX_TOBITS_COMPACT(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  u64(m.r) & GREX_TOBITS_LOW(SIZE)
+// Otherwise: Use movemask on the type with the appropriate width
+#define GREX_TOBITS_BROAD_8(BITPREFIX, REGISTERBITS) u32(BITPREFIX##_movemask_epi8(m.r))
+// 16 bit: pack into 8 bits with signed saturation
+#define GREX_TOBITS_BROAD_16_128 u32(_mm_movemask_epi8(_mm_packs_epi16(m.r, _mm_setzero_si128())))
+#define GREX_TOBITS_BROAD_16_256 \
+  u32(_mm_movemask_epi8( \
+    _mm_packs_epi16(_mm256_castsi256_si128(m.r), _mm256_extracti128_si256(m.r, 1))))
+#define GREX_TOBITS_BROAD_16(BITPREFIX, REGISTERBITS) GREX_TOBITS_BROAD_16_##REGISTERBITS
+#define GREX_TOBITS_BROAD_32(BITPREFIX, REGISTERBITS) \
+  u32(BITPREFIX##_movemask_ps(BITPREFIX##_castsi##REGISTERBITS##_ps(m.r)))
+#define GREX_TOBITS_BROAD_64(BITPREFIX, REGISTERBITS) \
+  u32(BITPREFIX##_movemask_pd(BITPREFIX##_castsi##REGISTERBITS##_pd(m.r)))
+#define GREX_TOBITS_BROAD(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_TOBITS_BROAD_##BITS(BITPREFIX, REGISTERBITS)
+
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_TOBITS_IMPL GREX_TOBITS_COMPACT
+#else
+#define GREX_TOBITS_IMPL GREX_TOBITS_BROAD
+#endif
+
+#define GREX_TOBITS(KIND, BITS, SIZE, ...) \
+  inline u64 to_bits(NativeMask<KIND##BITS, SIZE> m) { \
+    return GREX_TOBITS_IMPL(KIND, BITS, SIZE, __VA_ARGS__); \
+  }
+#define GREX_TOBITS_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_TOBITS, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_TOBITS_ALL)
+
+#define GREX_TOBITS_SUB(KIND, BITS, PART, SIZE) \
+  inline u64 to_bits(SubMask<KIND##BITS, PART, SIZE> m) { \
+    return to_bits(m.full) & GREX_TOBITS_LOW(PART); \
+  }
+GREX_FOREACH_SUB(GREX_TOBITS_SUB)
+
+// Compact masks: The bit mask is the mask
+// Broad masks: Broadcast the bits, keep one distinct bit per lane, and compare
+// 8 bit: Broadcast each byte of the bit mask to eight lanes by multiplication
+// 64 bit: Compare pairs of 32-bit lanes, as SSE2 does not support 64-bit comparisons
+#define GREX_FROMBITS_COMPACT(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_MMASK(SIZE)(bits)};
+#define GREX_FROMBITS_BYTE(IDX) i64(((bits >> (8U * IDX##U)) & 0xFFU) * 0x0101010101010101U)
+#define GREX_FROMBITS_VALUES_8_128 _mm_set_epi64x(GREX_FROMBITS_BYTE(1), GREX_FROMBITS_BYTE(0))
+#define GREX_FROMBITS_VALUES_8_256 \
+  _mm256_set_epi64x(GREX_FROMBITS_BYTE(3), GREX_FROMBITS_BYTE(2), GREX_FROMBITS_BYTE(1), \
+                    GREX_FROMBITS_BYTE(0))
+#define GREX_FROMBITS_WEIGHTS_8_128 _mm_set1_epi64x(i64(0x8040201008040201U))
+#define GREX_FROMBITS_WEIGHTS_8_256 _mm256_set1_epi64x(i64(0x8040201008040201U))
+#define GREX_FROMBITS_VALUES_16_128 _mm_set1_epi16(i16(bits))
+#define GREX_FROMBITS_VALUES_16_256 _mm256_set1_epi16(i16(bits))
+#define GREX_FROMBITS_WEIGHTS_16_128 _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128)
+#define GREX_FROMBITS_WEIGHTS_16_256 \
+  _mm256_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, \
+                    i16(0x8000))
+#define GREX_FROMBITS_VALUES_32_128 _mm_set1_epi32(i32(bits))
+#define GREX_FROMBITS_VALUES_32_256 _mm256_set1_epi32(i32(bits))
+#define GREX_FROMBITS_WEIGHTS_32_128 _mm_setr_epi32(1, 2, 4, 8)
+#define GREX_FROMBITS_WEIGHTS_32_256 _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)
+#define GREX_FROMBITS_VALUES_64_128 GREX_FROMBITS_VALUES_32_128
+#define GREX_FROMBITS_VALUES_64_256 GREX_FROMBITS_VALUES_32_256
+#define GREX_FROMBITS_WEIGHTS_64_128 _mm_setr_epi32(1, 1, 2, 2)
+#define GREX_FROMBITS_WEIGHTS_64_256 _mm256_setr_epi32(1, 1, 2, 2, 4, 4, 8, 8)
+#define GREX_FROMBITS_CMP_8 8
+#define GREX_FROMBITS_CMP_16 16
+#define GREX_FROMBITS_CMP_32 32
+#define GREX_FROMBITS_CMP_64 32
+#define GREX_FROMBITS_BROAD(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  const auto weights = GREX_FROMBITS_WEIGHTS_##BITS##_##REGISTERBITS; \
+  const auto selected = \
+    BITPREFIX##_and_si##REGISTERBITS(GREX_FROMBITS_VALUES_##BITS##_##REGISTERBITS, weights); \
+  return {.r = GREX_CAT(BITPREFIX##_cmpeq_epi, GREX_FROMBITS_CMP_##BITS)(selected, weights)};
+
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_FROMBITS_IMPL GREX_FROMBITS_COMPACT
+#else
+#define GREX_FROMBITS_IMPL GREX_FROMBITS_BROAD
+#endif
+
+#define GREX_FROMBITS(KIND, BITS, SIZE, ...) \
+  inline NativeMask<KIND##BITS, SIZE> from_bits(u64 bits, \
+                                                TypeTag<NativeMask<KIND##BITS, SIZE>> /*tag*/) { \
+    GREX_FROMBITS_IMPL(KIND, BITS, SIZE, __VA_ARGS__) \
+  }
+#define GREX_FROMBITS_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_FROMBITS, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_FROMBITS_ALL)
+
+#define GREX_FROMBITS_SUB(KIND, BITS, PART, SIZE) \
+  inline SubMask<KIND##BITS, PART, SIZE> from_bits( \
+    u64 bits, TypeTag<SubMask<KIND##BITS, PART, SIZE>> /*tag*/) { \
+    return SubMask<KIND##BITS, PART, SIZE>{ \
+      from_bits(bits, type_tag<NativeMask<KIND##BITS, SIZE>>)}; \
+  }
+GREX_FOREACH_SUB(GREX_FROMBITS_SUB)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/mask-bits.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_BITS_HPP
@@ -0,0 +1,170 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_EXPAND_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_EXPAND_HPP
+
+#include <bit>
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/macros/intrinsics.hpp"
+#include "grex/backend/x86/operations/bitwise.hpp"
+#include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/mask-bits.hpp"
+#include "grex/backend/x86/operations/mask-index.hpp"
+#include "grex/backend/x86/operations/reinterpret.hpp"
+#include "grex/backend/x86/operations/split.hpp"
+#include "grex/backend/x86/operations/store.hpp"
+#include "grex/backend/x86/operations/to-array.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+// shared definitions
+#include "grex/backend/shared/operations/mask-expand.hpp" // IWYU pragma: export
+
+namespace grex::backend {
+// AVX-512: Use the expand instructions, which require AVX512-VBMI2 for 8 and 16 bits
+// SSSE3 and newer, 128 bit: Byte shuffle with a table entry selected by the mask bits
+// AVX2, 256 bit: 32/64 bits use a lane permutation, 8/16 bits expand both halves
+// SSE2: Expand one lane at a time
+
+#if GREX_X86_64_LEVEL >= 2
+// 8 bit: A table with 2^16 entries would be too big → look up both halves separately
+// and offset the indices of the upper half by the number of values used by the lower half
+inline u8x16 mask_expand_bytes(u8x16 v, u64 bits) {
+  const auto& table = expand_table<8, 1>;
+  const u64 lo = bits & 0xFFU;
+  const u64 hi = bits >> 8U;
+  const auto* entry_lo = reinterpret_cast<const __m128i*>(table[lo].data());
+  const auto* entry_hi = reinterpret_cast<const __m128i*>(table[hi].data());
+  const __m128i idxs = _mm_unpacklo_epi64(_mm_loadl_epi64(entry_lo), _mm_loadl_epi64(entry_hi));
+  // the padding remains negative after adding the offset
+  const __m128i offset =
+    _mm_unpacklo_epi64(_mm_setzero_si128(), _mm_set1_epi8(i8(std::popcount(lo))));
+  return {.r = _mm_shuffle_epi8(v.r, _mm_add_epi8(idxs, offset))};
+}
+template<std::size_t tLaneBytes>
+inline u8x16 mask_expand_bytes(u8x16 v, u64 bits) {
+  const auto& entry = expand_table<16 / tLaneBytes, tLaneBytes>[bits];
+  const __m128i idxs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(entry.data()));
+  return {.r = _mm_shuffle_epi8(v.r, idxs)};
+}
+#endif
+
+#if GREX_X86_64_LEVEL >= 3
+// 32 bit: Widen the byte lane indices and permute, zeroing out the lanes with padded indices
+inline u32x8 mask_expand_words(u32x8 v, u64 bits) {
+  const auto& entry = expand_table<8, 1>[bits];
+  const auto* ptr = reinterpret_cast<const __m128i*>(entry.data());
+  const __m256i idxs = _mm256_cvtepu8_epi32(_mm_loadl_epi64(ptr));
+  const __m256i perm = _mm256_permutevar8x32_epi32(v.r, idxs);
+  return {.r = _mm256_and_si256(perm, _mm256_cmpgt_epi32(_mm256_set1_epi32(8), idxs))};
+}
+// 64 bit: Duplicate each mask bit and permute pairs of 32-bit lanes
+inline u32x8 mask_expand_words(u64x4 v, u64 bits) {
+  bits = (bits | (bits << 2U)) & 0x33U;
+  bits = (bits | (bits << 1U)) & 0x55U;
+  return mask_expand_words(as<u32>(v), bits * 3U);
+}
+#endif
+
+#define GREX_MASK_EXPAND_AVX512(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_CAT(BITPREFIX##_maskz_expand_, GREX_EPI_SUFFIX(KIND, BITS))(m.r, v.r)};
+#define GREX_MASK_EXPAND_BYTES_8(KIND) \
+  return as<KIND##8>(mask_expand_bytes(as<u8>(v), to_bits(m)));
+#define GREX_MASK_EXPAND_BYTES(KIND, BITS, ...) \
+  return as<KIND##BITS>(mask_expand_bytes<GREX_DIVIDE(BITS, 8)>(as<u8>(v), to_bits(m)));
+#define GREX_MASK_EXPAND_WORDS(KIND, BITS, ...) \
+  return as<KIND##BITS>(mask_expand_words(as<u##BITS>(v), to_bits(m)));
+#define GREX_MASK_EXPAND_SPLIT(...) return mask_expand_split(v, m);
+#define GREX_MASK_EXPAND_FALLBACK(...) return mask_expand_fallback(v, m);
+
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_MASK_EXPAND_128_8(KIND, ...) GREX_MASK_EXPAND_BYTES_8(KIND)
+#define GREX_MASK_EXPAND_128_16 GREX_MASK_EXPAND_BYTES
+#define GREX_MASK_EXPAND_128_32 GREX_MASK_EXPAND_BYTES
+#define GREX_MASK_EXPAND_128_64 GREX_MASK_EXPAND_BYTES
+#else
+#define GREX_MASK_EXPAND_128_8 GREX_MASK_EXPAND_FALLBACK
+#define GREX_MASK_EXPAND_128_16 GREX_MASK_EXPAND_FALLBACK
+#define GREX_MASK_EXPAND_128_32 GREX_MASK_EXPAND_FALLBACK
+#define GREX_MASK_EXPAND_128_64 GREX_MASK_EXPAND_FALLBACK
+#endif
+#define GREX_MASK_EXPAND_256_8 GREX_MASK_EXPAND_SPLIT
+#define GREX_MASK_EXPAND_256_16 GREX_MASK_EXPAND_SPLIT
+#define GREX_MASK_EXPAND_256_32 GREX_MASK_EXPAND_WORDS
+#define GREX_MASK_EXPAND_256_64 GREX_MASK_EXPAND_WORDS
+#define GREX_MASK_EXPAND_512_8 GREX_MASK_EXPAND_SPLIT
+#define GREX_MASK_EXPAND_512_16 GREX_MASK_EXPAND_SPLIT
+
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_MASK_EXPAND_AVX512_32 GREX_MASK_EXPAND_AVX512
+#define GREX_MASK_EXPAND_AVX512_64 GREX_MASK_EXPAND_AVX512
+#if GREX_HAS_AVX512VBMI2
+#define GREX_MASK_EXPAND_AVX512_8 GREX_MASK_EXPAND_AVX512
+#define GREX_MASK_EXPAND_AVX512_16 GREX_MASK_EXPAND_AVX512
+#else
+#define GREX_MASK_EXPAND_AVX512_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_MASK_EXPAND_##REGISTERBITS##_8(KIND, BITS, SIZE)
+#define GREX_MASK_EXPAND_AVX512_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_MASK_EXPAND_##REGISTERBITS##_16(KIND, BITS, SIZE)
+#endif
+#define GREX_MASK_EXPAND_IMPL(KIND, BITS, ...) \
+  GREX_MASK_EXPAND_AVX512_##BITS(KIND, BITS, __VA_ARGS__)
+#else
+#define GREX_MASK_EXPAND_IMPL(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_MASK_EXPAND_##REGISTERBITS##_##BITS(KIND, BITS, SIZE)
+#endif
+
+#define GREX_MASK_EXPAND(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> mask_expand(NativeVector<KIND##BITS, SIZE> v, \
+                                                    NativeMask<KIND##BITS, SIZE> m) { \
+    GREX_MASK_EXPAND_IMPL(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_MASK_EXPAND_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_MASK_EXPAND, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_MASK_EXPAND_ALL)
+
+// AVX-512: Load only the selected lanes directly
+// Otherwise: Load the required part and expand it (generic definition)
+#define GREX_MASK_EXPAND_LOAD_AVX512(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> mask_expand_load(const KIND##BITS* src, \
+                                                         NativeMask<KIND##BITS, SIZE> m) { \
+    return { \
+      .r = GREX_CAT(BITPREFIX##_maskz_expandloadu_, GREX_EPI_SUFFIX(KIND, BITS))(m.r, src)}; \
+  }
+
+#if GREX_X86_64_LEVEL >= 4 && GREX_HAS_AVX512VBMI2
+#define GREX_MASK_EXPAND_LOAD_8 GREX_MASK_EXPAND_LOAD_AVX512
+#define GREX_MASK_EXPAND_LOAD_16 GREX_MASK_EXPAND_LOAD_AVX512
+#else
+#define GREX_MASK_EXPAND_LOAD_8(...)
+#define GREX_MASK_EXPAND_LOAD_16(...)
+#endif
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_MASK_EXPAND_LOAD_32 GREX_MASK_EXPAND_LOAD_AVX512
+#define GREX_MASK_EXPAND_LOAD_64 GREX_MASK_EXPAND_LOAD_AVX512
+#else
+#define GREX_MASK_EXPAND_LOAD_32(...)
+#define GREX_MASK_EXPAND_LOAD_64(...)
+#endif
+
+#define GREX_MASK_EXPAND_LOAD(KIND, BITS, ...) \
+  GREX_MASK_EXPAND_LOAD_##BITS(KIND, BITS, __VA_ARGS__)
+#define GREX_MASK_EXPAND_LOAD_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_MASK_EXPAND_LOAD, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_MASK_EXPAND_LOAD_ALL)
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_MASK_EXPAND_HPP
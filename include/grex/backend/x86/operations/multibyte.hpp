@@ -7,6 +7,7 @@
 #ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_MULTIBYTE_HPP
 #define INCLUDE_GREX_BACKEND_X86_OPERATIONS_MULTIBYTE_HPP
 
+#include <algorithm>
 #include <cstddef>
 
 #include <immintrin.h>
@@ -15,10 +16,11 @@
 #include "grex/backend/choosers.hpp"
 #include "grex/backend/x86/instruction-sets.hpp"
 #include "grex/backend/x86/operations/load.hpp"
+#include "grex/backend/x86/operations/store.hpp"
 #include "grex/backend/x86/types.hpp"
 #include "grex/base.hpp"
 
-#if GREX_X86_64_LEVEL >= 4
+#if GREX_X86_64_LEVEL >= 3
 #include "grex/backend/x86/operations/set.hpp"
 #endif
 
@@ -31,6 +33,8 @@
 // being converted.
 // The underlying memory is assumed to be padded at the beginning and end by the number of bytes
 // in the largest supported SIMD register.
+// The byte shuffles also support big-endian source integers when passed `true_tag`,
+// in which case the bytes within each integer are gathered in reverse order.
 
 namespace grex::backend {
 // N == M: trivial case, just load and rewrap.
@@ -43,13 +47,15 @@ inline TDst load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/, TypeTag<TDst>
 
 #if GREX_X86_64_LEVEL >= 2
 // Generic SSSE3 path for 16-byte native registers using PSHUFB.
-template<std::size_t tSrc, typename TDst>
+template<std::size_t tSrc, typename TDst, bool tBigEndian = false>
 requires(tSrc < sizeof(typename TDst::Value) && sizeof(typename TDst::Register) == 16)
-inline TDst load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/, TypeTag<TDst> /*dst*/) {
+inline TDst load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/, TypeTag<TDst> /*dst*/,
+                           BoolTag<tBigEndian> /*big_endian*/ = {}) {
   using Value = TDst::Value;
   static constexpr std::size_t size = TDst::size;
   static constexpr std::size_t full_size = sizeof(typename TDst::Register) / sizeof(Value);
-  static constexpr auto idxs_arr = mb::shuffle_indices_128<tSrc, sizeof(Value), full_size, size>;
+  static constexpr auto idxs_arr =
+    mb::shuffle_indices_128<tSrc, sizeof(Value), full_size, size, tBigEndian>;
   const __m128i raw = load(ptr, type_tag<VectorFor<u8, sizeof(Value) * size>>).registr();
   const __m128i idxs =
     static_apply<16>([]<std::size_t... tIdxs> { return _mm_setr_epi8(idxs_arr[tIdxs]...); });
@@ -128,10 +134,11 @@ inline SubVector<u32, 2, 4> load_multibyte(const u8* ptr, IndexTag<3> /*src*/,
 
 #if GREX_X86_64_LEVEL >= 3
 // AVX2: load `tSize` elements of size `tSrc` into 32 bytes (256 bits).
-template<std::size_t tSrc, typename TDst, std::size_t tSize>
+template<std::size_t tSrc, typename TDst, std::size_t tSize, bool tBigEndian = false>
 requires(tSrc < sizeof(TDst) && (sizeof(TDst) * tSize) == 32)
 inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/,
-                                                TypeTag<NativeVector<TDst, tSize>> /*dst*/) {
+                                                TypeTag<NativeVector<TDst, tSize>> /*dst*/,
+                                                BoolTag<tBigEndian> /*big_endian*/ = {}) {
   static constexpr std::size_t src_bytes = tSrc;
   static constexpr std::size_t dst_bytes = sizeof(TDst);
   // Zero padding per element.
@@ -147,7 +154,8 @@ inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*
   const auto idxs = static_apply<dst_bytes * tSize>([&]<std::size_t... tIdxs>() {
     return _mm256_setr_epi8(
       ((tIdxs % dst_bytes < src_bytes)
-         ? i8(tIdxs % dst_bytes + (tIdxs / dst_bytes) * src_bytes + (tSize / 2) * offset)
+         ? i8(mb::byte_index<tSrc, tBigEndian>(tIdxs % dst_bytes) +
+              (tIdxs / dst_bytes) * src_bytes + (tSize / 2) * offset)
          : i8(-1))...);
   });
   return {.r = _mm256_shuffle_epi8(raw, idxs)};
@@ -156,10 +164,11 @@ inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*
 
 #if GREX_X86_64_LEVEL >= 4
 // AVX-512: load `tSize` elements of size `tSrc` into 64 bytes (512 bits).
-template<std::size_t tSrc, typename TDst, std::size_t tSize>
+template<std::size_t tSrc, typename TDst, std::size_t tSize, bool tBigEndian = false>
 requires(tSrc < sizeof(TDst) && (sizeof(TDst) * tSize) == 64)
 inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*src*/,
-                                                TypeTag<NativeVector<TDst, tSize>> /*dst*/) {
+                                                TypeTag<NativeVector<TDst, tSize>> /*dst*/,
+                                                BoolTag<tBigEndian> /*big_endian*/ = {}) {
   // The comments are based on M == 5; M == 6 and 7 are analogous.
 
   static constexpr std::size_t src_bytes = tSrc;
@@ -194,7 +203,8 @@ inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*
   // For each output byte index i in [0, 64), we:
   // 1. Check if it is inside the padding; if so, use -1 (zero).
   // 2. Otherwise compute the source byte index as a sum of:
-  //    (a) index within the element (`i % dst_bytes`, bounded by src_bytes),
+  //    (a) index within the element (`i % dst_bytes`, bounded by src_bytes, and reversed
+  //        for big-endian integers),
   //    (b) element offset within the 128-bit lane,
   //    (c) additional offset for top-aligned lanes (odd lane indices).
   //
@@ -205,14 +215,142 @@ inline NativeVector<TDst, tSize> load_multibyte(const u8* ptr, IndexTag<tSrc> /*
   const __m512i idxs8 = static_apply<64>([]<std::size_t... tIdxs>() {
     return set(type_tag<NativeVector<i8, 64>>,
                ((tIdxs % dst_bytes < src_bytes)
-                  ? i8{tIdxs % dst_bytes + ((tIdxs % 16) / dst_bytes) * src_bytes +
-                       ((tIdxs / 16) % 2) * (offset / 4)}
+                  ? i8{mb::byte_index<tSrc, tBigEndian>(tIdxs % dst_bytes) +
+                       ((tIdxs % 16) / dst_bytes) * src_bytes + ((tIdxs / 16) % 2) * (offset / 4)}
                   : i8{-1})...)
       .r;
   });
   return {.r = _mm512_shuffle_epi8(out, idxs8)};
 }
 #endif
+
+// Store the lower M bytes of each of the first `num` N-byte integers contiguously, which is the
+// inverse of `load_multibyte`. All paths gather the data bytes at the bottom of a register and
+// write exactly `num * M` bytes using a partial store, so the memory does not need to be padded.
+
+// N == M: trivial case, just store the bytes.
+template<std::size_t tDst, AnyVector TSrc>
+requires(!AnySuperNativeVector<TSrc> && tDst == sizeof(typename TSrc::Value))
+inline void store_multibyte_part(u8* ptr, TSrc src, std::size_t num, IndexTag<tDst> /*dst*/) {
+  using Bytes = VectorFor<u8, sizeof(typename TSrc::Register)>;
+  store_part(ptr, Bytes{src.registr()}, num * tDst);
+}
+
+#if GREX_X86_64_LEVEL >= 2
+// Generic SSSE3 path for 16-byte native registers using PSHUFB.
+template<std::size_t tDst, typename TSrc>
+requires(tDst < sizeof(typename TSrc::Value) && sizeof(typename TSrc::Register) == 16)
+inline void store_multibyte_part(u8* ptr, TSrc src, std::size_t num, IndexTag<tDst> /*dst*/) {
+  static constexpr auto idxs_arr = mb::pack_indices_128<tDst, sizeof(typename TSrc::Value)>;
+  const __m128i idxs =
+    static_apply<16>([]<std::size_t... tIdxs> { return _mm_setr_epi8(idxs_arr[tIdxs]...); });
+  store_part(ptr, u8x16{_mm_shuffle_epi8(src.registr(), idxs)}, num * tDst);
+}
+#else
+// SSE2: Merge neighbouring halves of increasing width using shifts, starting with
+// the individual integers and ending with the two 64-bit halves of the register.
+// `tBytes` is the number of data bytes at the bottom of each `tHalf`-byte half.
+// The comments assume N == 4 and M == 3.
+template<std::size_t tBytes, std::size_t tHalf>
+inline __m128i store_multibyte_merge(__m128i r) {
+  static constexpr u64 low = (u64{1} << (8 * tBytes)) - 1;
+  if constexpr (tHalf == 8) {
+    // 000111··|222333·· → 000111222333···· (merge the two 64-bit lanes)
+    const __m128i mask = _mm_set_epi64x(0, i64(low));
+    const __m128i hi = _mm_srli_si128(r, 8 - tBytes);
+    return _mm_or_si128(_mm_and_si128(r, mask), _mm_andnot_si128(mask, hi));
+  } else if constexpr (tHalf == 4) {
+    // 000·|111·|222·|333· → 000111··|222333·· (merge within each 64-bit lane)
+    const __m128i mask = _mm_set1_epi64x(i64(low));
+    const __m128i hi = _mm_srli_epi64(r, 8 * (4 - tBytes));
+    const __m128i merged = _mm_or_si128(_mm_and_si128(r, mask), _mm_andnot_si128(mask, hi));
+    return store_multibyte_merge<2 * tBytes, 8>(merged);
+  } else {
+    static_assert(tHalf == 2);
+    const __m128i mask = _mm_set1_epi32(i32(low));
+    const __m128i hi = _mm_srli_epi32(r, 8 * (2 - tBytes));
+    const __m128i merged = _mm_or_si128(_mm_and_si128(r, mask), _mm_andnot_si128(mask, hi));
+    return store_multibyte_merge<2 * tBytes, 4>(merged);
+  }
+}
+template<std::size_t tDst, typename TSrc>
+requires(tDst < sizeof(typename TSrc::Value) && sizeof(typename TSrc::Register) == 16)
+inline void store_multibyte_part(u8* ptr, TSrc src, std::size_t num, IndexTag<tDst> /*dst*/) {
+  const __m128i r = src.registr();
+  const __m128i packed = store_multibyte_merge<tDst, sizeof(typename TSrc::Value)>(r);
+  store_part(ptr, u8x16{packed}, num * tDst);
+}
+#endif
+
+#if GREX_X86_64_LEVEL >= 3
+// AVX2/AVX-512: store `tSize` elements of size `tDst` from 32 or 64 bytes.
+template<std::size_t tDst, typename TSrc, std::size_t tSize>
+requires(tDst < sizeof(TSrc) && (sizeof(TSrc) * tSize) >= 32)
+inline void store_multibyte_part(u8* ptr, NativeVector<TSrc, tSize> src, std::size_t num,
+                                 IndexTag<tDst> /*dst*/) {
+  static constexpr std::size_t src_bytes = sizeof(TSrc);
+  static constexpr std::size_t vector_bytes = src_bytes * tSize;
+  using Bytes = NativeVector<u8, vector_bytes>;
+
+#if GREX_HAS_AVX512VBMI
+  // A single byte permutation across the whole register.
+  const auto idxs = static_apply<vector_bytes>([]<std::size_t... tIdxs>() {
+    return set(type_tag<NativeVector<u8, vector_bytes>>,
+               u8((tIdxs / tDst) * src_bytes + tIdxs % tDst)...)
+      .r;
+  });
+  if constexpr (vector_bytes == 32) {
+    store_part(ptr, Bytes{_mm256_permutexvar_epi8(idxs, src.r)}, num * tDst);
+  } else {
+    store_part(ptr, Bytes{_mm512_permutexvar_epi8(idxs, src.r)}, num * tDst);
+  }
+#else
+  // First, pack the data bytes at the bottom of each 128-bit lane.
+  // In the example (M == 5, N == 8, tSize == 4):
+  // 00000···|11111···|22222···|33333··· → 0000011111······|2222233333······
+  static constexpr auto idxs_arr = mb::pack_indices_128<tDst, src_bytes>;
+  // The number of data bytes in each 128-bit lane.
+  static constexpr std::size_t lane_bytes = (16 / src_bytes) * tDst;
+  const auto idxs8 = static_apply<vector_bytes>([]<std::size_t... tIdxs>() {
+    return set(type_tag<NativeVector<i8, vector_bytes>>, idxs_arr[tIdxs % 16]...).r;
+  });
+#if GREX_X86_64_LEVEL >= 4
+  // Then move the packed lanes next to each other, which is possible using 16-bit permutations
+  // since `lane_bytes` is always even.
+  // 0000011111······|2222233333······ → 00000111112222233333············
+  const auto idxs16 = static_apply<vector_bytes / 2>([]<std::size_t... tIdxs>() {
+    return set(type_tag<NativeVector<u16, vector_bytes / 2>>,
+               u16((tIdxs / (lane_bytes / 2)) * 8 + tIdxs % (lane_bytes / 2))...)
+      .r;
+  });
+  if constexpr (vector_bytes == 32) {
+    const __m256i packed = _mm256_shuffle_epi8(src.r, idxs8);
+    store_part(ptr, Bytes{_mm256_permutexvar_epi16(idxs16, packed)}, num * tDst);
+  } else {
+    const __m512i packed = _mm512_shuffle_epi8(src.r, idxs8);
+    store_part(ptr, Bytes{_mm512_permutexvar_epi16(idxs16, packed)}, num * tDst);
+  }
+#else
+  const __m256i packed = _mm256_shuffle_epi8(src.r, idxs8);
+  if constexpr (lane_bytes % 4 == 0) {
+    // Move the packed lanes next to each other using a 32-bit permutation.
+    const auto idxs32 = static_apply<8>([]<std::size_t... tIdxs>() {
+      return _mm256_setr_epi32(i32((tIdxs / (lane_bytes / 4)) * 4 + tIdxs % (lane_bytes / 4))...);
+    });
+    store_part(ptr, Bytes{_mm256_permutevar8x32_epi32(packed, idxs32)}, num * tDst);
+  } else {
+    // Store both lanes separately.
+    const std::size_t lower = std::min(num, tSize / 2);
+    store_part(ptr, u8x16{_mm256_castsi256_si128(packed)}, lower * tDst);
+    if (num > tSize / 2) {
+      store_part(ptr + lane_bytes, u8x16{_mm256_extracti128_si256(packed, 1)},
+                 (num - tSize / 2) * tDst);
+    }
+  }
+#endif
+#endif
+}
+#endif
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_MULTIBYTE_HPP
@@ -0,0 +1,80 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_PREFIX_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_PREFIX_HPP
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/macros/intrinsics.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Slide the bytes of `v` up by `tBytes`, shifting in the highest `tBytes` bytes of `front`
+template<std::size_t tBytes>
+inline __m128i slide_up_bytes(__m128i front, __m128i v, IndexTag<tBytes> /*bytes*/) {
+#if GREX_X86_64_LEVEL >= 2
+  return _mm_alignr_epi8(v, front, 16 - tBytes);
+#else
+  return _mm_or_si128(_mm_bslli_si128(v, tBytes), _mm_bsrli_si128(front, 16 - tBytes));
+#endif
+}
+#if GREX_X86_64_LEVEL >= 3
+// 256 bits: alignr within the 128-bit lanes, with the lanes of `v` moved up by one lane
+template<std::size_t tBytes>
+inline __m256i slide_up_bytes(__m256i front, __m256i v, IndexTag<tBytes> /*bytes*/) {
+  // [front[16:], v[:16]]
+  const __m256i lanes = _mm256_permute2x128_si256(v, front, 0x03);
+  if constexpr (tBytes < 16) {
+    return _mm256_alignr_epi8(v, lanes, 16 - tBytes);
+  } else if constexpr (tBytes == 16) {
+    return lanes;
+  } else {
+    return _mm256_alignr_epi8(lanes, front, 32 - tBytes);
+  }
+}
+#endif
+#if GREX_X86_64_LEVEL >= 4
+// 512 bits: alignr across the whole register for multiples of four bytes,
+// otherwise analogous to 256 bits with _mm512_alignr_epi64 to move the lanes up by one lane
+template<std::size_t tBytes>
+inline __m512i slide_up_bytes(__m512i front, __m512i v, IndexTag<tBytes> /*bytes*/) {
+  if constexpr (tBytes % 4 == 0) {
+    return _mm512_alignr_epi32(v, front, 16 - tBytes / 4);
+  } else {
+    static_assert(tBytes < 16);
+    const __m512i lanes = _mm512_alignr_epi64(v, front, 6);
+    return _mm512_alignr_epi8(v, lanes, 16 - tBytes);
+  }
+}
+#endif
+
+#define GREX_SLIDE_UP(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  template<std::size_t tNum> \
+  requires(tNum < SIZE) \
+  inline NativeVector<KIND##BITS, SIZE> slide_up(NativeVector<KIND##BITS, SIZE> front, \
+                                                 NativeVector<KIND##BITS, SIZE> v, \
+                                                 IndexTag<tNum> /*num*/) { \
+    const auto ifront = GREX_KINDCAST(KIND, i, BITS, REGISTERBITS, front.r); \
+    const auto ivec = GREX_KINDCAST(KIND, i, BITS, REGISTERBITS, v.r); \
+    const auto slid = slide_up_bytes(ifront, ivec, index_tag<tNum * BITS / 8>); \
+    return {.r = GREX_KINDCAST(i, KIND, BITS, REGISTERBITS, slid)}; \
+  }
+#define GREX_SLIDE_UP_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_TYPE(GREX_SLIDE_UP, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_SLIDE_UP_ALL)
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/prefix.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_PREFIX_HPP
@@ -0,0 +1,54 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_ROTATE_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_ROTATE_HPP
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/operations/set.hpp"
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+namespace grex::backend {
+// Rotations of 32/64-bit integers are supported natively from level 4,
+// all other rotations are composed of two shifts
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_ROTATE_IMPL(KIND, BITS, SIZE, BITPREFIX, NAME, INSTR) \
+  inline NativeVector<KIND##BITS, SIZE> NAME(NativeVector<KIND##BITS, SIZE> v, \
+                                             AnyIndexTag auto offset) { \
+    return {.r = BITPREFIX##_##INSTR##_epi##BITS(v.r, int(offset.value % BITS))}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> NAME(NativeVector<KIND##BITS, SIZE> v, \
+                                             std::size_t offset) { \
+    const auto voffset = broadcast(u##BITS(offset), type_tag<NativeVector<u##BITS, SIZE>>); \
+    return {.r = BITPREFIX##_##INSTR##v_epi##BITS(v.r, voffset.r)}; \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> NAME(NativeVector<KIND##BITS, SIZE> v, \
+                                             NativeVector<u##BITS, SIZE> offsets) { \
+    return {.r = BITPREFIX##_##INSTR##v_epi##BITS(v.r, offsets.r)}; \
+  }
+#define GREX_ROTATE(KIND, BITS, SIZE, BITPREFIX) \
+  GREX_ROTATE_IMPL(KIND, BITS, SIZE, BITPREFIX, rotate_left, rol) \
+  GREX_ROTATE_IMPL(KIND, BITS, SIZE, BITPREFIX, rotate_right, ror)
+#define GREX_ROTATE_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_ROTATE(u, 32, GREX_DIVIDE(REGISTERBITS, 32), BITPREFIX) \
+  GREX_ROTATE(i, 32, GREX_DIVIDE(REGISTERBITS, 32), BITPREFIX) \
+  GREX_ROTATE(u, 64, GREX_DIVIDE(REGISTERBITS, 64), BITPREFIX) \
+  GREX_ROTATE(i, 64, GREX_DIVIDE(REGISTERBITS, 64), BITPREFIX)
+GREX_FOREACH_X86_64_LEVEL(GREX_ROTATE_ALL)
+#endif
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/rotate.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_ROTATE_HPP
@@ -0,0 +1,181 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_SCATTER_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_SCATTER_HPP
+
+#include <cstddef>
+#include <span>
+
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/x86/operations/mask-bits.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/operations/to-array.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/types.hpp" // IWYU pragma: keep
+
+#if GREX_X86_64_LEVEL >= 4
+#include <immintrin.h>
+
+#include "grex/backend/base.hpp"
+#include "grex/backend/choosers.hpp"
+#include "grex/backend/macros/base.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/macros/intrinsics.hpp"
+#include "grex/backend/x86/operations/bitwise.hpp"
+#include "grex/backend/x86/operations/convert.hpp"
+#include "grex/backend/x86/operations/set.hpp"
+#include "grex/base.hpp"
+#endif
+
+// shared definitions
+#include "grex/backend/shared/operations/scatter.hpp" // IWYU pragma: export
+
+namespace grex::backend {
+// AVX-512 provides scatter instructions for 32- and 64-bit values with 32- and 64-bit indices,
+// which write the lanes in ascending order just like the shared definitions
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_SCATTER_CAST_F32 data.data()
+#define GREX_SCATTER_CAST_F64 data.data()
+#define GREX_SCATTER_CAST_I32 reinterpret_cast<int*>(data.data())
+#define GREX_SCATTER_CAST_I64 reinterpret_cast<long long*>(data.data())
+#define GREX_SCATTER_CAST_f(BITS) GREX_SCATTER_CAST_F##BITS
+#define GREX_SCATTER_CAST_i(BITS) GREX_SCATTER_CAST_I##BITS
+#define GREX_SCATTER_CAST_u(BITS) GREX_SCATTER_CAST_I##BITS
+#define GREX_SCATTER_CAST(KIND, BITS) GREX_SCATTER_CAST_##KIND(BITS)
+
+#define GREX_SCATTER_DEFINE(VALKIND, VALBITS, IDXKIND, IDXBITS, SIZE, REGISTERBITS) \
+  template<std::size_t tExtent> \
+  inline void scatter(std::span<VALKIND##VALBITS, tExtent> data, \
+                      VectorFor<IDXKIND##IDXBITS, SIZE> idxs, \
+                      VectorFor<VALKIND##VALBITS, SIZE> v) { \
+    GREX_CAT(GREX_BITPREFIX(REGISTERBITS), _i##IDXBITS##scatter_, \
+             GREX_EPI_SUFFIX(VALKIND, VALBITS))( \
+      GREX_SCATTER_CAST(VALKIND, VALBITS), idxs.registr(), v.registr(), GREX_DIVIDE(VALBITS, 8)); \
+  } \
+  template<std::size_t tExtent> \
+  inline void mask_scatter(std::span<VALKIND##VALBITS, tExtent> data, \
+                           MaskFor<VALKIND##VALBITS, SIZE> m, \
+                           VectorFor<IDXKIND##IDXBITS, SIZE> idxs, \
+                           VectorFor<VALKIND##VALBITS, SIZE> v) { \
+    GREX_CAT(GREX_BITPREFIX(REGISTERBITS), _mask_i##IDXBITS##scatter_, \
+             GREX_EPI_SUFFIX(VALKIND, VALBITS))(GREX_SCATTER_CAST(VALKIND, VALBITS), m.registr(), \
+                                                idxs.registr(), v.registr(), \
+                                                GREX_DIVIDE(VALBITS, 8)); \
+  }
+
+// i32 indices
+// up to 128 bits
+GREX_SCATTER_DEFINE(f, 64, i, 32, 2, 128)
+GREX_SCATTER_DEFINE(i, 64, i, 32, 2, 128)
+GREX_SCATTER_DEFINE(u, 64, i, 32, 2, 128)
+GREX_SCATTER_DEFINE(f, 32, i, 32, 4, 128)
+GREX_SCATTER_DEFINE(i, 32, i, 32, 4, 128)
+GREX_SCATTER_DEFINE(u, 32, i, 32, 4, 128)
+// up to 256 bits
+GREX_SCATTER_DEFINE(f, 64, i, 32, 4, 256)
+GREX_SCATTER_DEFINE(i, 64, i, 32, 4, 256)
+GREX_SCATTER_DEFINE(u, 64, i, 32, 4, 256)
+GREX_SCATTER_DEFINE(f, 32, i, 32, 8, 256)
+GREX_SCATTER_DEFINE(i, 32, i, 32, 8, 256)
+GREX_SCATTER_DEFINE(u, 32, i, 32, 8, 256)
+// up to 512 bits
+GREX_SCATTER_DEFINE(f, 64, i, 32, 8, 512)
+GREX_SCATTER_DEFINE(i, 64, i, 32, 8, 512)
+GREX_SCATTER_DEFINE(u, 64, i, 32, 8, 512)
+GREX_SCATTER_DEFINE(f, 32, i, 32, 16, 512)
+GREX_SCATTER_DEFINE(i, 32, i, 32, 16, 512)
+GREX_SCATTER_DEFINE(u, 32, i, 32, 16, 512)
+
+// i64 indices
+// up to 128 bits
+GREX_SCATTER_DEFINE(f, 64, i, 64, 2, 128)
+GREX_SCATTER_DEFINE(i, 64, i, 64, 2, 128)
+GREX_SCATTER_DEFINE(u, 64, i, 64, 2, 128)
+GREX_SCATTER_DEFINE(f, 32, i, 64, 2, 128)
+GREX_SCATTER_DEFINE(i, 32, i, 64, 2, 128)
+GREX_SCATTER_DEFINE(u, 32, i, 64, 2, 128)
+// up to 256 bits
+GREX_SCATTER_DEFINE(f, 64, i, 64, 4, 256)
+GREX_SCATTER_DEFINE(i, 64, i, 64, 4, 256)
+GREX_SCATTER_DEFINE(u, 64, i, 64, 4, 256)
+GREX_SCATTER_DEFINE(f, 32, i, 64, 4, 256)
+GREX_SCATTER_DEFINE(i, 32, i, 64, 4, 256)
+GREX_SCATTER_DEFINE(u, 32, i, 64, 4, 256)
+// up to 512 bits
+GREX_SCATTER_DEFINE(f, 64, i, 64, 8, 512)
+GREX_SCATTER_DEFINE(i, 64, i, 64, 8, 512)
+GREX_SCATTER_DEFINE(u, 64, i, 64, 8, 512)
+GREX_SCATTER_DEFINE(f, 32, i, 64, 8, 512)
+GREX_SCATTER_DEFINE(i, 32, i, 64, 8, 512)
+GREX_SCATTER_DEFINE(u, 32, i, 64, 8, 512)
+
+// i64 indices: The virtual address space is far below 63 bits, i.e. we ignore the signedness
+// up to 128 bits
+GREX_SCATTER_DEFINE(f, 64, u, 64, 2, 128)
+GREX_SCATTER_DEFINE(i, 64, u, 64, 2, 128)
+GREX_SCATTER_DEFINE(u, 64, u, 64, 2, 128)
+GREX_SCATTER_DEFINE(f, 32, u, 64, 2, 128)
+GREX_SCATTER_DEFINE(i, 32, u, 64, 2, 128)
+GREX_SCATTER_DEFINE(u, 32, u, 64, 2, 128)
+// up to 256 bits
+GREX_SCATTER_DEFINE(f, 64, u, 64, 4, 256)
+GREX_SCATTER_DEFINE(i, 64, u, 64, 4, 256)
+GREX_SCATTER_DEFINE(u, 64, u, 64, 4, 256)
+GREX_SCATTER_DEFINE(f, 32, u, 64, 4, 256)
+GREX_SCATTER_DEFINE(i, 32, u, 64, 4, 256)
+GREX_SCATTER_DEFINE(u, 32, u, 64, 4, 256)
+// up to 512 bits
+GREX_SCATTER_DEFINE(f, 64, u, 64, 8, 512)
+GREX_SCATTER_DEFINE(i, 64, u, 64, 8, 512)
+GREX_SCATTER_DEFINE(u, 64, u, 64, 8, 512)
+GREX_SCATTER_DEFINE(f, 32, u, 64, 8, 512)
+GREX_SCATTER_DEFINE(i, 32, u, 64, 8, 512)
+GREX_SCATTER_DEFINE(u, 32, u, 64, 8, 512)
+
+// 8- and 16-bit indices: convert to i32
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+requires(sizeof(TValue) >= 4 && sizeof(TIndex) <= 2)
+inline void scatter(std::span<TValue, tExtent> data, NativeVector<TIndex, tSize> idxs,
+                    VectorFor<TValue, tSize> v) {
+  scatter(data, convert(idxs, type_tag<i32>), v);
+}
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+requires(sizeof(TValue) >= 4 && sizeof(TIndex) <= 2)
+inline void mask_scatter(std::span<TValue, tExtent> data, MaskFor<TValue, tSize> m,
+                         NativeVector<TIndex, tSize> idxs, VectorFor<TValue, tSize> v) {
+  mask_scatter(data, m, convert(idxs, type_tag<i32>), v);
+}
+
+// u32: Shift the base pointer for large spans (see gather for details)
+template<Vectorizable TValue, std::size_t tExtent, std::size_t tSize>
+requires(sizeof(TValue) >= 4)
+inline void scatter(std::span<TValue, tExtent> data, NativeVector<u32, tSize> idxs,
+                    VectorFor<TValue, tSize> v) {
+  constexpr u32 limit = std::size_t{1} << 31;
+  if (data.size() >= limit) {
+    const auto flipped = bitwise_xor(idxs, broadcast(limit, type_tag<NativeVector<u32, tSize>>));
+    scatter(std::span{data.data() + limit, data.size() - limit},
+            convert(flipped, type_tag<i32>), v);
+    return;
+  }
+  scatter(data, convert(idxs, type_tag<i32>), v);
+}
+template<Vectorizable TValue, std::size_t tExtent, std::size_t tSize>
+requires(sizeof(TValue) >= 4)
+inline void mask_scatter(std::span<TValue, tExtent> data, MaskFor<TValue, tSize> m,
+                         NativeVector<u32, tSize> idxs, VectorFor<TValue, tSize> v) {
+  constexpr u32 limit = std::size_t{1} << 31;
+  if (data.size() >= limit) {
+    const auto flipped = bitwise_xor(idxs, broadcast(limit, type_tag<NativeVector<u32, tSize>>));
+    mask_scatter(std::span{data.data() + limit, data.size() - limit}, m,
+                 convert(flipped, type_tag<i32>), v);
+    return;
+  }
+  mask_scatter(data, m, convert(idxs, type_tag<i32>), v);
+}
+#endif
+} // namespace grex::backend
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_SCATTER_HPP
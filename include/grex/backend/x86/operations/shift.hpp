@@ -7,12 +7,18 @@
 #ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_SHIFT_HPP
 #define INCLUDE_GREX_BACKEND_X86_OPERATIONS_SHIFT_HPP
 
+#include <bit>
+#include <cstddef>
+#include <limits>
+
 #include <immintrin.h>
 
 #include "grex/backend/base.hpp"
 #include "grex/backend/macros/base.hpp"
 #include "grex/backend/macros/for-each.hpp"
+#include "grex/backend/macros/math.hpp"
 #include "grex/backend/shared/operations/shift.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/instruction-sets.hpp"
 #include "grex/backend/x86/macros/for-each.hpp"
 #include "grex/backend/x86/operations/set.hpp"
 #include "grex/backend/x86/types.hpp"
@@ -95,6 +101,224 @@ GREX_FOREACH_X86_64_LEVEL(GREX_LSHIFT_ALL)
 #define GREX_RSHIFT_ALL(REGISTERBITS, BITPREFIX) \
   GREX_FOREACH_INT_TYPE(GREX_RSHIFT, REGISTERBITS, BITPREFIX, REGISTERBITS)
 GREX_FOREACH_X86_64_LEVEL(GREX_RSHIFT_ALL)
+
+// Shifts by a runtime offset shared by all lanes
+#define GREX_SHIFT_COUNT _mm_cvtsi64_si128(i64(offset))
+#define GREX_LSHIFTR_INTRINSIC(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = BITPREFIX##_sll_epi##BITS(v.r, GREX_SHIFT_COUNT)};
+#define GREX_LSHIFTR_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  const auto ret16 = BITPREFIX##_sll_epi16(v.r, GREX_SHIFT_COUNT); \
+  const auto mask = broadcast(u8(u8(-1) << offset), type_tag<u8x##SIZE>).r; \
+  return {.r = BITPREFIX##_and_si##REGISTERBITS(ret16, mask)};
+#define GREX_LSHIFTR_16 GREX_LSHIFTR_INTRINSIC
+#define GREX_LSHIFTR_32 GREX_LSHIFTR_INTRINSIC
+#define GREX_LSHIFTR_64 GREX_LSHIFTR_INTRINSIC
+
+#define GREX_LSHIFTR(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> shift_left(NativeVector<KIND##BITS, SIZE> v, \
+                                                   std::size_t offset) { \
+    GREX_LSHIFTR_##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_LSHIFTR_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE(GREX_LSHIFTR, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_LSHIFTR_ALL)
+
+#define GREX_SRL_INTRINSIC(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = BITPREFIX##_srl_epi##BITS(v.r, GREX_SHIFT_COUNT)};
+#define GREX_RSHIFTR_u8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  const auto ret16 = BITPREFIX##_srl_epi16(v.r, GREX_SHIFT_COUNT); \
+  const auto mask = broadcast(u8(u8(-1) >> offset), type_tag<u8x##SIZE>).r; \
+  return {.r = BITPREFIX##_and_si##REGISTERBITS(ret16, mask)};
+#define GREX_RSHIFTR_u16 GREX_SRL_INTRINSIC
+#define GREX_RSHIFTR_u32 GREX_SRL_INTRINSIC
+#define GREX_RSHIFTR_u64 GREX_SRL_INTRINSIC
+
+// Arithmetic shifts without an intrinsic: Shift logically, then extend the sign by flipping
+// the shifted sign bit and subtracting it
+#define GREX_SRA_EMULATED(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  const auto shifted = shift_right(NativeVector<u##BITS, SIZE>{.r = v.r}, offset).r; \
+  const auto sign = broadcast(u##BITS(u##BITS{1} << (BITS - 1 - offset)), \
+                              type_tag<u##BITS##x##SIZE>).r; \
+  const auto flipped = BITPREFIX##_xor_si##REGISTERBITS(shifted, sign); \
+  return {.r = BITPREFIX##_sub_epi##BITS(flipped, sign)};
+#define GREX_SRA_INTRINSIC(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = BITPREFIX##_sra_epi##BITS(v.r, GREX_SHIFT_COUNT)};
+#define GREX_RSHIFTR_i8 GREX_SRA_EMULATED
+#define GREX_RSHIFTR_i16 GREX_SRA_INTRINSIC
+#define GREX_RSHIFTR_i32 GREX_SRA_INTRINSIC
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_RSHIFTR_i64 GREX_SRA_INTRINSIC
+#else
+#define GREX_RSHIFTR_i64 GREX_SRA_EMULATED
+#endif
+
+#define GREX_RSHIFTR(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> shift_right(NativeVector<KIND##BITS, SIZE> v, \
+                                                    std::size_t offset) { \
+    GREX_RSHIFTR_##KIND##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_RSHIFTR_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE(GREX_RSHIFTR, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_RSHIFTR_ALL)
+// Shifts by per-lane offsets, each of which needs to be smaller than the number of bits
+// Native instructions are available for 32/64 bit from level 3 (except for arithmetic shifts
+// of 64-bit integers, which require level 4) and for 16 bit from level 4.
+#define GREX_SHIFTV_NATIVE(BITS, BITPREFIX, INSTR) \
+  return {.r = BITPREFIX##_##INSTR##_epi##BITS(v.r, offsets.r)};
+// Shift the even-numbered and odd-numbered elements separately using double-width shifts,
+// where `lomask` selects the lower halves of the double-width elements
+#define GREX_SHIFTV_LOMASK(BITS, WIDEBITS, BITPREFIX) \
+  const auto lomask = BITPREFIX##_srli_epi##WIDEBITS(BITPREFIX##_set1_epi32(-1), BITS);
+#define GREX_SHIFTV_WIDE_LEFT(BITS, WIDEBITS, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_LOMASK(BITS, WIDEBITS, BITPREFIX) \
+  /* only the lower halves are relevant, into which no other bits are shifted */ \
+  const auto even = BITPREFIX##_sllv_epi##WIDEBITS( \
+    v.r, BITPREFIX##_and_si##REGISTERBITS(offsets.r, lomask)); \
+  const auto odd = \
+    BITPREFIX##_sllv_epi##WIDEBITS(BITPREFIX##_andnot_si##REGISTERBITS(lomask, v.r), \
+                                   BITPREFIX##_srli_epi##WIDEBITS(offsets.r, BITS)); \
+  return {.r = BITPREFIX##_or_si##REGISTERBITS(BITPREFIX##_and_si##REGISTERBITS(even, lomask), \
+                                               odd)};
+#define GREX_SHIFTV_WIDE_RIGHT_u(BITS, WIDEBITS, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_LOMASK(BITS, WIDEBITS, BITPREFIX) \
+  const auto even = \
+    BITPREFIX##_srlv_epi##WIDEBITS(BITPREFIX##_and_si##REGISTERBITS(v.r, lomask), \
+                                   BITPREFIX##_and_si##REGISTERBITS(offsets.r, lomask)); \
+  /* only the upper halves are relevant, into which no other bits are shifted */ \
+  const auto odd = \
+    BITPREFIX##_srlv_epi##WIDEBITS(v.r, BITPREFIX##_srli_epi##WIDEBITS(offsets.r, BITS)); \
+  return {.r = BITPREFIX##_or_si##REGISTERBITS(even, \
+                                               BITPREFIX##_andnot_si##REGISTERBITS(lomask, odd))};
+#define GREX_SHIFTV_WIDE_RIGHT_i(BITS, WIDEBITS, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_LOMASK(BITS, WIDEBITS, BITPREFIX) \
+  /* shift the lower halves into the upper halves for the arithmetic shift and back */ \
+  const auto even = BITPREFIX##_srli_epi##WIDEBITS( \
+    BITPREFIX##_srav_epi##WIDEBITS(BITPREFIX##_slli_epi##WIDEBITS(v.r, BITS), \
+                                   BITPREFIX##_and_si##REGISTERBITS(offsets.r, lomask)), \
+    BITS); \
+  /* only the upper halves are relevant, into which no other bits are shifted */ \
+  const auto odd = \
+    BITPREFIX##_srav_epi##WIDEBITS(v.r, BITPREFIX##_srli_epi##WIDEBITS(offsets.r, BITS)); \
+  return {.r = BITPREFIX##_or_si##REGISTERBITS(even, \
+                                               BITPREFIX##_andnot_si##REGISTERBITS(lomask, odd))};
+// No double-width shifts either: Shift by each power of two in turn, selecting the shifted
+// elements whose offset contains that power of two using a blend.
+// For 8 bit, `pblendvb` only needs the offset bit to be moved into the most significant bit.
+#if GREX_X86_64_LEVEL >= 2
+#define GREX_SHIFTV_BLEND(BITPREFIX, REGISTERBITS, A, B, M) BITPREFIX##_blendv_epi8(A, B, M)
+#define GREX_SHIFTV_SELECT_8(BITPREFIX, BIT) BITPREFIX##_slli_epi16(offsets.r, int(7 - (BIT)))
+#else
+#define GREX_SHIFTV_BLEND(BITPREFIX, REGISTERBITS, A, B, M) \
+  BITPREFIX##_or_si##REGISTERBITS(BITPREFIX##_and_si##REGISTERBITS(M, B), \
+                                  BITPREFIX##_andnot_si##REGISTERBITS(M, A))
+#define GREX_SHIFTV_SELECT_8(BITPREFIX, BIT) \
+  BITPREFIX##_cmplt_epi8(BITPREFIX##_slli_epi16(offsets.r, int(7 - (BIT))), \
+                         BITPREFIX##_setzero_si128())
+#endif
+#define GREX_SHIFTV_SELECT_WIDE(BITS, BITPREFIX, BIT) \
+  BITPREFIX##_srai_epi##BITS(BITPREFIX##_slli_epi##BITS(offsets.r, int(BITS - 1 - (BIT))), \
+                             BITS - 1)
+#define GREX_SHIFTV_SELECT_16(BITPREFIX, BIT) GREX_SHIFTV_SELECT_WIDE(16, BITPREFIX, BIT)
+#define GREX_SHIFTV_SELECT_32(BITPREFIX, BIT) GREX_SHIFTV_SELECT_WIDE(32, BITPREFIX, BIT)
+#define GREX_SHIFTV_SERIAL(BITS, BITPREFIX, REGISTERBITS, NAME) \
+  static_apply<std::bit_width(BITS - 1U)>([&]<std::size_t... tBits>() { \
+    (..., (v = {.r = GREX_SHIFTV_BLEND(BITPREFIX, REGISTERBITS, v.r, \
+                                       NAME(v, index_tag<std::size_t{1} << tBits>).r, \
+                                       GREX_SHIFTV_SELECT_##BITS(BITPREFIX, tBits))})); \
+  }); \
+  return v;
+// 64 bit below level 3: Shift by the two offsets separately
+#define GREX_SHIFTV_TWICE(INSTR, X) \
+  _mm_castpd_si128(_mm_move_sd( \
+    _mm_castsi128_pd(_mm_##INSTR##_epi64(X, _mm_unpackhi_epi64(offsets.r, offsets.r))), \
+    _mm_castsi128_pd(_mm_##INSTR##_epi64(X, offsets.r))))
+// Arithmetic 64-bit shifts below level 4: Shift logically, then extend the sign by flipping
+// the shifted sign bit and subtracting it
+#define GREX_SHIFTV_SRA64(BITPREFIX, REGISTERBITS, SRL) \
+  const auto sign = BITPREFIX##_set1_epi64x(std::numeric_limits<i64>::min()); \
+  const auto shifted = SRL(BITPREFIX, v.r); \
+  const auto shsign = SRL(BITPREFIX, sign); \
+  return {.r = BITPREFIX##_sub_epi64(BITPREFIX##_xor_si##REGISTERBITS(shifted, shsign), shsign)};
+
+#if GREX_X86_64_LEVEL >= 4
+#define GREX_SHIFTV_LEFT_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_LEFT(8, 16, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_RIGHT_u8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_RIGHT_u(8, 16, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_RIGHT_i8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_RIGHT_i(8, 16, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_LEFT_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(16, BITPREFIX, sllv)
+#define GREX_SHIFTV_RIGHT_u16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(16, BITPREFIX, srlv)
+#define GREX_SHIFTV_RIGHT_i16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(16, BITPREFIX, srav)
+#define GREX_SHIFTV_RIGHT_i64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(64, BITPREFIX, srav)
+#elif GREX_X86_64_LEVEL == 3
+#define GREX_SHIFTV_LEFT_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(8, BITPREFIX, REGISTERBITS, shift_left)
+#define GREX_SHIFTV_RIGHT_u8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(8, BITPREFIX, REGISTERBITS, shift_right)
+#define GREX_SHIFTV_RIGHT_i8 GREX_SHIFTV_RIGHT_u8
+#define GREX_SHIFTV_LEFT_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_LEFT(16, 32, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_RIGHT_u16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_RIGHT_u(16, 32, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_RIGHT_i16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_WIDE_RIGHT_i(16, 32, BITPREFIX, REGISTERBITS)
+#define GREX_SHIFTV_SRLV64(BITPREFIX, X) BITPREFIX##_srlv_epi64(X, offsets.r)
+#define GREX_SHIFTV_RIGHT_i64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SRA64(BITPREFIX, REGISTERBITS, GREX_SHIFTV_SRLV64)
+#else
+#define GREX_SHIFTV_LEFT_8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(8, BITPREFIX, REGISTERBITS, shift_left)
+#define GREX_SHIFTV_RIGHT_u8(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(8, BITPREFIX, REGISTERBITS, shift_right)
+#define GREX_SHIFTV_RIGHT_i8 GREX_SHIFTV_RIGHT_u8
+#define GREX_SHIFTV_LEFT_16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(16, BITPREFIX, REGISTERBITS, shift_left)
+#define GREX_SHIFTV_RIGHT_u16(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(16, BITPREFIX, REGISTERBITS, shift_right)
+#define GREX_SHIFTV_RIGHT_i16 GREX_SHIFTV_RIGHT_u16
+#define GREX_SHIFTV_LEFT_32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(32, BITPREFIX, REGISTERBITS, shift_left)
+#define GREX_SHIFTV_RIGHT_u32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SERIAL(32, BITPREFIX, REGISTERBITS, shift_right)
+#define GREX_SHIFTV_RIGHT_i32 GREX_SHIFTV_RIGHT_u32
+#define GREX_SHIFTV_LEFT_64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_SHIFTV_TWICE(sll, v.r)};
+#define GREX_SHIFTV_RIGHT_u64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  return {.r = GREX_SHIFTV_TWICE(srl, v.r)};
+#define GREX_SHIFTV_SRL64(BITPREFIX, X) GREX_SHIFTV_TWICE(srl, X)
+#define GREX_SHIFTV_RIGHT_i64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_SRA64(BITPREFIX, REGISTERBITS, GREX_SHIFTV_SRL64)
+#endif
+#if GREX_X86_64_LEVEL >= 3
+#define GREX_SHIFTV_LEFT_32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(32, BITPREFIX, sllv)
+#define GREX_SHIFTV_RIGHT_u32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(32, BITPREFIX, srlv)
+#define GREX_SHIFTV_RIGHT_i32(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(32, BITPREFIX, srav)
+#define GREX_SHIFTV_LEFT_64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(64, BITPREFIX, sllv)
+#define GREX_SHIFTV_RIGHT_u64(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  GREX_SHIFTV_NATIVE(64, BITPREFIX, srlv)
+#endif
+
+#define GREX_SHIFTV(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  inline NativeVector<KIND##BITS, SIZE> shift_left(NativeVector<KIND##BITS, SIZE> v, \
+                                                   NativeVector<u##BITS, SIZE> offsets) { \
+    GREX_SHIFTV_LEFT_##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  } \
+  inline NativeVector<KIND##BITS, SIZE> shift_right(NativeVector<KIND##BITS, SIZE> v, \
+                                                    NativeVector<u##BITS, SIZE> offsets) { \
+    GREX_SHIFTV_RIGHT_##KIND##BITS(KIND, BITS, SIZE, BITPREFIX, REGISTERBITS) \
+  }
+#define GREX_SHIFTV_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_FOREACH_INT_TYPE(GREX_SHIFTV, REGISTERBITS, BITPREFIX, REGISTERBITS)
+GREX_FOREACH_X86_64_LEVEL(GREX_SHIFTV_ALL)
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_SHIFT_HPP
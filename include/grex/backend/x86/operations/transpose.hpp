@@ -0,0 +1,136 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BACKEND_X86_OPERATIONS_TRANSPOSE_HPP
+#define INCLUDE_GREX_BACKEND_X86_OPERATIONS_TRANSPOSE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include <immintrin.h>
+
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/instruction-sets.hpp"
+#include "grex/backend/macros/math.hpp"
+#include "grex/backend/x86/macros/for-each.hpp"
+#include "grex/backend/x86/operations/merge.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/operations/reinterpret.hpp"
+#include "grex/backend/x86/operations/shuffle-static.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/operations/split.hpp" // IWYU pragma: keep
+#include "grex/backend/x86/types.hpp"
+#include "grex/base.hpp"
+
+// Native vectors are transposed in two phases:
+// 1. Within each 128-bit lane, the L×L blocks (L lanes per 128 bits) are transposed using
+//    `unpacklo`/`unpackhi`: Round r combines the vectors x and x + 2^r (for x & 2^r == 0) at
+//    2^r times the lane width. This leaves the rows of each transposed block in bit-reversed order.
+// 2. For 256/512-bit vectors, the blocks are transposed as a whole by transposing the 128-bit
+//    lanes of each L-th vector using `permute2x128` or two rounds of `shuffle_i64x2`.
+
+namespace grex::backend {
+#define GREX_TRANSPOSE_UNPACK(BITS, REGISTERBITS, BITPREFIX) \
+  inline std::pair<NativeVector<u64, GREX_DIVIDE(REGISTERBITS, 64)>, \
+                   NativeVector<u64, GREX_DIVIDE(REGISTERBITS, 64)>> \
+  transpose_unpack(NativeVector<u64, GREX_DIVIDE(REGISTERBITS, 64)> a, \
+                   NativeVector<u64, GREX_DIVIDE(REGISTERBITS, 64)> b, IndexTag<BITS> /*bits*/) { \
+    return {{.r = BITPREFIX##_unpacklo_epi##BITS(a.r, b.r)}, \
+            {.r = BITPREFIX##_unpackhi_epi##BITS(a.r, b.r)}}; \
+  }
+#define GREX_TRANSPOSE_UNPACK_ALL(REGISTERBITS, BITPREFIX) \
+  GREX_TRANSPOSE_UNPACK(8, REGISTERBITS, BITPREFIX) \
+  GREX_TRANSPOSE_UNPACK(16, REGISTERBITS, BITPREFIX) \
+  GREX_TRANSPOSE_UNPACK(32, REGISTERBITS, BITPREFIX) \
+  GREX_TRANSPOSE_UNPACK(64, REGISTERBITS, BITPREFIX)
+GREX_FOREACH_X86_64_LEVEL(GREX_TRANSPOSE_UNPACK_ALL)
+
+#if GREX_X86_64_LEVEL >= 4
+// transpose four 128-bit lanes
+inline std::array<NativeVector<u64, 8>, 4> transpose_lanes(std::array<NativeVector<u64, 8>, 4> vs) {
+  const __m512i t0 = _mm512_shuffle_i64x2(vs[0].r, vs[1].r, 0x88);
+  const __m512i t1 = _mm512_shuffle_i64x2(vs[0].r, vs[1].r, 0xDD);
+  const __m512i t2 = _mm512_shuffle_i64x2(vs[2].r, vs[3].r, 0x88);
+  const __m512i t3 = _mm512_shuffle_i64x2(vs[2].r, vs[3].r, 0xDD);
+  return {{{.r = _mm512_shuffle_i64x2(t0, t2, 0x88)},
+           {.r = _mm512_shuffle_i64x2(t1, t3, 0x88)},
+           {.r = _mm512_shuffle_i64x2(t0, t2, 0xDD)},
+           {.r = _mm512_shuffle_i64x2(t1, t3, 0xDD)}}};
+}
+#endif
+#if GREX_X86_64_LEVEL >= 3
+// transpose two 128-bit lanes
+inline std::array<NativeVector<u64, 4>, 2> transpose_lanes(std::array<NativeVector<u64, 4>, 2> vs) {
+  return {{{.r = _mm256_permute2x128_si256(vs[0].r, vs[1].r, 0x20)},
+           {.r = _mm256_permute2x128_si256(vs[0].r, vs[1].r, 0x31)}}};
+}
+#endif
+
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::array<NativeVector<T, tSize>, tSize>
+transpose_square(std::array<NativeVector<T, tSize>, tSize> vs) {
+  using Carrier = NativeVector<u64, tSize * sizeof(T) / sizeof(u64)>;
+  static constexpr std::size_t lane_size = 16 / sizeof(T);
+  static constexpr std::size_t lane_num = tSize / lane_size;
+  static constexpr std::size_t lane_bits = std::bit_width(lane_size) - 1;
+
+  std::array<Carrier, tSize> rs = static_apply<tSize>([&]<std::size_t... tIdxs>() {
+    return std::array{reinterpret(vs[tIdxs], type_tag<u64>)...};
+  });
+
+  // transpose the blocks within the 128-bit lanes
+  auto round = [&]<std::size_t tRound>(IndexTag<tRound> /*round*/) GREX_ALWAYS_INLINE {
+    static constexpr std::size_t dist = std::size_t{1} << tRound;
+    static_apply<tSize>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      auto pair = [&](std::size_t x) GREX_ALWAYS_INLINE {
+        if ((x & dist) == 0) {
+          std::tie(rs[x], rs[x + dist]) =
+            transpose_unpack(rs[x], rs[x + dist], index_tag<sizeof(T) * 8 * dist>);
+        }
+      };
+      (..., pair(tIdxs));
+    });
+  };
+  static_apply<lane_bits>(
+    [&]<std::size_t... tRounds>() GREX_ALWAYS_INLINE { (..., round(index_tag<tRounds>)); });
+
+  // undo the bit reversal of the rows of each block
+  static constexpr auto row = [](std::size_t i) {
+    const std::size_t block = i / lane_size * lane_size;
+    std::size_t rev = 0;
+    for (std::size_t j = 0; j < lane_bits; ++j) {
+      rev |= ((i >> j) & 1U) << (lane_bits - 1 - j);
+    }
+    return block + rev;
+  };
+
+  // transpose the blocks by transposing the 128-bit lanes
+  if constexpr (lane_num > 1) {
+    static_apply<lane_size>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      auto lanes = [&](std::size_t i) GREX_ALWAYS_INLINE {
+        const auto ts = static_apply<lane_num>([&]<std::size_t... tLanes>() GREX_ALWAYS_INLINE {
+          return transpose_lanes(std::array{rs[row(tLanes * lane_size + i)]...});
+        });
+        static_apply<lane_num>([&]<std::size_t... tLanes>() GREX_ALWAYS_INLINE {
+          (..., (vs[tLanes * lane_size + i] =
+                   reinterpret(ts[tLanes], type_tag<T>)));
+        });
+      };
+      (..., lanes(tIdxs));
+    });
+    return vs;
+  } else {
+    return static_apply<tSize>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return std::array{reinterpret(rs[row(tIdxs)], type_tag<T>)...};
+    });
+  }
+}
+} // namespace grex::backend
+
+#include "grex/backend/shared/operations/transpose.hpp" // IWYU pragma: export
+
+#endif // INCLUDE_GREX_BACKEND_X86_OPERATIONS_TRANSPOSE_HPP
@@ -45,6 +45,20 @@ static constexpr bool is_subnative = tSize > 1 &&
                                      std::has_single_bit(tSize) && tSize < min_native_size<T>;
 template<Vectorizable T, std::size_t tSize>
 static constexpr bool is_supernative = std::has_single_bit(tSize) && tSize > max_native_size<T>;
+
+// The largest table size in bytes for which dynamic shuffles (combining the parts of tables
+// spread across several registers using blends) are faster than gathers, based on benchmarks.
+// Level 1 lacks pshufb, while level 4 can combine two registers using `vpermi2*`.
+template<Vectorizable T>
+#if GREX_X86_64_LEVEL >= 4
+static constexpr std::size_t max_shuffle_table_bytes = 256;
+#elif GREX_X86_64_LEVEL >= 3
+static constexpr std::size_t max_shuffle_table_bytes = (sizeof(T) == 1) ? 128 : 64;
+#elif GREX_X86_64_LEVEL >= 2
+static constexpr std::size_t max_shuffle_table_bytes = (sizeof(T) == 1) ? 128 : 32;
+#else
+static constexpr std::size_t max_shuffle_table_bytes = 0;
+#endif
 } // namespace grex::backend
 
 #endif // INCLUDE_GREX_BACKEND_X86_SIZES_HPP
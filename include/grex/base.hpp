@@ -45,6 +45,22 @@ using f32 = float;
 static_assert(std::numeric_limits<f32>::is_iec559 && sizeof(f32) == 4);
 using f64 = double;
 static_assert(std::numeric_limits<f64>::is_iec559 && sizeof(f64) == 8);
+
+// IEEE 754 binary16, which is only supported as a storage format,
+// i.e. it can be converted to and from `f32`/`f64` but there is no arithmetic
+struct f16 {
+  u16 bits;
+
+  friend bool operator==(f16, f16) = default;
+};
+static_assert(sizeof(f16) == 2);
+// bfloat16, i.e. the upper half of an f32, which is also only supported as a storage format
+struct bf16 {
+  u16 bits;
+
+  friend bool operator==(bf16, bf16) = default;
+};
+static_assert(sizeof(bf16) == 2);
 } // namespace primitives
 using namespace primitives;
 
@@ -74,6 +90,10 @@ template<typename T>
 concept Int32 = std::same_as<T, u32> || std::same_as<T, i32>;
 template<typename T>
 concept Int64 = std::same_as<T, u64> || std::same_as<T, i64>;
+template<typename T>
+concept NarrowIntVectorizable = Int8<T> || Int16<T>;
+template<typename T>
+concept WidenableIntVectorizable = Int8<T> || Int16<T> || Int32<T>;
 
 template<typename T>
 struct SignednessTrait;
@@ -123,6 +143,8 @@ template<FloatVectorizable T>
 using FloatSize = UnsignedInt<sizeof(T)>;
 template<typename T, std::size_t tBytes>
 using CopySignInt = std::conditional_t<is_signed<T>, SignedInt<tBytes>, UnsignedInt<tBytes>>;
+template<WidenableIntVectorizable T>
+using WideInt = CopySignInt<T, 2 * sizeof(T)>;
 
 template<std::size_t tBytes>
 struct FloatTrait;
@@ -237,6 +259,36 @@ concept MultiByteIterator = requires(TIt it) {
   { it.raw() } -> std::convertible_to<const std::byte*>;
 };
 
+namespace detail {
+// Wrapping integer arithmetic, which vectors perform anyway, to avoid undefined behaviour for
+// scalars; floating-point values are added and subtracted as usual
+template<Vectorizable T>
+GREX_ALWAYS_INLINE constexpr T wrapping_add(T a, T b) {
+  if constexpr (IntVectorizable<T>) {
+    using Unsigned = UnsignedInt<sizeof(T)>;
+    return T(Unsigned(Unsigned(a) + Unsigned(b)));
+  } else {
+    return a + b;
+  }
+}
+template<Vectorizable T>
+GREX_ALWAYS_INLINE constexpr T wrapping_subtract(T a, T b) {
+  if constexpr (IntVectorizable<T>) {
+    using Unsigned = UnsignedInt<sizeof(T)>;
+    return T(Unsigned(Unsigned(a) - Unsigned(b)));
+  } else {
+    return a - b;
+  }
+}
+template<IntVectorizable T>
+GREX_ALWAYS_INLINE constexpr T wrapping_multiply(T a, T b) {
+  using Unsigned = UnsignedInt<sizeof(T)>;
+  // promote to unsigned int at least, since the product of two promoted u16 can overflow int
+  using Product = std::common_type_t<Unsigned, unsigned>;
+  return T(Unsigned(Product(Unsigned(a)) * Product(Unsigned(b))));
+}
+} // namespace detail
+
 template<std::size_t tIdx, typename T>
 using IdxType = T;
 
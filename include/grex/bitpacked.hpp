@@ -0,0 +1,89 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BITPACKED_HPP
+#define INCLUDE_GREX_BITPACKED_HPP
+
+#include <climits>
+#include <cstddef>
+
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include "grex/types.hpp"
+#endif
+
+// Blocks of unsigned integers with B bits each, which are stored contiguously starting at the
+// least significant bit of the first byte, as used by integer compression schemes.
+// Each block is decoded and encoded using the largest native vectors, whose bit offsets are known
+// at compile time, so that each vector only requires a fixed sequence of shuffles and shifts.
+
+namespace grex {
+/**
+ * Decodes the `tNum` unsigned integers with `tBits` bits each which are stored contiguously
+ * starting at the least significant bit of `data[0]`, i.e. in `tNum * tBits / 8` bytes,
+ * and writes them to `out`.
+ *
+ * `tNum` has to be a multiple of 16, e.g. 128 or 256. As with `Vector::load_multibyte`, memory
+ * beyond the end of the block may be read, which has to be padded accordingly.
+ */
+template<std::size_t tBits, std::size_t tNum, UnsignedIntVectorizable T>
+requires(sizeof(T) >= 4 && 1 <= tBits && tBits <= 32 && tNum % 16 == 0)
+GREX_ALWAYS_INLINE inline void load_bitpacked_block(const std::byte* data, T* out,
+                                                    IndexTag<tBits> bits,
+                                                    IndexTag<tNum> /*num*/) {
+#if GREX_BACKEND_SCALAR
+  for (std::size_t i = 0; i < tNum; ++i) {
+    out[i] = backend::load_bitpacked(data, i, bits, type_tag<T>);
+  }
+#else
+  static constexpr std::size_t size = max_native_size<T>;
+  static_apply<tNum / size>([&]<std::size_t... tIdxs>() {
+    auto op = [&]<std::size_t tIdx>(IndexTag<tIdx> /*idx*/) {
+      static constexpr std::size_t first = tIdx * size * tBits;
+      Vector<T, size>::load_bitpacked(data + first / CHAR_BIT, bits, index_tag<first % CHAR_BIT>)
+        .store(out + tIdx * size);
+    };
+    (..., op(index_tag<tIdxs>));
+  });
+#endif
+}
+
+/**
+ * Encodes the `tNum` values in `in` as unsigned integers with `tBits` bits each, which are
+ * stored contiguously starting at the least significant bit of `data[0]`,
+ * i.e. in `tNum * tBits / 8` bytes. This is the inverse of `load_bitpacked_block`.
+ *
+ * `tNum` has to be a multiple of 16, e.g. 128 or 256.
+ * Only the lower `tBits` bits of each value are stored and no memory beyond the block is written.
+ */
+template<std::size_t tBits, std::size_t tNum, UnsignedIntVectorizable T>
+requires(sizeof(T) >= 4 && 1 <= tBits && tBits <= 32 && tNum % 16 == 0)
+GREX_ALWAYS_INLINE inline void store_bitpacked_block(std::byte* data, const T* in,
+                                                     IndexTag<tBits> bits,
+                                                     IndexTag<tNum> /*num*/) {
+#if GREX_BACKEND_SCALAR
+  for (std::size_t i = 0; i < tNum; ++i) {
+    backend::store_bitpacked(data, i, in[i], bits);
+  }
+#else
+  // each vector keeps the bits of the previous one in its first byte
+  static constexpr std::size_t size = max_native_size<T>;
+  static_apply<tNum / size>([&]<std::size_t... tIdxs>() {
+    auto op = [&]<std::size_t tIdx>(IndexTag<tIdx> /*idx*/) {
+      static constexpr std::size_t first = tIdx * size * tBits;
+      Vector<T, size>::load(in + tIdx * size)
+        .store_bitpacked(data + first / CHAR_BIT, bits, index_tag<first % CHAR_BIT>);
+    };
+    (..., op(index_tag<tIdxs>));
+  });
+#endif
+}
+} // namespace grex
+
+#endif // INCLUDE_GREX_BITPACKED_HPP
@@ -0,0 +1,169 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_BYTE_CLASSIFIER_HPP
+#define INCLUDE_GREX_BYTE_CLASSIFIER_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+#include "grex/lookup-table.hpp"
+#include "grex/tags.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include "grex/operations-tagged.hpp"
+#include "grex/types.hpp"
+#endif
+
+// Byte classification uses two tables indexed by the low and the high nibble, respectively,
+// which are combined using a bitwise AND: A byte is in the set iff the result is non-zero.
+// To make this exact, the high nibbles are grouped by the set of low nibbles they are combined
+// with, each distinct set being assigned one of the eight bits. The table for the high nibbles
+// contains the bit of the respective set, while the table for the low nibbles contains the bits
+// of all sets containing the respective low nibble. If there are more than eight distinct sets,
+// the roles of the nibbles are swapped.
+// The tables are LookupTables, i.e. lookups of vectors use dynamic shuffles where these are
+// faster than gathers (`pshufb`, `vpermb`, or `tbl`).
+
+namespace grex {
+namespace detail {
+struct ByteClassTables {
+  std::array<u8, 16> lo{};
+  std::array<u8, 16> hi{};
+  bool valid = false;
+};
+
+// the tables for `chars` grouping the nibbles at bit offset `set_shift` by the sets of the other
+// nibbles they are combined with
+template<std::size_t tNum>
+constexpr ByteClassTables make_byte_class_tables(const std::array<u8, tNum>& chars,
+                                                 std::size_t set_shift) {
+  const std::size_t elem_shift = 4 - set_shift;
+  // for each nibble at `set_shift`, the set of the nibbles at `elem_shift` it is combined with
+  std::array<u16, 16> sets{};
+  for (const u8 c : chars) {
+    sets[(c >> set_shift) & 0xFU] |= u16(1U << ((c >> elem_shift) & 0xFU));
+  }
+
+  std::array<u16, 8> classes{};
+  std::size_t class_num = 0;
+  std::array<u8, 16> set_table{};
+  for (std::size_t i = 0; i < 16; ++i) {
+    if (sets[i] == 0) {
+      continue;
+    }
+    std::size_t j = 0;
+    while (j < class_num && classes[j] != sets[i]) {
+      ++j;
+    }
+    if (j == class_num) {
+      if (class_num == classes.size()) {
+        return {};
+      }
+      classes[class_num++] = sets[i];
+    }
+    set_table[i] = u8(1U << j);
+  }
+
+  std::array<u8, 16> elem_table{};
+  for (std::size_t i = 0; i < 16; ++i) {
+    for (std::size_t j = 0; j < class_num; ++j) {
+      if (((classes[j] >> i) & 1U) != 0) {
+        elem_table[i] |= u8(1U << j);
+      }
+    }
+  }
+
+  if (set_shift == 4) {
+    return {.lo = elem_table, .hi = set_table, .valid = true};
+  }
+  return {.lo = set_table, .hi = elem_table, .valid = true};
+}
+} // namespace detail
+
+/**
+ * Classifies bytes by whether they are one of the compile-time characters `tChars`.
+ *
+ * This requires that either the high nibbles or the low nibbles of the characters can be grouped
+ * into at most eight groups combined with the same nibbles of the other kind, which is the case
+ * for all sets of at most eight characters.
+ */
+template<auto... tChars>
+requires((std::integral<decltype(tChars)> && sizeof(tChars) == 1) && ...)
+struct ByteClassifier {
+  static constexpr std::array<u8, sizeof...(tChars)> chars{u8(tChars)...};
+  static constexpr detail::ByteClassTables tables = [] {
+    const detail::ByteClassTables by_hi = detail::make_byte_class_tables(chars, 4);
+    return by_hi.valid ? by_hi : detail::make_byte_class_tables(chars, 0);
+  }();
+  static_assert(tables.valid, "The characters cannot be classified using eight nibble groups!");
+
+  ByteClassifier() = default;
+
+  [[nodiscard]] bool matches(u8 c) const {
+    return (lo_.lookup(c & 0xFU) & hi_.lookup(c >> 4U)) != 0;
+  }
+  [[nodiscard]] bool matches(u8 c, AnyScalarTag auto /*tag*/) const {
+    return matches(c);
+  }
+
+#if !GREX_BACKEND_SCALAR
+  /** The mask of the lanes of `v` containing one of the characters. */
+  template<std::size_t tSize>
+  [[nodiscard]] Mask<u8, tSize> matches(Vector<u8, tSize> v) const {
+    using Vec = Vector<u8, tSize>;
+    const Vec lo = lo_.lookup(v & Vec{0x0F}, full_tag<tSize>);
+    const Vec hi = hi_.lookup(v >> index_tag<4>, full_tag<tSize>);
+    return (lo & hi) != Vec{};
+  }
+  /** The mask of the lanes of `v` containing one of the characters restricted to `tag`. */
+  template<std::size_t tSize>
+  [[nodiscard]] Mask<u8, tSize> matches(Vector<u8, tSize> v, AnyVectorTag auto tag) const {
+    return tag.mask(matches(v));
+  }
+#endif
+
+private:
+  LookupTable<u8, 16> lo_{tables.lo};
+  LookupTable<u8, 16> hi_{tables.hi};
+};
+
+/**
+ * The index of the first of the `num` bytes in `data` matched by `classifier`,
+ * or `num` if there is none.
+ */
+template<auto... tChars>
+GREX_ALWAYS_INLINE inline std::size_t find_first_of(const u8* data, std::size_t num,
+                                                    const ByteClassifier<tChars...>& classifier) {
+  std::size_t i = 0;
+#if !GREX_BACKEND_SCALAR
+  static constexpr std::size_t size = max_native_size<u8>;
+  using Vec = Vector<u8, size>;
+  for (; i + size <= num; i += size) {
+    if (const auto first = first_true(classifier.matches(Vec::load(data + i)))) {
+      return i + *first;
+    }
+  }
+  if (i < num) {
+    const Vec v = Vec::load_part(data + i, num - i);
+    const auto first = first_true(classifier.matches(v, part_tag<size>(num - i)));
+    return first.has_value() ? i + *first : num;
+  }
+#endif
+  for (; i < num; ++i) {
+    if (classifier.matches(data[i])) {
+      return i;
+    }
+  }
+  return num;
+}
+} // namespace grex
+
+#endif // INCLUDE_GREX_BYTE_CLASSIFIER_HPP
@@ -0,0 +1,236 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_DIVIDER_HPP
+#define INCLUDE_GREX_DIVIDER_HPP
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+#include "grex/operations.hpp"
+#include "grex/tags.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include "grex/types.hpp"
+#endif
+
+// Integer division by a runtime-invariant divisor.
+//
+// The division is replaced by a multiplication with a precomputed “magic” number, of which only
+// the upper half of the double-width product is kept, followed by a shift
+// (Granlund and Montgomery, “Division by Invariant Integers using Multiplication”, 1994).
+// The magic numbers and the algorithms are those of libdivide, extended to 8 and 16 bits.
+// If the magic number does not fit into n bits, it is stored without its leading one and the
+// missing addition of the dividend is performed separately.
+
+namespace grex {
+namespace detail {
+// (hi · 2^n) / d and the remainder for n-bit integers with hi < d, so that the quotient fits
+template<UnsignedIntVectorizable T>
+inline std::pair<T, T> divide_wide(T hi, T d) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  if constexpr (sizeof(T) < 8) {
+    using Wide = UnsignedInt<2 * sizeof(T)>;
+    const auto num = Wide(Wide{hi} << bits);
+    return {T(num / d), T(num % d)};
+  } else {
+#ifdef __SIZEOF_INT128__
+    const backend::u128 num = backend::u128{hi} << bits;
+    return {T(num / d), T(num % d)};
+#else
+    // restoring division, one bit at a time
+    T q = 0;
+    T r = hi;
+    for (std::size_t i = 0; i < bits; ++i) {
+      const bool carry = (r >> (bits - 1)) != 0;
+      r <<= 1;
+      q <<= 1;
+      if (carry || r >= d) {
+        r -= d;
+        q |= 1;
+      }
+    }
+    return {q, r};
+#endif
+  }
+}
+
+// wrapping arithmetic on vectors, matching the scalar versions in base.hpp
+#if !GREX_BACKEND_SCALAR
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> wrapping_add(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return a + b;
+}
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> wrapping_subtract(Vector<T, tSize> a,
+                                                             Vector<T, tSize> b) {
+  return a - b;
+}
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> wrapping_multiply(Vector<T, tSize> a,
+                                                             Vector<T, tSize> b) {
+  return a * b;
+}
+#endif
+
+template<typename TVal, typename T>
+struct IsDivisionOperand : public std::is_same<TVal, T> {};
+#if !GREX_BACKEND_SCALAR
+template<typename T, std::size_t tSize>
+struct IsDivisionOperand<Vector<T, tSize>, T> : public std::true_type {};
+#endif
+} // namespace detail
+
+/** A scalar or vector with values of type `T`, which can be divided by a `Divider<T>`. */
+template<typename TVal, typename T>
+concept DivisionOperand = detail::IsDivisionOperand<TVal, T>::value;
+
+/**
+  A divisor fixed at runtime, which is prepared for fast repeated division of scalars and vectors.
+
+  Like the built-in operators, the quotient is rounded towards zero and the remainder has the sign
+  of the dividend. The divisor must not be zero. For signed integers, dividing the minimum by -1
+  wraps around, i.e. the quotient is the minimum and the remainder is zero.
+*/
+template<IntVectorizable T>
+struct Divider {
+  using Value = T;
+
+  explicit Divider(T divisor) : divisor_{divisor} {
+    using Unsigned = UnsignedInt<sizeof(T)>;
+    if constexpr (is_signed<T>) {
+      negative_ = divisor < 0;
+    }
+    const auto abs_divisor = negative_ ? Unsigned(0U - Unsigned(divisor)) : Unsigned(divisor);
+    const auto log2 = std::size_t(std::bit_width(abs_divisor) - 1);
+
+    if (std::has_single_bit(abs_divisor)) {
+      // a power of two only requires a shift
+      shift_ = log2;
+      return;
+    }
+
+    // the quotient fits into n bits since the numerator is smaller than the divisor
+    const std::size_t log2_num = is_signed<T> ? log2 - 1 : log2;
+    auto [magic, rem] = detail::divide_wide(Unsigned(Unsigned{1} << log2_num), abs_divisor);
+    if (Unsigned(abs_divisor - rem) < Unsigned(Unsigned{1} << log2)) {
+      // this power suffices
+      shift_ = log2_num;
+    } else {
+      // one more bit is needed, which does not fit: the dividend is added separately
+      magic = Unsigned(magic + magic);
+      const auto twice_rem = Unsigned(rem + rem);
+      if (twice_rem >= abs_divisor || twice_rem < rem) {
+        ++magic;
+      }
+      shift_ = log2;
+      add_ = true;
+    }
+    magic_ = T(Unsigned(magic + 1U));
+    if (negative_) {
+      magic_ = detail::wrapping_subtract(T{0}, magic_);
+    }
+  }
+
+  /** The divisor. */
+  [[nodiscard]] T divisor() const {
+    return divisor_;
+  }
+
+  /** The quotient `x / divisor()`, rounded towards zero. */
+  template<DivisionOperand<T> TVal>
+  GREX_ALWAYS_INLINE TVal divide(TVal x) const {
+    static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+
+    if (magic_ == 0) {
+      if constexpr (is_signed<T>) {
+        // round towards zero by adding 2^shift - 1 to negative dividends
+        const T mask = T((UnsignedInt<sizeof(T)>{1} << shift_) - 1U);
+        const TVal q = shift_right(TVal(x + (shift_right(x, bits - 1) & TVal{mask})), shift_);
+        return negative_ ? detail::wrapping_subtract(TVal{T{0}}, q) : q;
+      } else {
+        return shift_right(x, shift_);
+      }
+    }
+
+    TVal q = multiply_high(x, TVal{magic_});
+    if constexpr (is_signed<T>) {
+      if (add_) {
+        q = negative_ ? detail::wrapping_subtract(q, x) : detail::wrapping_add(q, x);
+      }
+      q = shift_right(q, shift_);
+      // round towards zero by adding one to negative quotients
+      return TVal(q - shift_right(q, bits - 1));
+    } else {
+      if (add_) {
+        return shift_right(TVal(shift_right(TVal(x - q), 1) + q), shift_);
+      }
+      return shift_right(q, shift_);
+    }
+  }
+
+  /** The remainder `x % divisor()`, which has the sign of `x`. */
+  template<DivisionOperand<T> TVal>
+  GREX_ALWAYS_INLINE TVal modulo(TVal x) const {
+    return divmod(x).second;
+  }
+
+  /** The quotient and the remainder, i.e. `divide(x)` and `modulo(x)`. */
+  template<DivisionOperand<T> TVal>
+  GREX_ALWAYS_INLINE std::pair<TVal, TVal> divmod(TVal x) const {
+    const TVal q = divide(x);
+    return {q, detail::wrapping_subtract(x, detail::wrapping_multiply(q, TVal{divisor_}))};
+  }
+
+private:
+  T divisor_;
+  T magic_{0};
+  std::size_t shift_{0};
+  bool add_{false};
+  bool negative_{false};
+};
+
+#define GREX_DIVIDER_FUNCTION(NAME) \
+  template<IntVectorizable T, DivisionOperand<T> TVal> \
+  GREX_ALWAYS_INLINE inline auto NAME(TVal x, const Divider<T>& divider) { \
+    return divider.NAME(x); \
+  } \
+  template<IntVectorizable T> \
+  GREX_ALWAYS_INLINE inline auto NAME(T x, const Divider<T>& divider, \
+                                      OptValuedScalarTag<T> auto /*tag*/) { \
+    return divider.NAME(x); \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_DIVIDER_FUNCTION_ALL(NAME) GREX_DIVIDER_FUNCTION(NAME)
+#else
+#define GREX_DIVIDER_FUNCTION_ALL(NAME) \
+  GREX_DIVIDER_FUNCTION(NAME) \
+  /* lane-wise, i.e. the tag only matters for the inactive lanes, which are unspecified */ \
+  template<IntVector TVec> \
+  GREX_ALWAYS_INLINE inline auto NAME(TVec x, const Divider<typename TVec::Value>& divider, \
+                                      OptTypedVectorTag<TVec> auto /*tag*/) { \
+    return divider.NAME(x); \
+  }
+#endif
+
+/** The quotient `x / divider.divisor()`, rounded towards zero (lane-wise for vectors). */
+GREX_DIVIDER_FUNCTION_ALL(divide)
+/** The remainder `x % divider.divisor()`, which has the sign of `x` (lane-wise for vectors). */
+GREX_DIVIDER_FUNCTION_ALL(modulo)
+/** The quotient and the remainder of `x` divided by `divider.divisor()`. */
+GREX_DIVIDER_FUNCTION_ALL(divmod)
+
+#undef GREX_DIVIDER_FUNCTION_ALL
+#undef GREX_DIVIDER_FUNCTION
+} // namespace grex
+
+#endif // INCLUDE_GREX_DIVIDER_HPP
@@ -4,10 +4,16 @@
 // IWYU pragma: begin_exports
 #include "backend.hpp"
 #include "base.hpp"
+#include "bitpacked.hpp"
+#include "byte-classifier.hpp"
+#include "divider.hpp"
 #include "format.hpp"
 #include "lookup-table.hpp"
+#include "math.hpp"
 #include "operations-tagged.hpp"
 #include "operations.hpp"
+#include "reduce.hpp"
+#include "scan.hpp"
 #include "tags.hpp"
 #include "types.hpp"
 // IWYU pragma: end_exports
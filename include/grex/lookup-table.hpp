@@ -17,6 +17,7 @@
 #if !GREX_BACKEND_SCALAR
 #include <span>
 
+#include "grex/backend/active/sizes.hpp"
 #include "grex/operations-tagged.hpp"
 #include "grex/types.hpp"
 #endif
@@ -48,8 +49,10 @@ private:
 };
 
 #if !GREX_BACKEND_SCALAR
+// Tables for which dynamic shuffles are faster than gathers are kept in (possibly several)
+// registers, whose lookups are combined using blends or two-register permutes
 template<Vectorizable T, std::size_t tSize>
-requires(sizeof(T) * tSize <= 64)
+requires(sizeof(T) * tSize <= backend::max_shuffle_table_bytes<T>)
 struct LookupTable<T, tSize> {
   using VectorData = grex::Vector<T, tSize>;
 
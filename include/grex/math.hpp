@@ -0,0 +1,952 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_MATH_HPP
+#define INCLUDE_GREX_MATH_HPP
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+#include "grex/operations.hpp"
+#include "grex/tags.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/types.hpp"
+#endif
+
+// Vectorized exponentials, logarithms and trigonometric functions for f32/f64.
+//
+// All functions are written once in terms of operations that are available both for scalars and
+// for vectors, i.e. the scalar versions use the same algorithms as the vector versions.
+// The arguments are reduced to a small interval around zero (Cody–Waite for e^x and the
+// trigonometric functions, exponent extraction for the logarithms) and the remaining function is
+// approximated by a Chebyshev fit evaluated using Horner's scheme with fused multiply-adds.
+// The error bounds are given in ULP with respect to the exact result and hold for
+// backends with hardware FMA; the emulated FMA used otherwise adds at most one ULP.
+// Special values follow the C standard library except for the sign of zero results.
+
+namespace grex {
+/** The accuracy of the trigonometric functions. */
+enum struct MathAccuracy : u8 {
+  /**
+    At most 1 ULP on the whole domain, except for tan on f64 with at most 1.5 ULP.
+
+    The arguments of f32 functions are reduced and evaluated in f64 and arguments of sin/cos/tan
+    beyond 2^20 are passed to the C standard library.
+  */
+  precise,
+  /**
+    At most 4 ULP, where sin/cos/tan are restricted to |x| <= 4096 for f32 and |x| <= 2^20 for
+    f64, with unspecified results for larger finite arguments.
+  */
+  fast,
+};
+
+namespace detail {
+template<FloatVectorizable T>
+struct MathTraits;
+template<>
+struct MathTraits<f32> {
+  static constexpr std::size_t mantissa_bits = 23;
+  static constexpr u32 exponent_bias = 127;
+  // adding 1.5·2^23 rounds to an integer and puts it into the low mantissa bits
+  static constexpr f32 shifter = 0x1.8p23F;
+  // ln(2) split such that k·ln2_hi is exact for all relevant exponents k
+  static constexpr f32 ln2_hi = 0x1.62e4p-1F;
+  static constexpr f32 ln2_lo = 0x1.7f7d1cp-20F;
+  static constexpr f32 log2e = 0x1.715476p0F;
+  static constexpr f32 log2e_lo = 0x1.4ae0cp-26F;
+  // the arguments beyond which the results are rounded to 0, -1 or ∞
+  static constexpr f32 exp_min = -104.F;
+  static constexpr f32 exp_max = 89.F;
+  static constexpr f32 exp2_min = -151.F;
+  static constexpr f32 exp2_max = 129.F;
+  static constexpr f32 expm1_min = -80.F;
+  static constexpr u32 sqrt_half_bits = 0x3F3504F3U;
+
+  // (e^r - 1 - r) / r² on [-ln(2)/2, ln(2)/2]
+  static constexpr std::array exp_poly{0x1p-1F,        0x1.555556p-3F,  0x1.5554eap-5F,
+                                       0x1.1110ep-7F,  0x1.6d4316p-10F, 0x1.a124e4p-13F};
+  // (2^r - 1) / r on [-1/2, 1/2]
+  static constexpr std::array exp2_poly{0x1.62e43p-1F,  0x1.ebfbep-3F,   0x1.c6af6cp-5F,
+                                        0x1.3b2a54p-7F, 0x1.5f089p-10F, 0x1.44138ap-13F};
+  // (2·atanh(s) - 2s) / s³ as a function of z = s² on [0, (3 - 2√2)²]
+  static constexpr std::array log_poly{0x1.555556p-1F, 0x1.9999ecp-2F, 0x1.245c44p-2F,
+                                       0x1.ddced8p-3F};
+};
+template<>
+struct MathTraits<f64> {
+  static constexpr std::size_t mantissa_bits = 52;
+  static constexpr u64 exponent_bias = 1023;
+  static constexpr f64 shifter = 0x1.8p52;
+  static constexpr f64 ln2_hi = 0x1.62e42feep-1;
+  static constexpr f64 ln2_lo = 0x1.a39ef35793c76p-33;
+  static constexpr f64 log2e = 0x1.71547652b82fep0;
+  static constexpr f64 log2e_lo = 0x1.777d0ffda0d24p-56;
+  static constexpr f64 exp_min = -746.;
+  static constexpr f64 exp_max = 710.;
+  static constexpr f64 exp2_min = -1076.;
+  static constexpr f64 exp2_max = 1025.;
+  static constexpr f64 expm1_min = -700.;
+  static constexpr u64 sqrt_half_bits = 0x3FE6A09E667F3BCDU;
+
+  static constexpr std::array exp_poly{
+    0x1p-1,
+    0x1.5555555555557p-3,
+    0x1.5555555555556p-5,
+    0x1.11111111100dfp-7,
+    0x1.6c16c16c162d6p-10,
+    0x1.a01a01abe62ddp-13,
+    0x1.a01a01a6d7808p-16,
+    0x1.71de02375656cp-19,
+    0x1.27e4db67b4303p-22,
+    0x1.af4ddd84882fep-26,
+    0x1.1f72fc730b4ffp-29,
+  };
+  static constexpr std::array exp2_poly{
+    0x1.62e42fefa39efp-1,  0x1.ebfbdff82c598p-3,  0x1.c6b08d704a0c2p-5,  0x1.3b2ab6fba1ddap-7,
+    0x1.5d87fe78a5276p-10, 0x1.430913096fd9fp-13, 0x1.ffcbfc670dcd4p-17, 0x1.62bfd47773353p-20,
+    0x1.b524fae627834p-24, 0x1.e6063f7217bc6p-28, 0x1.e9d3fe3952179p-32,
+  };
+  static constexpr std::array log_poly{
+    0x1.5555555555558p-1, 0x1.99999999952e2p-2, 0x1.2492492df148dp-2, 0x1.c71c62e5800a1p-3,
+    0x1.7462b4ab2ef6bp-3, 0x1.39fe606542ddep-3, 0x1.2b584aae78a57p-3,
+  };
+};
+
+// The scalar type and the unsigned integer type with the same layout
+template<typename TVal>
+struct MathValueTrait {
+  using Value = TVal;
+  using Bits = FloatSize<TVal>;
+};
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, std::size_t tSize>
+struct MathValueTrait<Vector<T, tSize>> {
+  using Value = T;
+  using Bits = Vector<FloatSize<T>, tSize>;
+};
+#endif
+template<typename TVal>
+using MathValue = MathValueTrait<TVal>::Value;
+template<typename TVal>
+using MathBits = MathValueTrait<TVal>::Bits;
+
+template<FloatVectorizable T>
+GREX_ALWAYS_INLINE inline FloatSize<T> to_bits(T x) {
+  return std::bit_cast<FloatSize<T>>(x);
+}
+template<FloatVectorizable T>
+GREX_ALWAYS_INLINE inline T from_bits(FloatSize<T> x, TypeTag<T> /*tag*/) {
+  return std::bit_cast<T>(x);
+}
+template<std::size_t tOffset, UnsignedIntVectorizable T>
+GREX_ALWAYS_INLINE inline T shift_left(T x) {
+  return T(x << tOffset);
+}
+template<std::size_t tOffset, UnsignedIntVectorizable T>
+GREX_ALWAYS_INLINE inline T shift_right(T x) {
+  return T(x >> tOffset);
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<FloatSize<T>, tSize> to_bits(Vector<T, tSize> x) {
+  return Vector<FloatSize<T>, tSize>{backend::as<FloatSize<T>>(x.backend())};
+}
+template<FloatVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> from_bits(Vector<FloatSize<T>, tSize> x,
+                                                     TypeTag<Vector<T, tSize>> /*tag*/) {
+  return Vector<T, tSize>{backend::as<T>(x.backend())};
+}
+template<std::size_t tOffset, UnsignedIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> shift_left(Vector<T, tSize> x) {
+  return x << index_tag<tOffset>;
+}
+template<std::size_t tOffset, UnsignedIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> shift_right(Vector<T, tSize> x) {
+  return x >> index_tag<tOffset>;
+}
+#endif
+
+// Horner's scheme with the coefficients in ascending order
+template<typename TVal, typename T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline TVal polynomial(TVal x, const std::array<T, tSize>& coeffs) {
+  TVal acc{coeffs[tSize - 1]};
+  for (std::size_t i = tSize - 1; i > 0; --i) {
+    acc = fmadd(acc, x, TVal{coeffs[i - 1]});
+  }
+  return acc;
+}
+
+// 2^k for an integer k stored as `shifter + k`, which has to be a normal exponent
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal pow2(MathBits<TVal> shifted) {
+  using Traits = MathTraits<MathValue<TVal>>;
+  using Bits = FloatSize<MathValue<TVal>>;
+  // the bits of the shifter vanish in the shift
+  return from_bits(shift_left<Traits::mantissa_bits>(shifted + Bits{Traits::exponent_bias}),
+                   type_tag<TVal>);
+}
+
+// Cody–Waite reduction x = k·ln(2) + r with |r| <= ln(2)/2
+template<typename TVal>
+struct ExpReduction {
+  // shifter + k
+  TVal t;
+  TVal k;
+  TVal r;
+};
+template<typename TVal>
+GREX_ALWAYS_INLINE inline ExpReduction<TVal> exp_reduce(TVal x) {
+  using Traits = MathTraits<MathValue<TVal>>;
+  const TVal t = fmadd(x, TVal{Traits::log2e}, TVal{Traits::shifter});
+  const TVal k = t - TVal{Traits::shifter};
+  const TVal r = fnmadd(k, TVal{Traits::ln2_lo}, fnmadd(k, TVal{Traits::ln2_hi}, x));
+  return {.t = t, .k = k, .r = r};
+}
+
+// p·2^k, where k may exceed the normal exponent range: Multiplying with 2^(k - k/2) and 2^(k/2)
+// rounds only once and produces subnormal results and overflows to infinity correctly
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal exp_scale(TVal p, TVal t, TVal k) {
+  using Traits = MathTraits<MathValue<TVal>>;
+  const TVal t1 = fmadd(k, TVal{MathValue<TVal>{0.5}}, TVal{Traits::shifter});
+  const auto b1 = to_bits(t1);
+  const auto b2 = to_bits(t) - b1 + to_bits(Traits::shifter);
+  return p * pow2<TVal>(b1) * pow2<TVal>(b2);
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal exp(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = MathTraits<T>;
+  const TVal xc = min(max(x, TVal{Traits::exp_min}), TVal{Traits::exp_max});
+  const auto [t, k, r] = exp_reduce(xc);
+  // e^r = 1 + r + r²·P(r)
+  const TVal p = fmadd(r * r, polynomial(r, Traits::exp_poly), r) + T{1};
+  return blend(x != x, exp_scale(p, t, k), x);
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal exp2(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = MathTraits<T>;
+  const TVal xc = min(max(x, TVal{Traits::exp2_min}), TVal{Traits::exp2_max});
+  // x = k + r with |r| <= 1/2, which is exact
+  const TVal t = xc + Traits::shifter;
+  const TVal k = t - Traits::shifter;
+  const TVal r = xc - k;
+  // 2^r = 1 + r·P(r)
+  const TVal p = fmadd(r, polynomial(r, Traits::exp2_poly), TVal{T{1}});
+  return blend(x != x, exp_scale(p, t, k), x);
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal expm1(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = MathTraits<T>;
+  using Bits = FloatSize<T>;
+  const TVal xc = min(max(x, TVal{Traits::expm1_min}), TVal{Traits::exp_max});
+  const auto [t, k, r] = exp_reduce(xc);
+  // e^r - 1 = r + r²·P(r), which is accurate for small |x| since there is no cancellation
+  const TVal em = fmadd(r * r, polynomial(r, Traits::exp_poly), r);
+  // 2^k·(e^r - 1) + (2^k - 1) = 2·(s·(e^r - 1) + (s - 1/2)) with s = 2^(k - 1),
+  // whose factors are normal for all k and whose final doubling overflows correctly
+  const TVal s = pow2<TVal>(to_bits(t) - Bits{1});
+  const TVal scaled = fmadd(s, em, s - T{0.5}) * T{2};
+  return blend(x != x, blend(k == T{0}, scaled, em), x);
+}
+
+// x = 2^k·(1 + f) with √2/2 <= 1 + f < √2 and log(1 + f) = f - f²/2 + s·(f²/2 + R),
+// where s = f / (2 + f) and R = s²·P(s²)
+template<typename TVal>
+struct LogReduction {
+  TVal k;
+  TVal f;
+  TVal hfsq;
+  TVal tail;
+};
+template<bool tSubnormal, typename TVal>
+GREX_ALWAYS_INLINE inline LogReduction<TVal> log_reduce(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = MathTraits<T>;
+  using Bits = FloatSize<T>;
+  constexpr T scale = T(Bits{1} << Traits::mantissa_bits);
+  constexpr Bits mantissa_mask = (Bits{1} << Traits::mantissa_bits) - 1;
+
+  TVal xn = x;
+  TVal kn{};
+  if constexpr (tSubnormal) {
+    // normalize subnormal inputs
+    const auto sub = x < std::numeric_limits<T>::min();
+    xn = blend(sub, x, x * scale);
+    kn = blend(sub, TVal{}, TVal{T(Traits::mantissa_bits)});
+  }
+  // offset the exponent such that the mantissa is in [√2/2, √2)
+  const auto ix = to_bits(xn) + Bits{to_bits(T{1}) - Traits::sqrt_half_bits};
+  // the biased exponent becomes the mantissa of 2^mantissa_bits, which avoids a conversion
+  const TVal kb = from_bits(shift_right<Traits::mantissa_bits>(ix) | to_bits(scale),
+                            type_tag<TVal>);
+  const TVal k = kb - (scale + T(Traits::exponent_bias)) - kn;
+  const TVal f =
+    from_bits((ix & mantissa_mask) + Bits{Traits::sqrt_half_bits}, type_tag<TVal>) - T{1};
+
+  const TVal s = f / (f + T{2});
+  const TVal z = s * s;
+  const TVal hfsq = f * f * T{0.5};
+  const TVal tail = s * fmadd(z, polynomial(z, Traits::log_poly), hfsq);
+  return {.k = k, .f = f, .hfsq = hfsq, .tail = tail};
+}
+
+// log(±0) = -∞, log(x < 0) = NaN, log(∞) = ∞, log(NaN) = NaN
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal log_special(TVal x, TVal y) {
+  using T = MathValue<TVal>;
+  using Limits = std::numeric_limits<T>;
+  y = blend(x == Limits::infinity(), y, x);
+  y = blend(x == T{0}, y, TVal{-Limits::infinity()});
+  return blend(x < T{0} || x != x, y, TVal{Limits::quiet_NaN()});
+}
+
+// k·ln(2) + log(1 + f) + c, where k·ln2_hi is exact and the small terms are summed first
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal log_combine(LogReduction<TVal> red, TVal c) {
+  using Traits = MathTraits<MathValue<TVal>>;
+  const TVal lo = red.tail + fmadd(red.k, TVal{Traits::ln2_lo}, c);
+  return fmadd(red.k, TVal{Traits::ln2_hi}, red.f - (red.hfsq - lo));
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal log(TVal x) {
+  const auto red = log_reduce<true>(x);
+  return log_special(x, log_combine(red, TVal{}));
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal log2(TVal x) {
+  using Traits = MathTraits<MathValue<TVal>>;
+  const auto red = log_reduce<true>(x);
+  // log2(e)·f with a split constant, since the rounding error of log2(e) would be visible
+  const TVal log2e{Traits::log2e};
+  const TVal lo = fmadd(red.f, TVal{Traits::log2e_lo}, (red.tail - red.hfsq) * log2e);
+  return log_special(x, red.k + fmadd(red.f, log2e, lo));
+}
+
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal log1p(TVal x) {
+  using T = MathValue<TVal>;
+  // u = 1 + x is never subnormal, and log(1 + x) = log(u) + c/u with the rounding error c
+  const TVal u = x + T{1};
+  const TVal c = (x - (u - T{1})) / u;
+  return log_special(u, log_combine(log_reduce<false>(u), c));
+}
+
+// The constants of the trigonometric functions, which are evaluated in `Compute`
+template<FloatVectorizable T, MathAccuracy tAccuracy>
+struct TrigTraits;
+template<>
+struct TrigTraits<f32, MathAccuracy::precise> {
+  using Compute = f64;
+  static constexpr bool split = false;
+  // the largest argument for which the Cody–Waite reduction is exact
+  static constexpr f32 reduce_max = 0x1p20F;
+  // whether the C standard library is used for larger arguments
+  static constexpr bool fallback = true;
+  // π/2 in 33-bit parts, i.e. q·pio2[i] is exact for |q| < 2^20, and the rounded rest
+  static constexpr std::array pio2{0x1.921fb544p0, 0x1.0b4611a6p-34, 0x1.3198a2ep-69,
+                                   0x1.b839a252049c1p-104};
+  // (sin(r) - r) / r³ and (cos(r) - 1 + r²/2) / r⁴ as functions of z = r² on [0, (π/4)²]
+  static constexpr std::array sin_poly{-0x1.555555545e0acp-3, 0x1.11110def2e1c9p-7,
+                                       -0x1.a013a793b98cep-13, 0x1.6dbe0838a06e9p-19};
+  static constexpr std::array cos_poly{0x1.5555544178832p-5, -0x1.6c12d2ef379dcp-10,
+                                       0x1.9bd89bc2b0a75p-16};
+  // (atan(t) - t) / t³ as a function of z = t² on [0, tan(π/8)²]
+  static constexpr std::array atan_poly{-0x1.5555554c0aef3p-2, 0x1.99997b13bead1p-3,
+                                        -0x1.248a173238684p-3, 0x1.c57bad2e925fp-4,
+                                        -0x1.614448bd30a84p-4, 0x1.9d8b2344d1c3cp-5};
+};
+template<>
+struct TrigTraits<f32, MathAccuracy::fast> {
+  using Compute = f32;
+  static constexpr bool split = false;
+  static constexpr f32 reduce_max = 0x1p12F;
+  static constexpr bool fallback = false;
+  // 12-bit parts, i.e. q·pio2[i] is exact for |q| < 2^12
+  static constexpr std::array pio2{0x1.92p0F, 0x1.fb4p-12F, 0x1.444p-24F, 0x1.68c234p-39F};
+  static constexpr std::array sin_poly{-0x1.555552p-3F, 0x1.110c28p-7F, -0x1.9ac9bp-13F};
+  static constexpr std::array cos_poly{0x1.555554p-5F, -0x1.6c12d2p-10F, 0x1.9bd89cp-16F};
+  static constexpr std::array atan_poly{-0x1.555554p-2F, 0x1.99973p-3F, -0x1.242036p-3F,
+                                        0x1.b8103p-4F, -0x1.08455ep-4F};
+};
+template<>
+struct TrigTraits<f64, MathAccuracy::precise> {
+  using Compute = f64;
+  // keep the rounding error of the reduced argument as a separate term
+  static constexpr bool split = true;
+  static constexpr f64 reduce_max = 0x1p20;
+  static constexpr bool fallback = true;
+  static constexpr std::array pio2 = TrigTraits<f32, MathAccuracy::precise>::pio2;
+  static constexpr std::array sin_poly{
+    -0x1.5555555555555p-3,  0x1.1111111110bb2p-7, -0x1.a01a019e83aaep-13,
+    0x1.71de37968a1p-19,    -0x1.ae600b02b6262p-26, 0x1.5e0b19f8b1451p-33,
+  };
+  static constexpr std::array cos_poly{
+    0x1.5555555555555p-5,   -0x1.6c16c16c16967p-10, 0x1.a01a019f4eb01p-16,
+    -0x1.27e4fa17da09ep-22, 0x1.1eeb68e93b64cp-29,  -0x1.907da367a37cbp-37,
+  };
+  static constexpr std::array atan_poly{
+    -0x1.5555555555555p-2, 0x1.999999999934cp-3,  -0x1.2492492436201p-3, 0x1.c71c71853d7fap-4,
+    -0x1.745d0b28a7e37p-4, 0x1.3b1263064f6b9p-4,  -0x1.10fa77b1a6d57p-4, 0x1.dfe6497e96323p-5,
+    -0x1.a0999c632b6edp-5, 0x1.4162c02b1dda3p-5,  -0x1.3a31b1c0fd3b7p-6,
+  };
+};
+template<>
+struct TrigTraits<f64, MathAccuracy::fast> {
+  using Compute = f64;
+  static constexpr bool split = false;
+  static constexpr f64 reduce_max = 0x1p20;
+  static constexpr bool fallback = false;
+  static constexpr std::array pio2{0x1.921fb544p0, 0x1.0b4611a6p-34, 0x1.3198a2e037073p-69};
+  static constexpr std::array sin_poly = TrigTraits<f64, MathAccuracy::precise>::sin_poly;
+  static constexpr std::array cos_poly = TrigTraits<f64, MathAccuracy::precise>::cos_poly;
+  static constexpr std::array atan_poly{
+    -0x1.5555555555546p-2, 0x1.9999999990a9fp-3, -0x1.2492491dd4b29p-3, 0x1.c71c6dd1ca28cp-4,
+    -0x1.745c7f8421f5cp-4, 0x1.3b068efc532d3p-4, -0x1.105e40d85ead1p-4, 0x1.d5eb9ad0804dp-5,
+    -0x1.6f4657797fec4p-5, 0x1.74bea059cee82p-6,
+  };
+};
+
+// Multiples of π split into a rounded value and the rounded rest
+template<FloatVectorizable T>
+struct PiTraits;
+template<>
+struct PiTraits<f32> {
+  static constexpr f32 two_over_pi = 0x1.45f306p-1F;
+  static constexpr f32 tan_pi_8 = 0x1.a8279ap-2F;
+  static constexpr f32 tan_3pi_8 = 0x1.3504f4p1F;
+  static constexpr f32 pi_4 = 0x1.921fb6p-1F;
+  static constexpr f32 pi_4_lo = -0x1.777a5cp-26F;
+  static constexpr f32 pi_2 = 0x1.921fb6p0F;
+  static constexpr f32 pi_2_lo = -0x1.777a5cp-25F;
+  static constexpr f32 pi_3_4 = 0x1.2d97c8p1F;
+  static constexpr f32 pi_3_4_lo = -0x1.99bc5cp-28F;
+  static constexpr f32 pi = 0x1.921fb6p1F;
+  static constexpr f32 pi_lo = -0x1.777a5cp-24F;
+};
+template<>
+struct PiTraits<f64> {
+  static constexpr f64 two_over_pi = 0x1.45f306dc9c883p-1;
+  static constexpr f64 tan_pi_8 = 0x1.a827999fcef32p-2;
+  static constexpr f64 tan_3pi_8 = 0x1.3504f333f9de6p1;
+  static constexpr f64 pi_4 = 0x1.921fb54442d18p-1;
+  static constexpr f64 pi_4_lo = 0x1.1a62633145c07p-55;
+  static constexpr f64 pi_2 = 0x1.921fb54442d18p0;
+  static constexpr f64 pi_2_lo = 0x1.1a62633145c07p-54;
+  static constexpr f64 pi_3_4 = 0x1.2d97c7f3321d2p1;
+  static constexpr f64 pi_3_4_lo = 0x1.a79394c9e8a0ap-54;
+  static constexpr f64 pi = 0x1.921fb54442d18p1;
+  static constexpr f64 pi_lo = 0x1.1a62633145c07p-53;
+};
+
+// TVal with the value type replaced by TDst
+template<typename TVal, typename TDst>
+struct MathRebindTrait {
+  using Type = TDst;
+};
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, std::size_t tSize, typename TDst>
+struct MathRebindTrait<Vector<T, tSize>, TDst> {
+  using Type = Vector<TDst, tSize>;
+};
+#endif
+template<typename TVal, typename TDst>
+using MathRebind = MathRebindTrait<TVal, TDst>::Type;
+
+GREX_ALWAYS_INLINE inline bool any_lane(bool mask) {
+  return mask;
+}
+#if !GREX_BACKEND_SCALAR
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline bool any_lane(Mask<T, tSize> mask) {
+  return horizontal_or(mask);
+}
+#endif
+
+// Replaces the lanes selected by `mask` with `fun` applied to the lanes of `x`
+template<FloatVectorizable T>
+inline T replace_lanes(bool mask, T x, T y, auto fun) {
+  return mask ? fun(x) : y;
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, std::size_t tSize>
+inline Vector<T, tSize> replace_lanes(Mask<T, tSize> mask, Vector<T, tSize> x,
+                                      Vector<T, tSize> y, auto fun) {
+  if (!horizontal_or(mask)) [[likely]] {
+    return y;
+  }
+  const std::array xs = x.as_array();
+  std::array ys = y.as_array();
+  for (std::size_t i = 0; i < tSize; ++i) {
+    if (mask[i]) {
+      ys[i] = fun(xs[i]);
+    }
+  }
+  return Vector<T, tSize>::load(ys.data());
+}
+#endif
+
+// The lanes of `a` where `mask` is all ones and the lanes of `b` where it is zero
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal select_bits(MathBits<TVal> mask, TVal a, TVal b) {
+  return from_bits((to_bits(a) & mask) | (to_bits(b) & ~mask), type_tag<TVal>);
+}
+// Flips the sign of `x` where bit `tBit` of `bits` is set
+template<std::size_t tBit, typename TVal>
+GREX_ALWAYS_INLINE inline TVal flip_sign(TVal x, MathBits<TVal> bits) {
+  using Bits = FloatSize<MathValue<TVal>>;
+  constexpr std::size_t sign_bit = 8 * sizeof(Bits) - 1;
+  return from_bits(to_bits(x) ^ shift_left<sign_bit - tBit>(bits & Bits{Bits{1} << tBit}),
+                   type_tag<TVal>);
+}
+
+// Flips the sign of `x` where `mask` is all ones
+template<typename TVal>
+GREX_ALWAYS_INLINE inline TVal flip_sign_bits(TVal x, MathBits<TVal> mask) {
+  return from_bits(to_bits(x) ^ (mask & to_bits(-MathValue<TVal>{0})), type_tag<TVal>);
+}
+
+// A value represented as an unevaluated sum hi + lo with |lo| much smaller than |hi|
+template<typename TVal>
+struct SplitValue {
+  TVal hi;
+  TVal lo;
+};
+// The rounded sum of a and b and its rounding error (TwoSum)
+template<typename TVal>
+GREX_ALWAYS_INLINE inline SplitValue<TVal> two_sum(TVal a, TVal b) {
+  const TVal s = a + b;
+  const TVal d = s - a;
+  return {.hi = s, .lo = (a - (s - d)) + (b - d)};
+}
+// (num.hi + num.lo) / (den.hi + den.lo), where the rounding error of the division is computed
+// using a fused multiply-add
+template<typename TVal>
+GREX_ALWAYS_INLINE inline SplitValue<TVal> divide_split(SplitValue<TVal> num,
+                                                        SplitValue<TVal> den) {
+  const TVal q = num.hi / den.hi;
+  return {.hi = q, .lo = (fnmadd(q, den.hi, num.hi) + fnmadd(q, den.lo, num.lo)) / den.hi};
+}
+
+// Cody–Waite reduction x = q·π/2 + r with |r| <= π/4, where r + r_lo is more accurate if split
+template<typename TVal>
+struct TrigReduction {
+  // shifter + q
+  MathBits<TVal> q;
+  TVal r;
+  TVal r_lo;
+};
+template<typename TTraits, typename TVal>
+GREX_ALWAYS_INLINE inline TrigReduction<TVal> trig_reduce(TVal x) {
+  using T = MathValue<TVal>;
+  constexpr auto& pio2 = TTraits::pio2;
+  constexpr std::size_t last = pio2.size() - 1;
+  const TVal t = fmadd(x, TVal{PiTraits<T>::two_over_pi}, TVal{MathTraits<T>::shifter});
+  const TVal q = t - MathTraits<T>::shifter;
+  // the products with the leading parts are exact, as is the first difference
+  TVal r = fnmadd(q, TVal{pio2[0]}, x);
+  if constexpr (TTraits::split) {
+    // accumulate the rounding errors of the differences
+    TVal r_lo{};
+    for (std::size_t i = 1; i < last; ++i) {
+      const auto [hi, lo] = two_sum(r, -q * pio2[i]);
+      r = hi;
+      r_lo += lo;
+    }
+    r_lo = fnmadd(q, TVal{pio2[last]}, r_lo);
+    const TVal rr = r + r_lo;
+    return {.q = to_bits(t), .r = rr, .r_lo = r_lo - (rr - r)};
+  } else {
+    for (std::size_t i = 1; i < last; ++i) {
+      r = fnmadd(q, TVal{pio2[i]}, r);
+    }
+    return {.q = to_bits(t), .r = fnmadd(q, TVal{pio2[last]}, r), .r_lo = TVal{}};
+  }
+}
+
+// sin(r + r_lo) and cos(r + r_lo) for |r| <= π/4, including their rounding errors if split
+template<typename TTraits, typename TVal>
+GREX_ALWAYS_INLINE inline std::pair<SplitValue<TVal>, SplitValue<TVal>>
+sincos_kernel(TrigReduction<TVal> red) {
+  using T = MathValue<TVal>;
+  const TVal r = red.r;
+  const TVal z = r * r;
+  const TVal sp = polynomial(z, TTraits::sin_poly);
+  const TVal cp = z * z * polynomial(z, TTraits::cos_poly);
+  // 1 - z/2 is rounded, whose error is added to the small terms
+  const TVal hz = z * T{0.5};
+  const TVal w = T{1} - hz;
+  const TVal cw = (T{1} - w) - hz;
+  if constexpr (TTraits::split) {
+    // sin(r + r_lo) ≈ sin(r) + r_lo·(1 - z/2) and cos(r + r_lo) ≈ cos(r) - r·r_lo
+    const TVal r_lo = red.r_lo;
+    const TVal st = fmadd(r * z, sp, fnmadd(r_lo * z, TVal{T{0.5}}, r_lo));
+    const TVal ct = cw + fnmadd(r, r_lo, cp);
+    const TVal s = r + st;
+    const TVal c = w + ct;
+    return {{.hi = s, .lo = (r - s) + st}, {.hi = c, .lo = (w - c) + ct}};
+  } else {
+    return {{.hi = fmadd(r * z, sp, r), .lo = TVal{}}, {.hi = w + (cw + cp), .lo = TVal{}}};
+  }
+}
+
+// sin(x) and cos(x) in the compute type, which requires |x| <= TTraits::reduce_max
+template<typename TTraits, typename TVal>
+GREX_ALWAYS_INLINE inline std::pair<TVal, TVal> sincos_reduced(TVal x) {
+  using Bits = FloatSize<MathValue<TVal>>;
+  const auto red = trig_reduce<TTraits>(x);
+  const auto [sv, cv] = sincos_kernel<TTraits>(red);
+  // swap sin and cos in odd quadrants and negate sin in quadrants 2/3 and cos in quadrants 1/2
+  const auto odd = Bits{} - (red.q & Bits{1});
+  return {flip_sign<1>(select_bits(odd, cv.hi, sv.hi), red.q),
+          flip_sign<1>(select_bits(odd, sv.hi, cv.hi), red.q + Bits{1})};
+}
+
+// tan(x) in the compute type, which requires |x| <= TTraits::reduce_max
+template<typename TTraits, typename TVal>
+GREX_ALWAYS_INLINE inline TVal tan_reduced(TVal x) {
+  using Bits = FloatSize<MathValue<TVal>>;
+  const auto red = trig_reduce<TTraits>(x);
+  const auto [sv, cv] = sincos_kernel<TTraits>(red);
+  // tan(x) = -cos(r)/sin(r) in odd quadrants
+  const auto odd = Bits{} - (red.q & Bits{1});
+  TVal t{};
+  if constexpr (TTraits::split) {
+    const SplitValue<TVal> num{.hi = select_bits(odd, cv.hi, sv.hi),
+                               .lo = select_bits(odd, cv.lo, sv.lo)};
+    const SplitValue<TVal> den{.hi = select_bits(odd, sv.hi, cv.hi),
+                               .lo = select_bits(odd, sv.lo, cv.lo)};
+    const auto [hi, lo] = divide_split(num, den);
+    t = hi + lo;
+  } else {
+    t = select_bits(odd, cv.hi, sv.hi) / select_bits(odd, sv.hi, cv.hi);
+  }
+  return flip_sign<0>(t, red.q);
+}
+
+// Evaluates `fun` in the compute type and applies `fallback` to arguments that are too large
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal trig_apply(TVal x, auto fun, auto fallback) {
+  using T = MathValue<TVal>;
+  using Traits = TrigTraits<T, tAccuracy>;
+  using Compute = Traits::Compute;
+  const TVal y = convert<T>(fun.template operator()<Traits>(convert<Compute>(x)));
+  if constexpr (Traits::fallback) {
+    return replace_lanes(abs(x) > Traits::reduce_max, x, y, fallback);
+  } else {
+    return y;
+  }
+}
+
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal sin(TVal x) {
+  return trig_apply<tAccuracy>(
+    x, []<typename TTraits>(auto xc) { return sincos_reduced<TTraits>(xc).first; },
+    [](auto xs) { return std::sin(xs); });
+}
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal cos(TVal x) {
+  return trig_apply<tAccuracy>(
+    x, []<typename TTraits>(auto xc) { return sincos_reduced<TTraits>(xc).second; },
+    [](auto xs) { return std::cos(xs); });
+}
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline std::pair<TVal, TVal> sincos(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = TrigTraits<T, tAccuracy>;
+  using Compute = Traits::Compute;
+  const auto [s, c] = sincos_reduced<Traits>(convert<Compute>(x));
+  const TVal ys = convert<T>(s);
+  const TVal yc = convert<T>(c);
+  if constexpr (Traits::fallback) {
+    const auto huge = abs(x) > Traits::reduce_max;
+    if (!any_lane(huge)) [[likely]] {
+      return {ys, yc};
+    }
+    return {replace_lanes(huge, x, ys, [](auto xs) { return std::sin(xs); }),
+            replace_lanes(huge, x, yc, [](auto xs) { return std::cos(xs); })};
+  } else {
+    return {ys, yc};
+  }
+}
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal tan(TVal x) {
+  return trig_apply<tAccuracy>(
+    x, []<typename TTraits>(auto xc) { return tan_reduced<TTraits>(xc); },
+    [](auto xs) { return std::tan(xs); });
+}
+
+// atan(a / b) for a, b >= 0, or π - atan(a / b) in the lanes where `neg` is all ones,
+// using atan(a / b) = π/4 + atan((a - b) / (a + b)) and atan(a / b) = π/2 + atan(-b / a)
+// such that the argument of the polynomial is at most tan(π/8) and computed by one division
+template<typename TTraits, typename TVal>
+GREX_ALWAYS_INLINE inline TVal atan_kernel(TVal a, TVal b, MathBits<TVal> neg) {
+  using T = MathValue<TVal>;
+  using Pi = PiTraits<T>;
+  const auto mid = a > b * Pi::tan_pi_8;
+  const auto big = a > b * Pi::tan_3pi_8;
+  const TVal num = blend(big, blend(mid, a, a - b), -b);
+  const TVal den = blend(big, blend(mid, b, a + b), a);
+  // negating t yields π - atan(a / b) in combination with the corresponding multiple of π/4
+  TVal t = num / den;
+  TVal t_lo{};
+  if constexpr (TTraits::split) {
+    // the rounding errors of a - b, a + b and the division, where the latter is exact
+    // for an infinite denominator
+    const auto sum = mid && !big;
+    const TVal num_lo = blend(sum, TVal{}, two_sum(a, -b).lo);
+    const TVal den_lo = blend(sum, TVal{}, two_sum(a, b).lo);
+    const TVal div_lo = divide_split<TVal>({num, num_lo}, {den, den_lo}).lo;
+    t_lo = flip_sign_bits(blend(den == std::numeric_limits<T>::infinity(), div_lo, TVal{}), neg);
+  }
+  t = flip_sign_bits(t, neg);
+  const TVal hi0 = blend(big, blend(mid, TVal{}, TVal{Pi::pi_4}), TVal{Pi::pi_2});
+  const TVal lo0 = blend(big, blend(mid, TVal{}, TVal{Pi::pi_4_lo}), TVal{Pi::pi_2_lo});
+  const TVal hi1 = blend(big, blend(mid, TVal{Pi::pi}, TVal{Pi::pi_3_4}), TVal{Pi::pi_2});
+  const TVal lo1 = blend(big, blend(mid, TVal{Pi::pi_lo}, TVal{Pi::pi_3_4_lo}), TVal{Pi::pi_2_lo});
+  const TVal z = t * t;
+  const TVal lo =
+    fmadd(t * z, polynomial(z, TTraits::atan_poly), select_bits(neg, lo1, lo0) + t_lo);
+  return select_bits(neg, hi1, hi0) + (t + lo);
+}
+
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal atan(TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = TrigTraits<T, tAccuracy>;
+  using Compute = Traits::Compute;
+  using CVal = MathRebind<TVal, Compute>;
+  const CVal a = atan_kernel<Traits>(abs(convert<Compute>(x)), CVal{Compute{1}}, MathBits<CVal>{});
+  const TVal y = convert<T>(a);
+  // atan is odd
+  return from_bits(to_bits(y) | (to_bits(x) & to_bits(-T{0})), type_tag<TVal>);
+}
+
+template<MathAccuracy tAccuracy, typename TVal>
+GREX_ALWAYS_INLINE inline TVal atan2(TVal y, TVal x) {
+  using T = MathValue<TVal>;
+  using Traits = TrigTraits<T, tAccuracy>;
+  using Compute = Traits::Compute;
+  using CVal = MathRebind<TVal, Compute>;
+  using CBits = FloatSize<Compute>;
+  using Limits = std::numeric_limits<Compute>;
+  constexpr std::size_t sign_bit = 8 * sizeof(CBits) - 1;
+
+  const CVal xc = convert<Compute>(x);
+  CVal ax = abs(xc);
+  CVal ay = abs(convert<Compute>(y));
+  // a + b must not overflow, which scaling by a power of two avoids
+  const CVal scale = blend(max(ax, ay) > Limits::max() / 4, CVal{Compute{1}}, CVal{Compute{0.25}});
+  ax *= scale;
+  ay *= scale;
+  // 0/0 and ∞/∞ are NaN, but the angles are 0 and π/4
+  const auto zero = ay == Compute{0} && ax == Compute{0};
+  const auto inf = ay == Limits::infinity() && ax == Limits::infinity();
+  ax = blend(zero || inf, ax, CVal{Compute{1}});
+  ay = blend(zero, blend(inf, ay, CVal{Compute{1}}), CVal{});
+  // π - atan(|y| / |x|) if the sign of x is set, including -0
+  const auto neg = CBits{} - shift_right<sign_bit>(to_bits(xc));
+  const TVal r = convert<T>(atan_kernel<Traits>(ay, ax, neg));
+  // atan2 is odd in y
+  return from_bits(to_bits(r) | (to_bits(y) & to_bits(-T{0})), type_tag<TVal>);
+}
+} // namespace detail
+
+#define GREX_MATH_FUNCTION(NAME) \
+  template<FloatVectorizable T> \
+  inline T NAME(T x) { \
+    return detail::NAME(x); \
+  }
+#define GREX_MATH_FUNCTION_TAGGED_SCALAR(NAME) \
+  template<FloatVectorizable T> \
+  inline T NAME(T x, OptValuedScalarTag<T> auto /*tag*/) { \
+    return detail::NAME(x); \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_MATH_FUNCTION_ALL(NAME) \
+  GREX_MATH_FUNCTION(NAME) \
+  GREX_MATH_FUNCTION_TAGGED_SCALAR(NAME)
+#else
+#define GREX_MATH_FUNCTION_ALL(NAME) \
+  GREX_MATH_FUNCTION(NAME) \
+  GREX_MATH_FUNCTION_TAGGED_SCALAR(NAME) \
+  template<FloatVectorizable T, std::size_t tSize> \
+  GREX_ALWAYS_INLINE inline Vector<T, tSize> NAME(Vector<T, tSize> x) { \
+    return detail::NAME(x); \
+  } \
+  /* lane-wise, i.e. the tag only matters for the inactive lanes, which are unspecified */ \
+  template<FpVector TVec> \
+  inline TVec NAME(TVec x, OptTypedVectorTag<TVec> auto /*tag*/) { \
+    return detail::NAME(x); \
+  }
+#endif
+
+/**
+  Lane-wise e^x.
+
+  The error is at most 1 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(exp)
+/**
+  Lane-wise 2^x.
+
+  The error is at most 1 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(exp2)
+/**
+  Lane-wise e^x - 1, which is accurate for small |x|.
+
+  The error is at most 2 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(expm1)
+/**
+  Lane-wise natural logarithm.
+
+  The error is at most 1 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(log)
+/**
+  Lane-wise base-2 logarithm.
+
+  The error is at most 1.5 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(log2)
+/**
+  Lane-wise log(1 + x), which is accurate for small |x|.
+
+  The error is at most 1 ULP.
+*/
+GREX_MATH_FUNCTION_ALL(log1p)
+
+#define GREX_TRIG_FUNCTION(NAME) \
+  template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T> \
+  inline T NAME(T x) { \
+    return detail::NAME<tAccuracy>(x); \
+  }
+#define GREX_TRIG_FUNCTION_TAGGED_SCALAR(NAME) \
+  template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T> \
+  inline T NAME(T x, OptValuedScalarTag<T> auto /*tag*/) { \
+    return detail::NAME<tAccuracy>(x); \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_TRIG_FUNCTION_ALL(NAME) \
+  GREX_TRIG_FUNCTION(NAME) \
+  GREX_TRIG_FUNCTION_TAGGED_SCALAR(NAME)
+#else
+#define GREX_TRIG_FUNCTION_ALL(NAME) \
+  GREX_TRIG_FUNCTION(NAME) \
+  GREX_TRIG_FUNCTION_TAGGED_SCALAR(NAME) \
+  template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T, \
+           std::size_t tSize> \
+  GREX_ALWAYS_INLINE inline Vector<T, tSize> NAME(Vector<T, tSize> x) { \
+    return detail::NAME<tAccuracy>(x); \
+  } \
+  template<MathAccuracy tAccuracy = MathAccuracy::precise, FpVector TVec> \
+  inline TVec NAME(TVec x, OptTypedVectorTag<TVec> auto /*tag*/) { \
+    return detail::NAME<tAccuracy>(x); \
+  }
+#endif
+
+/**
+  Lane-wise sine.
+
+  The error is at most 1 ULP (precise) or 4 ULP (fast) as specified by `MathAccuracy`.
+*/
+GREX_TRIG_FUNCTION_ALL(sin)
+/**
+  Lane-wise cosine.
+
+  The error is at most 1 ULP (precise) or 4 ULP (fast) as specified by `MathAccuracy`.
+*/
+GREX_TRIG_FUNCTION_ALL(cos)
+/**
+  Lane-wise tangent.
+
+  The error is at most 1 ULP for f32 and 1.5 ULP for f64 (precise) or 4 ULP (fast)
+  as specified by `MathAccuracy`.
+*/
+GREX_TRIG_FUNCTION_ALL(tan)
+/**
+  Lane-wise arc tangent.
+
+  The error is at most 1 ULP (precise) or 4 ULP (fast) as specified by `MathAccuracy`.
+*/
+GREX_TRIG_FUNCTION_ALL(atan)
+
+/**
+  Lane-wise sine and cosine, which share the argument reduction.
+
+  The errors are the same as those of `sin` and `cos`.
+*/
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T>
+inline std::pair<T, T> sincos(T x) {
+  return detail::sincos<tAccuracy>(x);
+}
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T>
+inline std::pair<T, T> sincos(T x, OptValuedScalarTag<T> auto /*tag*/) {
+  return detail::sincos<tAccuracy>(x);
+}
+#if !GREX_BACKEND_SCALAR
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::pair<Vector<T, tSize>, Vector<T, tSize>>
+sincos(Vector<T, tSize> x) {
+  return detail::sincos<tAccuracy>(x);
+}
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FpVector TVec>
+inline std::pair<TVec, TVec> sincos(TVec x, OptTypedVectorTag<TVec> auto /*tag*/) {
+  return detail::sincos<tAccuracy>(x);
+}
+#endif
+
+/**
+  Lane-wise angle of the point (x, y), i.e. the arc tangent of y/x in the correct quadrant.
+
+  The error is at most 1 ULP (precise) or 4 ULP (fast) as specified by `MathAccuracy`.
+*/
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T>
+inline T atan2(T y, T x) {
+  return detail::atan2<tAccuracy>(y, x);
+}
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T>
+inline T atan2(T y, T x, OptValuedScalarTag<T> auto /*tag*/) {
+  return detail::atan2<tAccuracy>(y, x);
+}
+#if !GREX_BACKEND_SCALAR
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FloatVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> atan2(Vector<T, tSize> y, Vector<T, tSize> x) {
+  return detail::atan2<tAccuracy>(y, x);
+}
+template<MathAccuracy tAccuracy = MathAccuracy::precise, FpVector TVec>
+inline TVec atan2(TVec y, TVec x, OptTypedVectorTag<TVec> auto /*tag*/) {
+  return detail::atan2<tAccuracy>(y, x);
+}
+#endif
+
+#undef GREX_TRIG_FUNCTION_ALL
+#undef GREX_TRIG_FUNCTION_TAGGED_SCALAR
+#undef GREX_TRIG_FUNCTION
+#undef GREX_MATH_FUNCTION_ALL
+#undef GREX_MATH_FUNCTION_TAGGED_SCALAR
+#undef GREX_MATH_FUNCTION
+} // namespace grex
+
+#endif // INCLUDE_GREX_MATH_HPP
@@ -7,12 +7,18 @@
 #ifndef INCLUDE_GREX_OPERATIONS_TAGGED_HPP
 #define INCLUDE_GREX_OPERATIONS_TAGGED_HPP
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cstddef>
+#include <limits>
+#include <optional>
 #include <span>
+#include <utility>
 
 #include "grex/backend.hpp" // IWYU pragma: keep
 #include "grex/base.hpp"
+#include "grex/operations.hpp"
 #include "grex/tags.hpp"
 
 #if !GREX_BACKEND_SCALAR
@@ -73,6 +79,38 @@ inline TagType<TTag, T> load(const T* src, TTag tag) {
 }
 // TODO Add masked loading?
 
+// load_f16
+template<FloatVectorizable T>
+inline T load_f16(const f16* src, OptValuedScalarTag<T> auto /*tag*/) {
+  return convert<T>(*src);
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, OptValuedFullVectorTag<T> TTag>
+inline Vector<T, TTag::size> load_f16(const f16* src, TTag /*tag*/) {
+  return Vector<T, TTag::size>::load_f16(src);
+}
+template<FloatVectorizable T, OptValuedPartVectorTag<T> TTag>
+inline Vector<T, TTag::size> load_f16(const f16* src, TTag tag) {
+  return Vector<T, TTag::size>::load_part_f16(src, tag.part());
+}
+#endif
+
+// load_bf16
+template<FloatVectorizable T>
+inline T load_bf16(const bf16* src, OptValuedScalarTag<T> auto /*tag*/) {
+  return convert<T>(*src);
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, OptValuedFullVectorTag<T> TTag>
+inline Vector<T, TTag::size> load_bf16(const bf16* src, TTag /*tag*/) {
+  return Vector<T, TTag::size>::load_bf16(src);
+}
+template<FloatVectorizable T, OptValuedPartVectorTag<T> TTag>
+inline Vector<T, TTag::size> load_bf16(const bf16* src, TTag tag) {
+  return Vector<T, TTag::size>::load_part_bf16(src, tag.part());
+}
+#endif
+
 // load_extended
 template<Vectorizable T>
 inline T& load_extended(T* src, OptValuedScalarTag<T> auto /*tag*/) {
@@ -101,6 +139,25 @@ inline bool is_load_valid(std::size_t remaining, TTag tag) {
 }
 // TODO Support masked loading?
 
+// load_interleaved
+template<std::size_t tK, Vectorizable T>
+requires(tK >= 2 && tK <= 4)
+inline std::array<T, tK> load_interleaved(const T* src, OptValuedScalarTag<T> auto /*tag*/) {
+  return static_apply<tK>([&]<std::size_t... tJs>() { return std::array{src[tJs]...}; });
+}
+#if !GREX_BACKEND_SCALAR
+template<std::size_t tK, Vectorizable T, OptValuedFullVectorTag<T> TTag>
+requires(tK >= 2 && tK <= 4)
+inline std::array<Vector<T, TTag::size>, tK> load_interleaved(const T* src, TTag /*tag*/) {
+  return Vector<T, TTag::size>::template load_interleaved<tK>(src);
+}
+template<std::size_t tK, Vectorizable T, OptValuedPartVectorTag<T> TTag>
+requires(tK >= 2 && tK <= 4)
+inline std::array<Vector<T, TTag::size>, tK> load_interleaved(const T* src, TTag tag) {
+  return Vector<T, TTag::size>::template load_part_interleaved<tK>(src, tag.part());
+}
+#endif
+
 // store
 template<Vectorizable T>
 inline void store(T* dst, T src, OptValuedScalarTag<T> auto /*tag*/) {
@@ -116,6 +173,60 @@ inline void store(T* dst, TagType<TTag, T> src, TTag tag) {
 }
 // TODO Support masked storing?
 
+// store_interleaved
+template<Vectorizable T, std::size_t tK>
+requires(tK >= 2 && tK <= 4)
+inline void store_interleaved(T* dst, const std::array<T, tK>& srcs,
+                              OptValuedScalarTag<T> auto /*tag*/) {
+  std::copy(srcs.begin(), srcs.end(), dst);
+}
+#if !GREX_BACKEND_SCALAR
+template<Vectorizable T, std::size_t tK, OptValuedFullVectorTag<T> TTag>
+requires(tK >= 2 && tK <= 4)
+inline void store_interleaved(T* dst, const std::array<Vector<T, TTag::size>, tK>& srcs,
+                              TTag /*tag*/) {
+  store_interleaved(dst, srcs);
+}
+template<Vectorizable T, std::size_t tK, OptValuedPartVectorTag<T> TTag>
+requires(tK >= 2 && tK <= 4)
+inline void store_interleaved(T* dst, const std::array<Vector<T, TTag::size>, tK>& srcs,
+                              TTag tag) {
+  store_part_interleaved(dst, tag.part(), srcs);
+}
+#endif
+
+// store_f16
+template<FloatVectorizable T>
+inline void store_f16(f16* dst, T src, OptValuedScalarTag<T> auto /*tag*/) {
+  *dst = convert<f16>(src);
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, OptValuedFullVectorTag<T> TTag>
+inline void store_f16(f16* dst, Vector<T, TTag::size> src, TTag /*tag*/) {
+  src.store_f16(dst);
+}
+template<FloatVectorizable T, OptValuedPartVectorTag<T> TTag>
+inline void store_f16(f16* dst, Vector<T, TTag::size> src, TTag tag) {
+  src.store_part_f16(dst, tag.part());
+}
+#endif
+
+// store_bf16
+template<FloatVectorizable T>
+inline void store_bf16(bf16* dst, T src, OptValuedScalarTag<T> auto /*tag*/) {
+  *dst = convert<bf16>(src);
+}
+#if !GREX_BACKEND_SCALAR
+template<FloatVectorizable T, OptValuedFullVectorTag<T> TTag>
+inline void store_bf16(bf16* dst, Vector<T, TTag::size> src, TTag /*tag*/) {
+  src.store_bf16(dst);
+}
+template<FloatVectorizable T, OptValuedPartVectorTag<T> TTag>
+inline void store_bf16(bf16* dst, Vector<T, TTag::size> src, TTag tag) {
+  src.store_part_bf16(dst, tag.part());
+}
+#endif
+
 // gather
 template<Vectorizable T, std::size_t tExtent>
 inline T gather(std::span<const T, tExtent> data, IntVectorizable auto idx,
@@ -149,6 +260,93 @@ inline Vector<T, TTag::size> mask_gather(std::span<const T, tExtent> data, AnyMa
 }
 #endif
 
+// scatter
+template<Vectorizable T, std::size_t tExtent>
+inline void scatter(std::span<T, tExtent> data, IntVectorizable auto idx, T value,
+                    OptValuedScalarTag<T> auto /*tag*/) {
+  data[std::size_t(idx)] = value;
+}
+#if !GREX_BACKEND_SCALAR
+template<Vectorizable T, std::size_t tExtent, OptValuedFullVectorTag<T> TTag>
+inline void scatter(std::span<T, tExtent> data, IntVector auto idxs, Vector<T, TTag::size> values,
+                    TTag /*tag*/) {
+  scatter(data, idxs, values);
+}
+template<Vectorizable T, std::size_t tExtent, OptValuedPartialVectorTag<T> TTag>
+inline void scatter(std::span<T, tExtent> data, IntVector auto idxs, Vector<T, TTag::size> values,
+                    TTag tag) {
+  mask_scatter(data, tag.mask(type_tag<T>), idxs, values);
+}
+#endif
+
+// mask_scatter
+template<Vectorizable T, std::size_t tExtent>
+inline void mask_scatter(std::span<T, tExtent> data, bool mask, IntVectorizable auto idx, T value,
+                         OptValuedScalarTag<T> auto /*tag*/) {
+  if (mask) {
+    data[std::size_t(idx)] = value;
+  }
+}
+#if !GREX_BACKEND_SCALAR
+template<Vectorizable T, std::size_t tExtent, OptValuedVectorTag<T> TTag>
+inline void mask_scatter(std::span<T, tExtent> data, AnyMask auto mask, IntVector auto idxs,
+                         Vector<T, TTag::size> values, TTag tag) {
+  mask_scatter(data, tag.mask(mask), idxs, values);
+}
+#endif
+
+// compress
+template<Vectorizable T>
+inline T compress(bool mask, T value, OptValuedScalarTag<T> auto /*tag*/) {
+  return mask ? value : T{};
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+inline TVec compress(MaskFor<TVec> mask, TVec v, OptTypedVectorTag<TVec> auto tag) {
+  return compress(tag.mask(mask), v);
+}
+#endif
+
+// compress_store
+template<Vectorizable T>
+inline std::size_t compress_store(T* dst, bool mask, T value, OptValuedScalarTag<T> auto /*tag*/) {
+  if (mask) {
+    *dst = value;
+  }
+  return std::size_t{mask};
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+inline std::size_t compress_store(typename TVec::Value* dst, MaskFor<TVec> mask, TVec v,
+                                  OptTypedVectorTag<TVec> auto tag) {
+  return compress_store(dst, tag.mask(mask), v);
+}
+#endif
+
+// mask_expand
+template<Vectorizable T>
+inline T mask_expand(T value, bool mask, OptValuedScalarTag<T> auto /*tag*/) {
+  return mask ? value : T{};
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+inline TVec mask_expand(TVec v, MaskFor<TVec> mask, OptTypedVectorTag<TVec> auto tag) {
+  return mask_expand(v, tag.mask(mask));
+}
+#endif
+
+// mask_expand_load
+template<Vectorizable T>
+inline T mask_expand_load(const T* src, bool mask, OptValuedScalarTag<T> auto /*tag*/) {
+  return mask ? *src : T{};
+}
+#if !GREX_BACKEND_SCALAR
+template<Vectorizable T, OptValuedVectorTag<T> TTag>
+inline Vector<T, TTag::size> mask_expand_load(const T* src, Mask<T, TTag::size> mask, TTag tag) {
+  return mask_expand_load(src, tag.mask(mask));
+}
+#endif
+
 // expand scalar with anything
 template<Vectorizable T>
 inline T expand_any(T x, OptValuedScalarTag<T> auto /*tag*/) {
@@ -248,6 +446,148 @@ inline TVec::Value horizontal_add(TVec value, OptTypedVectorTag<TVec> auto tag)
 }
 #endif
 
+// dot: the products are masked, as zeroing one factor would still propagate non-finite values
+template<Vectorizable T>
+inline T dot(T a, T b, OptValuedScalarTag<T> auto /*tag*/) {
+  return a * b;
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+inline TVec::Value dot(TVec a, TVec b, OptTypedVectorTag<TVec> auto tag) {
+  return horizontal_add(tag.mask(a * b));
+}
+#endif
+
+// prefix_sum/prefix_min/prefix_max: each lane only depends on the lanes below it,
+// which is why the inactive lanes of part tags do not have to be masked.
+// Only full and part tags are supported, since masked tags would have to skip inactive lanes.
+#define GREX_OPS_PREFIX_SCALAR(OP) \
+  template<Vectorizable T> \
+  inline T OP(T value, OptValuedScalarTag<T> auto /*tag*/) { \
+    return value; \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_OPS_PREFIX GREX_OPS_PREFIX_SCALAR
+#else
+#define GREX_OPS_PREFIX(OP) \
+  GREX_OPS_PREFIX_SCALAR(OP) \
+  template<AnyVector TVec, typename TTag> \
+  requires(OptTypedFullVectorTag<TTag, TVec> || OptTypedPartVectorTag<TTag, TVec>) \
+  inline TVec OP(TVec v, TTag /*tag*/) { \
+    return OP(v); \
+  }
+#endif
+GREX_OPS_PREFIX(prefix_sum)
+GREX_OPS_PREFIX(prefix_min)
+GREX_OPS_PREFIX(prefix_max)
+#undef GREX_OPS_PREFIX
+#undef GREX_OPS_PREFIX_SCALAR
+
+// exclusive_prefix_sum
+template<Vectorizable T>
+inline T exclusive_prefix_sum(T /*value*/, T carry, OptValuedScalarTag<T> auto /*tag*/) {
+  return carry;
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec, typename TTag>
+requires(OptTypedFullVectorTag<TTag, TVec> || OptTypedPartVectorTag<TTag, TVec>)
+inline TVec exclusive_prefix_sum(TVec v, typename TVec::Value carry, TTag /*tag*/) {
+  return exclusive_prefix_sum(v, carry);
+}
+#endif
+
+// sort/sort_descending: the inactive lanes are treated as the largest/smallest value,
+// i.e. the active values are sorted into the lowest lanes
+template<Vectorizable T>
+inline T sort(T value, OptValuedScalarTag<T> auto /*tag*/) {
+  return value;
+}
+template<Vectorizable T>
+inline T sort_descending(T value, OptValuedScalarTag<T> auto /*tag*/) {
+  return value;
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+inline TVec sort(TVec v, OptTypedVectorTag<TVec> auto tag) {
+  using Value = TVec::Value;
+  using Limits = std::numeric_limits<Value>;
+  if constexpr (OptTypedFullVectorTag<decltype(tag), TVec>) {
+    return sort(v);
+  } else {
+    const Value pad = Limits::has_infinity ? Limits::infinity() : Limits::max();
+    return sort(blend(tag.mask(type_tag<Value>), TVec{pad}, v));
+  }
+}
+template<AnyVector TVec>
+inline TVec sort_descending(TVec v, OptTypedVectorTag<TVec> auto tag) {
+  using Value = TVec::Value;
+  using Limits = std::numeric_limits<Value>;
+  if constexpr (OptTypedFullVectorTag<decltype(tag), TVec>) {
+    return sort_descending(v);
+  } else {
+    const Value pad = Limits::has_infinity ? -Limits::infinity() : Limits::lowest();
+    return sort_descending(blend(tag.mask(type_tag<Value>), TVec{pad}, v));
+  }
+}
+#endif
+
+// add_saturate/subtract_saturate/average_round/abs_diff: the inactive lanes are unspecified
+#define GREX_OPS_NARROW_SCALAR(OP) \
+  template<NarrowIntVectorizable T> \
+  inline auto OP(T a, T b, OptValuedScalarTag<T> auto /*tag*/) { \
+    return OP(a, b); \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_OPS_NARROW GREX_OPS_NARROW_SCALAR
+#else
+#define GREX_OPS_NARROW(OP) \
+  GREX_OPS_NARROW_SCALAR(OP) \
+  template<AnyVector TVec> \
+  requires(NarrowIntVectorizable<typename TVec::Value>) \
+  inline auto OP(TVec a, TVec b, OptTypedVectorTag<TVec> auto /*tag*/) { \
+    return OP(a, b); \
+  }
+#endif
+GREX_OPS_NARROW(add_saturate)
+GREX_OPS_NARROW(subtract_saturate)
+GREX_OPS_NARROW(average_round)
+GREX_OPS_NARROW(abs_diff)
+#undef GREX_OPS_NARROW
+#undef GREX_OPS_NARROW_SCALAR
+
+// sum_abs_diff
+template<NarrowIntVectorizable T>
+inline u64 sum_abs_diff(T a, T b, OptValuedScalarTag<T> auto /*tag*/) {
+  return sum_abs_diff(a, b);
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyVector TVec>
+requires(NarrowIntVectorizable<typename TVec::Value>)
+inline u64 sum_abs_diff(TVec a, TVec b, OptTypedVectorTag<TVec> auto tag) {
+  return sum_abs_diff(tag.mask(a), tag.mask(b));
+}
+#endif
+
+// dot_accumulate: each lane uses a pair of bfloat16 values, the inactive lanes are unspecified
+inline f32 dot_accumulate(const bf16* a, const bf16* b, f32 acc,
+                          OptValuedScalarTag<f32> auto /*tag*/) {
+  // the products are exact in f32
+  acc += convert<f32>(a[0]) * convert<f32>(b[0]);
+  return acc + (convert<f32>(a[1]) * convert<f32>(b[1]));
+}
+#if !GREX_BACKEND_SCALAR
+template<OptValuedFullVectorTag<f32> TTag>
+inline Vector<f32, TTag::size> dot_accumulate(const bf16* a, const bf16* b,
+                                              Vector<f32, TTag::size> acc, TTag /*tag*/) {
+  return dot_accumulate(a, b, acc);
+}
+template<OptValuedPartVectorTag<f32> TTag>
+inline Vector<f32, TTag::size> dot_accumulate(const bf16* a, const bf16* b,
+                                              Vector<f32, TTag::size> acc, TTag tag) {
+  return dot_accumulate_part(a, b, acc, tag.part());
+}
+#endif
+
 // horizontal_min/horizontal_max
 #define GREX_OPS_HMINMAX_SCALAR(OP) \
   template<Vectorizable T> \
@@ -269,6 +609,42 @@ GREX_OPS_HMINMAX(horizontal_min)
 GREX_OPS_HMINMAX(horizontal_max)
 #undef GREX_OPS_HMINMAX
 
+// horizontal_argmin/horizontal_argmax: the inactive lanes are treated as the largest/smallest
+// value; without active lanes, the result is this value and the number of lanes
+#define GREX_OPS_HARGMINMAX_SCALAR(OP) \
+  template<Vectorizable T> \
+  inline std::pair<T, std::size_t> OP(T value, OptValuedScalarTag<T> auto /*tag*/) { \
+    return {value, 0}; \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_OPS_HARGMINMAX(OP, PAD) GREX_OPS_HARGMINMAX_SCALAR(OP)
+#else
+#define GREX_OPS_HARGMINMAX(OP, PAD) \
+  GREX_OPS_HARGMINMAX_SCALAR(OP) \
+  template<AnyVector TVec> \
+  inline std::pair<typename TVec::Value, std::size_t> OP(TVec value, \
+                                                        OptTypedVectorTag<TVec> auto tag) { \
+    using Value = TVec::Value; \
+    using Limits = std::numeric_limits<Value>; \
+    if constexpr (OptTypedFullVectorTag<decltype(tag), TVec>) { \
+      return OP(value); \
+    } else { \
+      const Value pad = PAD; \
+      const auto mask = tag.mask(type_tag<Value>); \
+      const auto best = OP(blend(mask, TVec{pad}, value)); \
+      if (mask[best.second]) { \
+        return best; \
+      } \
+      /* an inactive lane is only found if all active lanes (if any) contain the padding */ \
+      return {pad, first_true(mask).value_or(TVec::size)}; \
+    } \
+  }
+#endif
+GREX_OPS_HARGMINMAX(horizontal_argmin, Limits::has_infinity ? Limits::infinity() : Limits::max())
+GREX_OPS_HARGMINMAX(horizontal_argmax,
+                    Limits::has_infinity ? -Limits::infinity() : Limits::lowest())
+#undef GREX_OPS_HARGMINMAX
+
 // horizontal_and
 inline bool horizontal_and(bool mask, AnyScalarTag auto /*tag*/) {
   return mask;
@@ -284,6 +660,58 @@ inline bool horizontal_and(TMask mask, OptTypedPartialVectorTag<VectorFor<TMask>
 }
 #endif
 
+// horizontal_or
+inline bool horizontal_or(bool mask, AnyScalarTag auto /*tag*/) {
+  return mask;
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyMask TMask>
+inline bool horizontal_or(TMask mask, OptTypedVectorTag<VectorFor<TMask>> auto tag) {
+  return horizontal_or(tag.mask(mask));
+}
+#endif
+
+// none
+inline bool none(bool mask, AnyScalarTag auto /*tag*/) {
+  return !mask;
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyMask TMask>
+inline bool none(TMask mask, OptTypedVectorTag<VectorFor<TMask>> auto tag) {
+  return none(tag.mask(mask));
+}
+#endif
+
+// count_true
+inline std::size_t count_true(bool mask, AnyScalarTag auto /*tag*/) {
+  return std::size_t{mask};
+}
+#if !GREX_BACKEND_SCALAR
+template<AnyMask TMask>
+inline std::size_t count_true(TMask mask, OptTypedVectorTag<VectorFor<TMask>> auto tag) {
+  return count_true(tag.mask(mask));
+}
+#endif
+
+// first_true/last_true
+#define GREX_OPS_FIRSTLAST_SCALAR(OP) \
+  inline std::optional<std::size_t> OP(bool mask, AnyScalarTag auto /*tag*/) { \
+    return mask ? std::optional<std::size_t>{0} : std::nullopt; \
+  }
+#if GREX_BACKEND_SCALAR
+#define GREX_OPS_FIRSTLAST GREX_OPS_FIRSTLAST_SCALAR
+#else
+#define GREX_OPS_FIRSTLAST(OP) \
+  GREX_OPS_FIRSTLAST_SCALAR(OP) \
+  template<AnyMask TMask> \
+  inline std::optional<std::size_t> OP(TMask mask, OptTypedVectorTag<VectorFor<TMask>> auto tag) { \
+    return OP(tag.mask(mask)); \
+  }
+#endif
+GREX_OPS_FIRSTLAST(first_true)
+GREX_OPS_FIRSTLAST(last_true)
+#undef GREX_OPS_FIRSTLAST
+
 // load_multibyte
 template<std::size_t tSrcBytes, OptValuedScalarTag<UnsignedInt<std::bit_ceil(tSrcBytes)>> TTag>
 static UnsignedInt<std::bit_ceil(tSrcBytes)>
@@ -302,6 +730,41 @@ template<MultiByteIterator TIt, AnyTag TTag>
 static auto load_multibyte(TIt it, TTag tag) {
   return load_multibyte(it.raw(), index_tag<TIt::Container::element_bytes>, tag);
 }
+template<std::size_t tSrcBytes, OptValuedScalarTag<UnsignedInt<std::bit_ceil(tSrcBytes)>> TTag>
+static UnsignedInt<std::bit_ceil(tSrcBytes)>
+load_multibyte_big_endian(const std::byte* data, IndexTag<tSrcBytes> src_bytes, TTag /*tag*/) {
+  return backend::load_multibyte_big_endian(data, src_bytes);
+}
+#if !GREX_BACKEND_SCALAR
+template<std::size_t tSrcBytes, OptValuedVectorTag<UnsignedInt<std::bit_ceil(tSrcBytes)>> TTag>
+static Vector<UnsignedInt<std::bit_ceil(tSrcBytes)>, TTag::size>
+load_multibyte_big_endian(const std::byte* data, IndexTag<tSrcBytes> src_bytes, TTag /*tag*/) {
+  using Out = Vector<UnsignedInt<std::bit_ceil(tSrcBytes)>, TTag::size>;
+  return Out::load_multibyte_big_endian(data, src_bytes);
+}
+#endif
+
+// store_multibyte
+template<std::size_t tDstBytes, UnsignedIntVectorizable T>
+requires(tDstBytes <= sizeof(T))
+static void store_multibyte(std::byte* data, T value, IndexTag<tDstBytes> dst_bytes,
+                            OptValuedScalarTag<T> auto /*tag*/) {
+  backend::store_multibyte(data, value, dst_bytes);
+}
+#if !GREX_BACKEND_SCALAR
+template<std::size_t tDstBytes, UnsignedIntVectorizable T, OptValuedFullVectorTag<T> TTag>
+requires(tDstBytes <= sizeof(T))
+static void store_multibyte(std::byte* data, Vector<T, TTag::size> value,
+                            IndexTag<tDstBytes> dst_bytes, TTag /*tag*/) {
+  value.store_multibyte(data, dst_bytes);
+}
+template<std::size_t tDstBytes, UnsignedIntVectorizable T, OptValuedPartVectorTag<T> TTag>
+requires(tDstBytes <= sizeof(T))
+static void store_multibyte(std::byte* data, Vector<T, TTag::size> value,
+                            IndexTag<tDstBytes> dst_bytes, TTag tag) {
+  value.store_multibyte_part(data, tag.part(), dst_bytes);
+}
+#endif
 
 // transform
 template<typename TSize = u64>
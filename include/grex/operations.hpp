@@ -7,6 +7,8 @@
 #ifndef INCLUDE_GREX_OPERATIONS_HPP
 #define INCLUDE_GREX_OPERATIONS_HPP
 
+#include <concepts>
+#include <cstddef>
 #include <limits>
 
 #include "grex/backend/active/operations.hpp" // IWYU pragma: keep
@@ -68,6 +70,56 @@ template<Vectorizable T>
 inline T max(T a, T b) {
   return backend::max(backend::Scalar{a}, backend::Scalar{b}).value;
 }
+template<IntVectorizable T>
+inline T multiply_high(T a, T b) {
+  return backend::multiply_high(backend::Scalar{a}, backend::Scalar{b}).value;
+}
+
+template<WidenableIntVectorizable T>
+inline WideInt<T> multiply_wide(T a, T b) {
+  return backend::multiply_wide(backend::Scalar{a}, backend::Scalar{b}).value;
+}
+
+#define GREX_MATH_SHIFT(NAME) \
+  template<IntVectorizable T> \
+  inline T NAME(T v, std::size_t offset) { \
+    return backend::NAME(backend::Scalar{v}, offset).value; \
+  }
+GREX_MATH_SHIFT(shift_left)
+GREX_MATH_SHIFT(shift_right)
+GREX_MATH_SHIFT(rotate_left)
+GREX_MATH_SHIFT(rotate_right)
+#undef GREX_MATH_SHIFT
+
+#define GREX_MATH_BITMANIP(NAME) \
+  template<IntVectorizable T> \
+  inline T NAME(T v) { \
+    return backend::NAME(backend::Scalar{v}).value; \
+  }
+GREX_MATH_BITMANIP(popcount)
+GREX_MATH_BITMANIP(countl_zero)
+GREX_MATH_BITMANIP(countr_zero)
+GREX_MATH_BITMANIP(byteswap)
+GREX_MATH_BITMANIP(bit_reverse)
+#undef GREX_MATH_BITMANIP
+
+#define GREX_MATH_NARROWARITH(NAME) \
+  template<NarrowIntVectorizable T> \
+  inline T NAME(T a, T b) { \
+    return backend::NAME(backend::Scalar{a}, backend::Scalar{b}).value; \
+  }
+GREX_MATH_NARROWARITH(add_saturate)
+GREX_MATH_NARROWARITH(subtract_saturate)
+GREX_MATH_NARROWARITH(average_round)
+#undef GREX_MATH_NARROWARITH
+template<NarrowIntVectorizable T>
+inline UnsignedInt<sizeof(T)> abs_diff(T a, T b) {
+  return backend::abs_diff(backend::Scalar{a}, backend::Scalar{b}).value;
+}
+template<NarrowIntVectorizable T>
+inline u64 sum_abs_diff(T a, T b) {
+  return backend::sum_abs_diff(backend::Scalar{a}, backend::Scalar{b});
+}
 
 #define GREX_MATH_MASKARITH(NAME) \
   template<Vectorizable T> \
@@ -107,7 +159,7 @@ inline T make_finite(T a) {
 // - floating-point → integer: Always unsafe, since max(f32) ≈ 2^128
 // - otherwise: digits(TDst) >= digits(TSrc), signed(Dst) || unsigned(Src)
 // One of the underlying assumptions is that the number of bits for the mantissa and the exponent
-// grow/shrink together, which is true for f32/f64 (there is no support for f16/bf16)
+// grow/shrink together, which is true for f32/f64 (f16/bf16 are only supported as storage formats)
 template<typename TDst, typename TSrc>
 concept SafeConversion = (!FloatVectorizable<TSrc> || FloatVectorizable<TDst>) &&
                          (SignedVectorizable<TDst> || UnsignedVectorizable<TSrc>) &&
@@ -124,6 +176,32 @@ inline TDst convert(TSrc src, CastTag<tSafe> /*tag*/) {
   return convert<TDst>(src);
 }
 
+// f16/bf16 are only storage formats, so conversions to and from them are not checked for safety
+template<FloatVectorizable TDst>
+inline TDst convert(f16 src) {
+  return TDst(backend::decode_f16(src));
+}
+template<std::same_as<f16> TDst, FloatVectorizable TSrc>
+inline f16 convert(TSrc src) {
+  if constexpr (std::same_as<TSrc, f64>) {
+    return backend::encode_f16(backend::round_odd_f32(src));
+  } else {
+    return backend::encode_f16(src);
+  }
+}
+template<FloatVectorizable TDst>
+inline TDst convert(bf16 src) {
+  return TDst(backend::decode_bf16(src));
+}
+template<std::same_as<bf16> TDst, FloatVectorizable TSrc>
+inline bf16 convert(TSrc src) {
+  if constexpr (std::same_as<TSrc, f64>) {
+    return backend::encode_bf16(backend::round_odd_f32(src));
+  } else {
+    return backend::encode_bf16(src);
+  }
+}
+
 #if !GREX_BACKEND_SCALAR
 template<Vectorizable TDst, AnyVector TSrc>
 inline Vector<TDst, TSrc::size> convert(TSrc src) {
@@ -164,7 +242,9 @@ GREX_ALWAYS_INLINE inline auto subtract(auto... values) {
 }
 
 #if GREX_BACKEND_X86_64
+using backend::runtime_x86_64_extensions;
 using backend::runtime_x86_64_level;
+using backend::X86Extensions;
 #endif
 } // namespace grex
 
@@ -0,0 +1,104 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_REDUCE_HPP
+#define INCLUDE_GREX_REDUCE_HPP
+
+#include <cstddef>
+
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <limits>
+
+#include "grex/types.hpp"
+#endif
+
+// argmin/argmax over arrays keep the best value of each lane of the largest native vectors
+// together with the number of the vector it was found in, which is stored as a value of the
+// same type to avoid converting masks. As these numbers have to be exact, the array is processed
+// in chunks of at most as many vectors as can be numbered exactly, whose results are combined
+// in scalar code, as are the values following the last full vector.
+
+namespace grex {
+namespace detail {
+template<Vectorizable T, bool tMax>
+GREX_ALWAYS_INLINE inline std::size_t arg_extremum(const T* data, std::size_t num,
+                                                   BoolTag<tMax> /*is_max*/) {
+  auto is_better = [](auto a, auto b) GREX_ALWAYS_INLINE {
+    if constexpr (tMax) {
+      return b < a;
+    } else {
+      return a < b;
+    }
+  };
+  std::size_t best = 0;
+  std::size_t i = 0;
+#if !GREX_BACKEND_SCALAR
+  static constexpr std::size_t size = max_native_size<T>;
+  using Vec = Vector<T, size>;
+  using Limits = std::numeric_limits<T>;
+  // the largest number is reserved for the lanes not attaining the extremum
+  static constexpr std::size_t chunk_size =
+    Limits::is_integer ? std::size_t(Limits::max()) : (std::size_t{1} << Limits::digits) - 1;
+  static constexpr T no_vector = Limits::is_integer ? Limits::max() : Limits::infinity();
+
+  while (i + size <= num) {
+    const std::size_t start = i;
+    Vec values = Vec::load(data + i);
+    Vec numbers{};
+    Vec number{T{1}};
+    i += size;
+    for (std::size_t j = 1; j < chunk_size && i + size <= num; ++j, i += size) {
+      const Vec v = Vec::load(data + i);
+      const auto better = is_better(v, values);
+      values = blend(better, values, v);
+      numbers = blend(better, numbers, number);
+      number = number + Vec{T{1}};
+    }
+
+    // the first lane of the first vector attaining the extremum
+    const T value = tMax ? horizontal_max(values) : horizontal_min(values);
+    const Vec firsts = blend(values == Vec{value}, Vec{no_vector}, numbers);
+    const auto [first, lane] = horizontal_argmin(firsts);
+    if (start == 0 || is_better(value, data[best])) {
+      best = start + std::size_t(first) * size + lane;
+    }
+  }
+#endif
+  for (; i < num; ++i) {
+    if (is_better(data[i], data[best])) {
+      best = i;
+    }
+  }
+  return best;
+}
+} // namespace detail
+
+/**
+ * The index of the first minimum of the `num` values in `data`, or `num` if there are no values.
+ *
+ * The result is unspecified if the values contain NaNs.
+ */
+template<Vectorizable T>
+GREX_ALWAYS_INLINE inline std::size_t argmin(const T* data, std::size_t num) {
+  return detail::arg_extremum(data, num, false_tag);
+}
+
+/**
+ * The index of the first maximum of the `num` values in `data`, or `num` if there are no values.
+ *
+ * The result is unspecified if the values contain NaNs.
+ */
+template<Vectorizable T>
+GREX_ALWAYS_INLINE inline std::size_t argmax(const T* data, std::size_t num) {
+  return detail::arg_extremum(data, num, true_tag);
+}
+} // namespace grex
+
+#endif // INCLUDE_GREX_REDUCE_HPP
@@ -0,0 +1,60 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef INCLUDE_GREX_SCAN_HPP
+#define INCLUDE_GREX_SCAN_HPP
+
+#include <cstddef>
+
+#include "grex/backend.hpp" // IWYU pragma: keep
+#include "grex/backend/defs.hpp" // IWYU pragma: keep
+#include "grex/base.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include "grex/types.hpp"
+#endif
+
+// Scans over arrays process the largest native vectors using the in-register prefix operations
+// and carry the last lane of each vector over to the next one as a broadcast vector.
+
+namespace grex {
+/**
+ * Writes the inclusive prefix sums of the `num` values in `in` starting at `carry` to `out`,
+ * i.e. `out[i] = carry + in[0] + … + in[i]`, and returns the sum of `carry` and all values,
+ * which can be used as the carry for the values following them.
+ *
+ * `in` and `out` may be the same, but must not overlap otherwise.
+ */
+template<Vectorizable T>
+GREX_ALWAYS_INLINE inline T prefix_sum(const T* in, T* out, std::size_t num, T carry = T{}) {
+#if GREX_BACKEND_SCALAR
+  for (std::size_t i = 0; i < num; ++i) {
+    carry = detail::wrapping_add(carry, in[i]);
+    out[i] = carry;
+  }
+  return carry;
+#else
+  static constexpr std::size_t size = max_native_size<T>;
+  using Vec = Vector<T, size>;
+  Vec vcarry{carry};
+  std::size_t i = 0;
+  for (; i + size <= num; i += size) {
+    const Vec sums = prefix_sum(Vec::load(in + i)) + vcarry;
+    sums.store(out + i);
+    vcarry = Vec{sums[size - 1]};
+  }
+  if (i == num) {
+    return vcarry[0];
+  }
+  const std::size_t rest = num - i;
+  const Vec sums = prefix_sum(Vec::load_part(in + i, rest)) + vcarry;
+  sums.store_part(out + i, rest);
+  return sums[rest - 1];
+#endif
+}
+} // namespace grex
+
+#endif // INCLUDE_GREX_SCAN_HPP
@@ -21,8 +21,10 @@ static constexpr std::size_t min_native_size = backend::min_native_size<T>;
 
 #if !GREX_BACKEND_SCALAR
 #include <array>
+#include <bit>
 #include <concepts>
 #include <cstddef>
+#include <optional>
 #include <span>
 #include <type_traits>
 #include <utility>
@@ -88,6 +90,13 @@ struct Mask {
     return Mask{backend::single_mask(i, type_tag<Backend>)};
   }
 
+  /** Constructs a mask from a bit mask, in which bit `i` determines lane `i`. */
+  GREX_ALWAYS_INLINE static Mask from_bits(u64 bits)
+  requires(tSize <= 64)
+  {
+    return Mask{backend::from_bits(bits, type_tag<Backend>)};
+  }
+
   /** Converts mask to a mask for another type with the same lane count. */
   template<Vectorizable TDst>
   GREX_ALWAYS_INLINE Mask<TDst, tSize> convert(TypeTag<TDst> /*tag*/ = {}) const {
@@ -155,6 +164,13 @@ struct Mask {
     return backend::to_array(mask_);
   }
 
+  /** Returns contents as a bit mask, in which bit `i` is set if lane `i` is set. */
+  [[nodiscard]] GREX_ALWAYS_INLINE u64 to_bits() const
+  requires(tSize <= 64)
+  {
+    return backend::to_bits(mask_);
+  }
+
 private:
   Backend mask_;
 };
@@ -234,6 +250,36 @@ struct Vector : public VectorBase<T, std::make_index_sequence<tSize>> {
     return Vector{backend::load_part(ptr, num, type_tag<Backend>)};
   }
 
+  /**
+   * Loads `size` tuples of `tK` consecutive values each from unaligned memory,
+   * returning `tK` vectors such that vector `j` contains element `j` of each tuple.
+   */
+  template<std::size_t tK>
+  GREX_ALWAYS_INLINE static std::array<Vector, tK> load_interleaved(const T* ptr)
+  requires(tK >= 2 && tK <= 4)
+  {
+    return from_backends(backend::load_interleaved(ptr, index_tag<tK>, type_tag<Backend>));
+  }
+  /**
+   * Loads `num` (up to `size`) tuples of `tK` consecutive values each from unaligned memory,
+   * returning `tK` vectors with undefined upper lanes.
+   */
+  template<std::size_t tK>
+  GREX_ALWAYS_INLINE static std::array<Vector, tK> load_part_interleaved(const T* ptr,
+                                                                        std::size_t num)
+  requires(tK >= 2 && tK <= 4)
+  {
+    return from_backends(
+      backend::load_part_interleaved(ptr, num, index_tag<tK>, type_tag<Backend>));
+  }
+
+  /** Loads a vector of integers stored in big-endian byte order from unaligned memory. */
+  GREX_ALWAYS_INLINE static Vector load_big_endian(const T* ptr)
+  requires(IntVectorizable<T>)
+  {
+    return Vector{backend::byteswap(backend::load(ptr, type_tag<Backend>))};
+  }
+
   /**
    * Loads `size` unsigned integers stored using `tSrcBytes` bytes each
    * and converts each to `Value`.
@@ -261,6 +307,65 @@ struct Vector : public VectorBase<T, std::make_index_sequence<tSize>> {
     return load_multibyte(it.raw(), index_tag<TIt::Container::element_bytes>);
   }
 
+  /**
+   * Loads `size` unsigned integers stored in big-endian byte order using `tSrcBytes` bytes each
+   * and converts each to `Value`.
+   */
+  template<std::size_t tSrcBytes>
+  GREX_ALWAYS_INLINE static Vector load_multibyte_big_endian(const std::byte* data,
+                                                             IndexTag<tSrcBytes> src_bytes)
+  requires(UnsignedIntVectorizable<T> && tSrcBytes <= sizeof(Value))
+  {
+    const auto* raw = reinterpret_cast<const u8*>(data);
+    return Vector{backend::load_multibyte_big_endian(raw, src_bytes, type_tag<Backend>)};
+  }
+
+  /**
+   * Loads `size` unsigned integers with `tBits` bits each, which are stored contiguously starting
+   * at bit `tFirstBit` of `data[0]` (counting from the least significant bit),
+   * and converts each to `Value`.
+   */
+  template<std::size_t tBits, std::size_t tFirstBit = 0>
+  GREX_ALWAYS_INLINE static Vector load_bitpacked(const std::byte* data, IndexTag<tBits> bits,
+                                                  IndexTag<tFirstBit> first_bit = {})
+  requires(UnsignedIntVectorizable<T> && sizeof(T) >= 4 && 1 <= tBits && tBits <= 32 &&
+           tFirstBit < 8)
+  {
+    const auto* raw = reinterpret_cast<const u8*>(data);
+    return Vector{backend::load_bitpacked(raw, bits, first_bit, type_tag<Backend>)};
+  }
+
+  /** Loads `size` half-precision values from unaligned memory and converts each to `Value`. */
+  GREX_ALWAYS_INLINE static Vector load_f16(const f16* ptr)
+  requires(FloatVectorizable<T>)
+  {
+    return Vector{backend::load_f16(ptr, type_tag<Backend>)};
+  }
+  /**
+   * Loads `num` (up to `size`) half-precision values from memory and converts each to `Value`,
+   * with undefined upper lanes.
+   */
+  GREX_ALWAYS_INLINE static Vector load_part_f16(const f16* ptr, std::size_t num)
+  requires(FloatVectorizable<T>)
+  {
+    return Vector{backend::load_part_f16(ptr, num, type_tag<Backend>)};
+  }
+  /** Loads `size` bfloat16 values from unaligned memory and converts each to `Value`. */
+  GREX_ALWAYS_INLINE static Vector load_bf16(const bf16* ptr)
+  requires(FloatVectorizable<T>)
+  {
+    return Vector{backend::load_bf16(ptr, type_tag<Backend>)};
+  }
+  /**
+   * Loads `num` (up to `size`) bfloat16 values from memory and converts each to `Value`,
+   * with undefined upper lanes.
+   */
+  GREX_ALWAYS_INLINE static Vector load_part_bf16(const bf16* ptr, std::size_t num)
+  requires(FloatVectorizable<T>)
+  {
+    return Vector{backend::load_part_bf16(ptr, num, type_tag<Backend>)};
+  }
+
   /** Returns an undefined vector. */
   GREX_ALWAYS_INLINE static Vector undefined() {
     return Vector{backend::undefined(type_tag<Backend>)};
@@ -394,6 +499,82 @@ struct Vector : public VectorBase<T, std::make_index_sequence<tSize>> {
     backend::store_part(value, vec_, num);
   }
 
+  /**
+   * Stores the lower `tDstBytes` bytes of each lane contiguously, i.e. `size * tDstBytes` bytes,
+   * which is the inverse of `load_multibyte`.
+   */
+  template<std::size_t tDstBytes>
+  GREX_ALWAYS_INLINE void store_multibyte(std::byte* data, IndexTag<tDstBytes> dst_bytes) const
+  requires(UnsignedIntVectorizable<T> && tDstBytes <= sizeof(Value))
+  {
+    backend::store_multibyte(reinterpret_cast<u8*>(data), vec_, dst_bytes);
+  }
+  /**
+   * Stores the lower `tDstBytes` bytes of each of the first `num` (up to `size`) lanes
+   * contiguously, i.e. `num * tDstBytes` bytes.
+   */
+  template<std::size_t tDstBytes>
+  GREX_ALWAYS_INLINE void store_multibyte_part(std::byte* data, std::size_t num,
+                                               IndexTag<tDstBytes> dst_bytes) const
+  requires(UnsignedIntVectorizable<T> && tDstBytes <= sizeof(Value))
+  {
+    backend::store_multibyte_part(reinterpret_cast<u8*>(data), vec_, num, dst_bytes);
+  }
+
+  /**
+   * Stores the lower `tBits` bits of each lane contiguously starting at bit `tFirstBit` of
+   * `data[0]`, which is the inverse of `load_bitpacked`.
+   *
+   * The bits of `data[0]` before `tFirstBit` are preserved, while the remaining bits of the last
+   * byte are cleared, i.e. `(tFirstBit + size * tBits + 7) / 8` bytes are written.
+   */
+  template<std::size_t tBits, std::size_t tFirstBit = 0>
+  GREX_ALWAYS_INLINE void store_bitpacked(std::byte* data, IndexTag<tBits> bits,
+                                          IndexTag<tFirstBit> first_bit = {}) const
+  requires(UnsignedIntVectorizable<T> && sizeof(T) >= 4 && 1 <= tBits && tBits <= 32 &&
+           tFirstBit < 8)
+  {
+    backend::store_bitpacked(reinterpret_cast<u8*>(data), vec_, bits, first_bit);
+  }
+
+  /**
+   * Converts all lanes to half precision, rounding to nearest-even, and stores them to
+   * unaligned memory.
+   */
+  GREX_ALWAYS_INLINE void store_f16(f16* ptr) const
+  requires(FloatVectorizable<T>)
+  {
+    backend::store_f16(ptr, vec_);
+  }
+  /** Converts the first `num` elements to half precision and stores them to unaligned memory. */
+  GREX_ALWAYS_INLINE void store_part_f16(f16* ptr, std::size_t num) const
+  requires(FloatVectorizable<T>)
+  {
+    backend::store_part_f16(ptr, vec_, num);
+  }
+  /**
+   * Converts all lanes to bfloat16, rounding to nearest-even, and stores them to
+   * unaligned memory.
+   */
+  GREX_ALWAYS_INLINE void store_bf16(bf16* ptr) const
+  requires(FloatVectorizable<T>)
+  {
+    backend::store_bf16(ptr, vec_);
+  }
+  /** Converts the first `num` elements to bfloat16 and stores them to unaligned memory. */
+  GREX_ALWAYS_INLINE void store_part_bf16(bf16* ptr, std::size_t num) const
+  requires(FloatVectorizable<T>)
+  {
+    backend::store_part_bf16(ptr, vec_, num);
+  }
+
+  /** Stores all lanes in big-endian byte order to unaligned memory. */
+  GREX_ALWAYS_INLINE void store_big_endian(T* value) const
+  requires(IntVectorizable<T>)
+  {
+    backend::store(value, backend::byteswap(vec_));
+  }
+
 #define GREX_VECTOR_CMP_BINOP(OP, REQ, BACKEND, COMMENT_NAME) \
   /** Lane-wise COMMENT_NAME comparison between vectors. */ \
   GREX_ALWAYS_INLINE friend Mask operator OP(Vector a, Vector b) REQ { \
@@ -472,6 +653,14 @@ struct Vector : public VectorBase<T, std::make_index_sequence<tSize>> {
 
 private:
   using Base::vec_;
+
+  template<std::size_t tNum>
+  GREX_ALWAYS_INLINE static std::array<Vector, tNum>
+  from_backends(const std::array<Backend, tNum>& vs) {
+    return static_apply<tNum>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+      return std::array{Vector{vs[tIdxs]}...};
+    });
+  }
 };
 
 /** Trait indicating whether `T` is a `Mask` type. */
@@ -562,6 +751,114 @@ GREX_ALWAYS_INLINE inline Vector<T, tSize> max(Vector<T, tSize> a, Vector<T, tSi
   return Vector<T, tSize>{backend::max(a.backend(), b.backend())};
 }
 
+/** Lane-wise upper half of the double-width product: @f$ \lfloor a \cdot b / 2^n \rfloor @f$. */
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> multiply_high(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return Vector<T, tSize>{backend::multiply_high(a.backend(), b.backend())};
+}
+
+/** Lane-wise double-width product, which cannot overflow. */
+template<WidenableIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<WideInt<T>, tSize> multiply_wide(Vector<T, tSize> a,
+                                                                  Vector<T, tSize> b) {
+  return Vector<WideInt<T>, tSize>{backend::multiply_wide(a.backend(), b.backend())};
+}
+
+/**
+ * Sums of the double-width products of adjacent lanes, i.e. lane `i` of the result is
+ * @f$ a_{2i} \cdot b_{2i} + a_{2i+1} \cdot b_{2i+1} @f$, which wraps around on overflow.
+ */
+template<WidenableIntVectorizable T, std::size_t tSize>
+requires(tSize >= 4)
+GREX_ALWAYS_INLINE inline Vector<WideInt<T>, tSize / 2> multiply_add_pairs(Vector<T, tSize> a,
+                                                                           Vector<T, tSize> b) {
+  return Vector<WideInt<T>, tSize / 2>{backend::multiply_add_pairs(a.backend(), b.backend())};
+}
+
+/**
+ * Sums of the 16-bit products of adjacent lanes of unsigned and signed 8-bit integers, i.e.
+ * lane `i` of the result is @f$ a_{2i} \cdot b_{2i} + a_{2i+1} \cdot b_{2i+1} @f$, which is
+ * clamped to the range of `i16` instead of wrapping around.
+ */
+template<std::size_t tSize>
+requires(tSize >= 4)
+GREX_ALWAYS_INLINE inline Vector<i16, tSize / 2> multiply_add_pairs(Vector<u8, tSize> a,
+                                                                    Vector<i8, tSize> b) {
+  return Vector<i16, tSize / 2>{backend::multiply_add_pairs(a.backend(), b.backend())};
+}
+
+/** Lane-wise sum, which is clamped to the range of `T` instead of wrapping around. */
+template<NarrowIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> add_saturate(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return Vector<T, tSize>{backend::add_saturate(a.backend(), b.backend())};
+}
+
+/** Lane-wise difference, which is clamped to the range of `T` instead of wrapping around. */
+template<NarrowIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> subtract_saturate(Vector<T, tSize> a,
+                                                             Vector<T, tSize> b) {
+  return Vector<T, tSize>{backend::subtract_saturate(a.backend(), b.backend())};
+}
+
+/** Lane-wise average rounded upwards: @f$ \lfloor (a + b + 1) / 2 \rfloor @f$ without overflow. */
+template<NarrowIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> average_round(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return Vector<T, tSize>{backend::average_round(a.backend(), b.backend())};
+}
+
+/** Lane-wise absolute difference @f$ |a - b| @f$, which always fits into the unsigned type. */
+template<NarrowIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<UnsignedInt<sizeof(T)>, tSize> abs_diff(Vector<T, tSize> a,
+                                                                         Vector<T, tSize> b) {
+  return Vector<UnsignedInt<sizeof(T)>, tSize>{backend::abs_diff(a.backend(), b.backend())};
+}
+
+#define GREX_VECTOR_SHIFT(NAME, DESCRIPTION) \
+  /** Lane-wise DESCRIPTION by the corresponding lane of `offsets`. */ \
+  template<IntVectorizable T, std::size_t tSize> \
+  GREX_ALWAYS_INLINE inline Vector<T, tSize> NAME(Vector<T, tSize> v, \
+                                                  Vector<UnsignedInt<sizeof(T)>, tSize> offsets) { \
+    return Vector<T, tSize>{backend::NAME(v.backend(), offsets.backend())}; \
+  } \
+  /** Lane-wise DESCRIPTION by a runtime `offset` shared by all lanes. */ \
+  template<IntVectorizable T, std::size_t tSize> \
+  GREX_ALWAYS_INLINE inline Vector<T, tSize> NAME(Vector<T, tSize> v, std::size_t offset) { \
+    return Vector<T, tSize>{backend::NAME(v.backend(), offset)}; \
+  }
+// the offsets of shifts need to be smaller than the number of bits
+GREX_VECTOR_SHIFT(shift_left, left shift)
+GREX_VECTOR_SHIFT(shift_right, right shift (logical if unsigned and arithmetic if signed))
+// the offsets of rotations are taken modulo the number of bits
+GREX_VECTOR_SHIFT(rotate_left, left rotation)
+GREX_VECTOR_SHIFT(rotate_right, right rotation)
+#undef GREX_VECTOR_SHIFT
+
+/** Lane-wise left rotation by the compile-time `offset`. */
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> rotate_left(Vector<T, tSize> v,
+                                                       AnyIndexTag auto offset) {
+  return Vector<T, tSize>{backend::rotate_left(v.backend(), offset)};
+}
+/** Lane-wise right rotation by the compile-time `offset`. */
+template<IntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> rotate_right(Vector<T, tSize> v,
+                                                        AnyIndexTag auto offset) {
+  return Vector<T, tSize>{backend::rotate_right(v.backend(), offset)};
+}
+
+#define GREX_VECTOR_BITMANIP(NAME, DESCRIPTION) \
+  /** Lane-wise DESCRIPTION. */ \
+  template<IntVectorizable T, std::size_t tSize> \
+  GREX_ALWAYS_INLINE inline Vector<T, tSize> NAME(Vector<T, tSize> v) { \
+    return Vector<T, tSize>{backend::NAME(v.backend())}; \
+  }
+GREX_VECTOR_BITMANIP(popcount, number of set bits)
+GREX_VECTOR_BITMANIP(countl_zero, number of leading zero bits)
+GREX_VECTOR_BITMANIP(countr_zero, number of trailing zero bits)
+GREX_VECTOR_BITMANIP(byteswap, reversal of the order of the bytes)
+GREX_VECTOR_BITMANIP(bit_reverse, reversal of the order of the bits)
+#undef GREX_VECTOR_BITMANIP
+
 /** Returns mask of lanes with finite values. */
 template<FloatVectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline Mask<T, tSize> is_finite(Vector<T, tSize> v) {
@@ -580,6 +877,105 @@ GREX_ALWAYS_INLINE inline T horizontal_add(Vector<T, tSize> v) {
   return backend::horizontal_add(v.backend());
 }
 
+/** Dot product, i.e. the horizontal sum of the lane-wise products. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline T dot(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return backend::dot(a.backend(), b.backend());
+}
+
+/**
+ * Horizontal sums of a power-of-two number of vectors as the lanes of one vector,
+ * which is more efficient than one horizontal sum per vector.
+ */
+template<Vectorizable T, std::size_t tSize, std::same_as<Vector<T, tSize>>... TVecs>
+requires(sizeof...(TVecs) > 0 && std::has_single_bit(1 + sizeof...(TVecs)))
+GREX_ALWAYS_INLINE inline Vector<T, 1 + sizeof...(TVecs)> horizontal_add_many(Vector<T, tSize> v,
+                                                                             TVecs... vs) {
+  return Vector<T, 1 + sizeof...(TVecs)>{
+    backend::horizontal_add_many(v.backend(), vs.backend()...),
+  };
+}
+
+/** Inclusive prefix sum: `result[i] = v[0] + … + v[i]`. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> prefix_sum(Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::prefix_sum(v.backend())};
+}
+
+/** Exclusive prefix sum starting at `carry`: `result[i] = carry + v[0] + … + v[i - 1]`. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> exclusive_prefix_sum(Vector<T, tSize> v, T carry) {
+  return Vector<T, tSize>{backend::exclusive_prefix_sum(v.backend(), backend::Scalar{carry})};
+}
+
+/** Inclusive prefix minimum: `result[i] = min(v[0], …, v[i])`. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> prefix_min(Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::prefix_min(v.backend())};
+}
+
+/** Inclusive prefix maximum: `result[i] = max(v[0], …, v[i])`. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> prefix_max(Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::prefix_max(v.backend())};
+}
+
+/** Sorts the lanes in ascending order using a sorting network. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> sort(Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::sort(v.backend(), false_tag)};
+}
+
+/** Sorts the lanes in descending order using a sorting network. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> sort_descending(Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::sort(v.backend(), true_tag)};
+}
+
+/**
+ * Merges two vectors sorted in ascending order,
+ * returning the lower and the upper half of the merged values, each sorted in ascending order.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::pair<Vector<T, tSize>, Vector<T, tSize>>
+merge_sorted(Vector<T, tSize> a, Vector<T, tSize> b) {
+  const auto [lo, hi] = backend::merge_sorted(a.backend(), b.backend(), false_tag);
+  return {Vector<T, tSize>{lo}, Vector<T, tSize>{hi}};
+}
+
+/**
+ * Merges two vectors sorted in descending order,
+ * returning the upper and the lower half of the merged values, each sorted in descending order.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::pair<Vector<T, tSize>, Vector<T, tSize>>
+merge_sorted_descending(Vector<T, tSize> a, Vector<T, tSize> b) {
+  const auto [hi, lo] = backend::merge_sorted(a.backend(), b.backend(), true_tag);
+  return {Vector<T, tSize>{hi}, Vector<T, tSize>{lo}};
+}
+
+/**
+ * Transposes `tNum` vectors with `tSize` lanes each into `tSize` vectors with `tNum` lanes each,
+ * i.e. lane `j` of vector `i` becomes lane `i` of vector `j`.
+ */
+template<Vectorizable T, std::size_t tSize, std::size_t tNum>
+requires(tNum >= 2 && std::has_single_bit(tNum))
+GREX_ALWAYS_INLINE inline std::array<Vector<T, tNum>, tSize>
+transpose(const std::array<Vector<T, tSize>, tNum>& vs) {
+  const auto ts = static_apply<tNum>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+    return backend::transpose(std::array{vs[tIdxs].backend()...});
+  });
+  return static_apply<tSize>([&]<std::size_t... tIdxs>() GREX_ALWAYS_INLINE {
+    return std::array{Vector<T, tNum>{ts[tIdxs]}...};
+  });
+}
+
+/** Sum of the lane-wise absolute differences, which does not overflow. */
+template<NarrowIntVectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline u64 sum_abs_diff(Vector<T, tSize> a, Vector<T, tSize> b) {
+  return backend::sum_abs_diff(a.backend(), b.backend());
+}
+
 /** Horizontal minimum across all lanes. */
 template<Vectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline T horizontal_min(Vector<T, tSize> v) {
@@ -592,12 +988,54 @@ GREX_ALWAYS_INLINE inline T horizontal_max(Vector<T, tSize> v) {
   return backend::horizontal_max(v.backend());
 }
 
+/** Horizontal minimum across all lanes together with the first lane attaining it. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::pair<T, std::size_t> horizontal_argmin(Vector<T, tSize> v) {
+  return backend::horizontal_argmin(v.backend());
+}
+
+/** Horizontal maximum across all lanes together with the first lane attaining it. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::pair<T, std::size_t> horizontal_argmax(Vector<T, tSize> v) {
+  return backend::horizontal_argmax(v.backend());
+}
+
 /** Horizontal logical _AND_ over all mask lanes. */
 template<Vectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline bool horizontal_and(Mask<T, tSize> m) {
   return backend::horizontal_and(m.backend());
 }
 
+/** Horizontal logical _OR_ over all mask lanes, i.e. whether any lane is set. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline bool horizontal_or(Mask<T, tSize> m) {
+  return backend::horizontal_or(m.backend());
+}
+
+/** Whether no mask lane is set. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline bool none(Mask<T, tSize> m) {
+  return !backend::horizontal_or(m.backend());
+}
+
+/** The number of set mask lanes. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::size_t count_true(Mask<T, tSize> m) {
+  return backend::count_true(m.backend());
+}
+
+/** The index of the first set mask lane, if there is one. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::optional<std::size_t> first_true(Mask<T, tSize> m) {
+  return backend::first_true(m.backend());
+}
+
+/** The index of the last set mask lane, if there is one. */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::optional<std::size_t> last_true(Mask<T, tSize> m) {
+  return backend::last_true(m.backend());
+}
+
 /** Lane-wise fused multiply-add: @f$ a \cdot b + c @f$. */
 template<FloatVectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline Vector<T, tSize> fmadd(Vector<T, tSize> a, Vector<T, tSize> b,
@@ -626,6 +1064,28 @@ GREX_ALWAYS_INLINE inline Vector<T, tSize> fnmsub(Vector<T, tSize> a, Vector<T,
   return Vector<T, tSize>{backend::fnmsub(a.backend(), b.backend(), c.backend())};
 }
 
+/**
+ * Accumulates dot products of pairs of bfloat16 values, i.e. lane @f$ i @f$ of the result is
+ * @f$ acc_i + a_{2i} \cdot b_{2i} + a_{2i+1} \cdot b_{2i+1} @f$, reading `2 * tSize` values
+ * from unaligned memory at `a` and `b`.
+ * The products are exact, but the rounding of the sums and the handling of subnormals depend
+ * on the hardware.
+ */
+template<std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<f32, tSize> dot_accumulate(const bf16* a, const bf16* b,
+                                                            Vector<f32, tSize> acc) {
+  return Vector<f32, tSize>{backend::dot_accumulate_bf16(a, b, acc.backend())};
+}
+/**
+ * Accumulates dot products of the first `num` (up to `tSize`) pairs of bfloat16 values,
+ * with undefined upper lanes.
+ */
+template<std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<f32, tSize>
+dot_accumulate_part(const bf16* a, const bf16* b, Vector<f32, tSize> acc, std::size_t num) {
+  return Vector<f32, tSize>{backend::dot_accumulate_part_bf16(a, b, acc.backend(), num)};
+}
+
 /** Extracts `v[0]`. */
 template<Vectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline T extract_single(Vector<T, tSize> v) {
@@ -674,6 +1134,46 @@ GREX_ALWAYS_INLINE inline Vector<T, tSize> shuffle(Vector<T, tSize> table) {
   return Vector<T, tSize>{backend::shuffle<tIdxs...>(table.backend())};
 }
 
+/**
+ * Moves the lanes selected by `mask` to the front while preserving their order
+ * and fills the remaining lanes with zeros.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> compress(Mask<T, tSize> mask, Vector<T, tSize> v) {
+  return Vector<T, tSize>{backend::compress(mask.backend(), v.backend())};
+}
+
+/**
+ * Stores the lanes selected by `mask` contiguously to unaligned memory and returns their number.
+ *
+ * Only the memory for the selected lanes is written to.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline std::size_t compress_store(T* dst, Mask<T, tSize> mask,
+                                                     Vector<T, tSize> v) {
+  return backend::compress_store(dst, mask.backend(), v.backend());
+}
+
+/**
+ * Moves the leading lanes of `v` to the lanes selected by `mask` while preserving their order
+ * and fills the remaining lanes with zeros. This is the inverse of `compress`.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> mask_expand(Vector<T, tSize> v, Mask<T, tSize> mask) {
+  return Vector<T, tSize>{backend::mask_expand(v.backend(), mask.backend())};
+}
+
+/**
+ * Loads consecutive values from unaligned memory into the lanes selected by `mask`
+ * and fills the remaining lanes with zeros.
+ *
+ * Only the memory for the selected lanes is read.
+ */
+template<Vectorizable T, std::size_t tSize>
+GREX_ALWAYS_INLINE inline Vector<T, tSize> mask_expand_load(const T* src, Mask<T, tSize> mask) {
+  return Vector<T, tSize>{backend::mask_expand_load(src, mask.backend())};
+}
+
 /** Masked add: `result[i] = mask[i] ? a[i] + b[i] : a[i]`. */
 template<Vectorizable T, std::size_t tSize>
 GREX_ALWAYS_INLINE inline Vector<T, tSize> mask_add(Mask<T, tSize> mask, Vector<T, tSize> a,
@@ -702,6 +1202,45 @@ GREX_ALWAYS_INLINE inline Vector<T, tSize> mask_divide(Mask<T, tSize> mask, Vect
   return Vector<T, tSize>{backend::mask_divide(mask.backend(), a.backend(), b.backend())};
 }
 
+/**
+ * Stores the `tK` vectors `srcs` to unaligned memory as `size` tuples of `tK` consecutive values,
+ * such that tuple `i` consists of lane `i` of each vector.
+ */
+template<Vectorizable T, std::size_t tSize, std::size_t tK>
+requires(tK >= 2 && tK <= 4)
+GREX_ALWAYS_INLINE inline void store_interleaved(T* dst,
+                                                 const std::array<Vector<T, tSize>, tK>& srcs) {
+  static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+    backend::store_interleaved(dst, std::array{srcs[tJs].backend()...});
+  });
+}
+/** Stores two to four vectors to unaligned memory as tuples of consecutive values. */
+template<Vectorizable T, std::size_t tSize, std::same_as<Vector<T, tSize>>... TVecs>
+requires(sizeof...(TVecs) >= 1 && sizeof...(TVecs) <= 3)
+GREX_ALWAYS_INLINE inline void store_interleaved(T* dst, Vector<T, tSize> src, TVecs... srcs) {
+  store_interleaved(dst, std::array{src, srcs...});
+}
+
+/**
+ * Stores the first `num` (up to `size`) lanes of the `tK` vectors `srcs` to unaligned memory
+ * as `num` tuples of `tK` consecutive values.
+ */
+template<Vectorizable T, std::size_t tSize, std::size_t tK>
+requires(tK >= 2 && tK <= 4)
+GREX_ALWAYS_INLINE inline void
+store_part_interleaved(T* dst, std::size_t num, const std::array<Vector<T, tSize>, tK>& srcs) {
+  static_apply<tK>([&]<std::size_t... tJs>() GREX_ALWAYS_INLINE {
+    backend::store_part_interleaved(dst, std::array{srcs[tJs].backend()...}, num);
+  });
+}
+/** Stores the first `num` lanes of two to four vectors as tuples of consecutive values. */
+template<Vectorizable T, std::size_t tSize, std::same_as<Vector<T, tSize>>... TVecs>
+requires(sizeof...(TVecs) >= 1 && sizeof...(TVecs) <= 3)
+GREX_ALWAYS_INLINE inline void store_part_interleaved(T* dst, std::size_t num,
+                                                      Vector<T, tSize> src, TVecs... srcs) {
+  store_part_interleaved(dst, num, std::array{src, srcs...});
+}
+
 /** Gathers elements from `data` at `indices` into a vector: `result[i] = data[indices[i]]`. */
 template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
 GREX_ALWAYS_INLINE inline Vector<TValue, tSize> gather(std::span<const TValue, tExtent> data,
@@ -719,6 +1258,32 @@ GREX_ALWAYS_INLINE inline Vector<TValue, tSize> mask_gather(std::span<const TVal
                                                             Vector<TIndex, tSize> indices) {
   return Vector<TValue, tSize>{backend::mask_gather(data, mask.backend(), indices.backend())};
 }
+
+/**
+ * Scatters `values` into `data` at `indices`: `data[indices[i]] = values[i]`.
+ *
+ * The lanes are written in ascending order, i.e. the highest lane wins for duplicate indices.
+ */
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+GREX_ALWAYS_INLINE inline void scatter(std::span<TValue, tExtent> data,
+                                       Vector<TIndex, tSize> indices,
+                                       Vector<TValue, tSize> values) {
+  backend::scatter(data, indices.backend(), values.backend());
+}
+
+/**
+ * Scatters `values` into `data` at `indices` where `mask` is set:
+ * `if (mask[i]) data[indices[i]] = values[i]`.
+ *
+ * The lanes are written in ascending order, i.e. the highest lane wins for duplicate indices.
+ */
+template<Vectorizable TValue, std::size_t tExtent, Vectorizable TIndex, std::size_t tSize>
+GREX_ALWAYS_INLINE inline void mask_scatter(std::span<TValue, tExtent> data,
+                                            Mask<TValue, tSize> mask,
+                                            Vector<TIndex, tSize> indices,
+                                            Vector<TValue, tSize> values) {
+  backend::mask_scatter(data, mask.backend(), indices.backend(), values.backend());
+}
 } // namespace grex
 
 /** `tuple_size` specialization for `grex::Vector` (for tuple-like access). */
@@ -0,0 +1,150 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <array>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+// references using int, which represents all results exactly
+template<grex::NarrowIntVectorizable T>
+inline T add_saturate_ref(T a, T b) {
+  using Limits = std::numeric_limits<T>;
+  return T(std::clamp(int{a} + int{b}, int{Limits::min()}, int{Limits::max()}));
+}
+template<grex::NarrowIntVectorizable T>
+inline T subtract_saturate_ref(T a, T b) {
+  using Limits = std::numeric_limits<T>;
+  return T(std::clamp(int{a} - int{b}, int{Limits::min()}, int{Limits::max()}));
+}
+template<grex::NarrowIntVectorizable T>
+inline T average_round_ref(T a, T b) {
+  const int sum = int{a} + int{b} + 1;
+  // floor division written out, to be independent of the shift used by the implementation
+  return T(sum >= 0 ? sum / 2 : -((1 - sum) / 2));
+}
+template<grex::NarrowIntVectorizable T>
+inline grex::UnsignedInt<sizeof(T)> abs_diff_ref(T a, T b) {
+  return grex::UnsignedInt<sizeof(T)>(std::abs(int{a} - int{b}));
+}
+
+#if !GREX_BACKEND_SCALAR
+template<grex::NarrowIntVectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using U = grex::UnsignedInt<sizeof(T)>;
+  using VC = test::VectorChecker<T, tSize>;
+  using UC = test::VectorChecker<U, tSize>;
+  using MC = test::MaskChecker<T, tSize>;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  std::uniform_int_distribution<int> bdist{0, 1};
+  auto bval = [&](std::size_t /*dummy*/) { return bool(bdist(rng)); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const VC a{dval(tIdxs)...};
+      const VC b{dval(tIdxs)...};
+      const auto label = [&] { return fmt::format("({}, {})", a.vec, b.vec); };
+
+      auto vv2v = [&](auto op, auto ref) {
+        VC{op(a.vec, b.vec), std::array{ref(a.ref[tIdxs], b.ref[tIdxs])...}}.check(label, false);
+        // using the scalar operation as reference
+        VC{op(a.vec, b.vec), std::array{op(a.ref[tIdxs], b.ref[tIdxs])...}}.check(label, false);
+      };
+      vv2v([](auto x, auto y) { return grex::add_saturate(x, y); },
+           [](T x, T y) { return add_saturate_ref(x, y); });
+      vv2v([](auto x, auto y) { return grex::subtract_saturate(x, y); },
+           [](T x, T y) { return subtract_saturate_ref(x, y); });
+      vv2v([](auto x, auto y) { return grex::average_round(x, y); },
+           [](T x, T y) { return average_round_ref(x, y); });
+      VC{grex::add_saturate(a.vec, b.vec, grex::full_tag<tSize>),
+         std::array{add_saturate_ref(a.ref[tIdxs], b.ref[tIdxs])...}}
+        .check(label, false);
+
+      UC{grex::abs_diff(a.vec, b.vec), std::array{abs_diff_ref(a.ref[tIdxs], b.ref[tIdxs])...}}
+        .check(label, false);
+      UC{grex::abs_diff(a.vec, b.vec, grex::full_tag<tSize>),
+         std::array{grex::abs_diff(a.ref[tIdxs], b.ref[tIdxs])...}}
+        .check(label, false);
+
+      // sum_abs_diff
+      auto cmp = [&](grex::u64 val, grex::u64 ref) { test::check(label, val, ref, false); };
+      const grex::u64 sad = (grex::u64{0} + ... + abs_diff_ref(a.ref[tIdxs], b.ref[tIdxs]));
+      cmp(grex::sum_abs_diff(a.vec, b.vec), sad);
+      cmp(grex::sum_abs_diff(a.vec, b.vec, grex::full_tag<tSize>), sad);
+      // part
+      for (std::size_t j = 0; j <= tSize; ++j) {
+        cmp(grex::sum_abs_diff(a.vec, b.vec, grex::part_tag<tSize>(j)),
+            (grex::u64{0} + ... + (tIdxs < j ? abs_diff_ref(a.ref[tIdxs], b.ref[tIdxs]) : 0U)));
+      }
+      // masked
+      const MC m{bval(tIdxs)...};
+      cmp(grex::sum_abs_diff(a.vec, b.vec, grex::typed_masked_tag(m.mask)),
+          (grex::u64{0} + ... + (m.ref[tIdxs] ? abs_diff_ref(a.ref[tIdxs], b.ref[tIdxs]) : 0U)));
+    }
+  });
+}
+#endif
+
+template<grex::NarrowIntVectorizable T>
+void run_scalar(grex::TypeTag<T> /*tag*/) {
+  using Limits = std::numeric_limits<T>;
+  // exhaustive for 8 bit, every 97th pair for 16 bit
+  static constexpr int stride = sizeof(T) == 1 ? 1 : 97;
+  for (int x = Limits::min(); x <= Limits::max(); x += stride) {
+    for (int y = Limits::min(); y <= Limits::max(); y += stride) {
+      const T a = T(x);
+      const T b = T(y);
+      const auto label = [&] { return fmt::format("({}, {})", a, b); };
+      test::check(label, grex::add_saturate(a, b), add_saturate_ref(a, b), false);
+      test::check(label, grex::subtract_saturate(a, b), subtract_saturate_ref(a, b), false);
+      test::check(label, grex::average_round(a, b), average_round_ref(a, b), false);
+      test::check(label, grex::abs_diff(a, b), abs_diff_ref(a, b), false);
+      test::check(label, grex::sum_abs_diff(a, b), grex::u64{abs_diff_ref(a, b)}, false);
+      test::check(label, grex::add_saturate(a, b, grex::scalar_tag), add_saturate_ref(a, b),
+                  false);
+      test::check(label, grex::sum_abs_diff(a, b, grex::scalar_tag),
+                  grex::u64{abs_diff_ref(a, b)}, false);
+    }
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  test::for_each_integral([&]<typename T>(grex::TypeTag<T> tag) {
+    if constexpr (grex::NarrowIntVectorizable<T>) {
+#if !GREX_BACKEND_SCALAR
+      test::for_each_size<T>([&](auto vtag, auto stag) {
+        fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(),
+                   decltype(stag)::value);
+        run_simd(rng, vtag, stag);
+      });
+#endif
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}\n", test::type_name<T>());
+      run_scalar(tag);
+    }
+  });
+}
@@ -0,0 +1,174 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <algorithm>
+#include <array>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+// references using 64-bit integers, which represent all products exactly
+template<grex::WidenableIntVectorizable T>
+inline grex::WideInt<T> multiply_wide_ref(T a, T b) {
+  using Big = grex::CopySignInt<T, 8>;
+  return grex::WideInt<T>(Big{a} * Big{b});
+}
+template<grex::WidenableIntVectorizable T>
+inline grex::WideInt<T> multiply_add_pairs_ref(T a0, T b0, T a1, T b1) {
+  // the sum wraps around, which is well-defined in unsigned arithmetic
+  using Wide = grex::WideInt<T>;
+  using UWide = grex::UnsignedInt<sizeof(Wide)>;
+  return Wide(UWide(UWide(multiply_wide_ref(a0, b0)) + UWide(multiply_wide_ref(a1, b1))));
+}
+
+#if !GREX_BACKEND_SCALAR
+// the sums of the products of unsigned and signed 8-bit integers saturate instead
+inline grex::i16 multiply_add_pairs_ref(grex::u8 a0, grex::i8 b0, grex::u8 a1, grex::i8 b1) {
+  using Limits = std::numeric_limits<grex::i16>;
+  const int sum = int{a0} * int{b0} + int{a1} * int{b1};
+  return grex::i16(std::clamp(sum, int{Limits::min()}, int{Limits::max()}));
+}
+
+template<grex::WidenableIntVectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using Wide = grex::WideInt<T>;
+  using VC = test::VectorChecker<T, tSize>;
+  using WC = test::VectorChecker<Wide, tSize>;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const VC a{dval(tIdxs)...};
+      const VC b{dval(tIdxs)...};
+      const auto label = [&] { return fmt::format("({}, {})", a.vec, b.vec); };
+
+      WC{grex::multiply_wide(a.vec, b.vec),
+         std::array{multiply_wide_ref(a.ref[tIdxs], b.ref[tIdxs])...}}
+        .check(label, false);
+      // the low half is the regular product
+      VC{grex::convert<T>(grex::multiply_wide(a.vec, b.vec)), (a.vec * b.vec).as_array()}.check(
+        label, false);
+
+      if constexpr (tSize >= 4) {
+        grex::static_apply<tSize / 2>([&]<std::size_t... tPairs>() {
+          test::VectorChecker<Wide, tSize / 2>{
+            grex::multiply_add_pairs(a.vec, b.vec),
+            std::array{multiply_add_pairs_ref(a.ref[2 * tPairs], b.ref[2 * tPairs],
+                                              a.ref[2 * tPairs + 1], b.ref[2 * tPairs + 1])...}}
+            .check(label, false);
+        });
+      }
+    }
+  });
+
+  // extreme values, for which the sums of the products overflow
+  using Limits = std::numeric_limits<T>;
+  for (const T x : {Limits::min(), Limits::max()}) {
+    for (const T y : {Limits::min(), Limits::max()}) {
+      const auto label = [&] { return fmt::format("({}, {})", x, y); };
+      const grex::Vector<T, tSize> a{x};
+      const grex::Vector<T, tSize> b{y};
+      test::check(label, grex::multiply_wide(a, b)[0], multiply_wide_ref(x, y), false);
+      if constexpr (tSize >= 4) {
+        test::check(label, grex::multiply_add_pairs(a, b)[0], multiply_add_pairs_ref(x, y, x, y),
+                    false);
+      }
+    }
+  }
+}
+
+template<std::size_t tSize>
+void run_simd_mixed(test::Rng& rng, grex::IndexTag<tSize> /*tag*/) {
+  using grex::i8;
+  using grex::u8;
+  auto adist = test::make_distribution<u8>();
+  auto bdist = test::make_distribution<i8>();
+  auto aval = [&](std::size_t /*dummy*/) { return adist(rng); };
+  auto bval = [&](std::size_t /*dummy*/) { return bdist(rng); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const test::VectorChecker<u8, tSize> a{aval(tIdxs)...};
+      const test::VectorChecker<i8, tSize> b{bval(tIdxs)...};
+      const auto label = [&] { return fmt::format("({}, {})", a.vec, b.vec); };
+      grex::static_apply<tSize / 2>([&]<std::size_t... tPairs>() {
+        test::VectorChecker<grex::i16, tSize / 2>{
+          grex::multiply_add_pairs(a.vec, b.vec),
+          std::array{multiply_add_pairs_ref(a.ref[2 * tPairs], b.ref[2 * tPairs],
+                                            a.ref[2 * tPairs + 1], b.ref[2 * tPairs + 1])...}}
+          .check(label, false);
+      });
+    }
+  });
+
+  // extreme values, for which the sums of the products saturate
+  for (const u8 x : {std::numeric_limits<u8>::min(), std::numeric_limits<u8>::max()}) {
+    for (const i8 y : {std::numeric_limits<i8>::min(), std::numeric_limits<i8>::max()}) {
+      const auto label = [&] { return fmt::format("({}, {})", x, y); };
+      const grex::Vector<u8, tSize> a{x};
+      const grex::Vector<i8, tSize> b{y};
+      test::check(label, grex::multiply_add_pairs(a, b)[0], multiply_add_pairs_ref(x, y, x, y),
+                  false);
+    }
+  }
+}
+#endif
+
+template<grex::WidenableIntVectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T a = dist(rng);
+    const T b = dist(rng);
+    const auto label = [&] { return fmt::format("({}, {})", a, b); };
+    test::check(label, grex::multiply_wide(a, b), multiply_wide_ref(a, b), false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  test::for_each_integral([&]<typename T>(grex::TypeTag<T> tag) {
+    if constexpr (grex::WidenableIntVectorizable<T>) {
+#if !GREX_BACKEND_SCALAR
+      test::for_each_size<T>([&](auto vtag, auto stag) {
+        fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(),
+                   decltype(stag)::value);
+        run_simd(rng, vtag, stag);
+      });
+#endif
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}\n", test::type_name<T>());
+      run_scalar(rng, tag);
+    }
+  });
+
+#if !GREX_BACKEND_SCALAR
+  test::for_each_size<grex::u8>([&](auto /*vtag*/, auto stag) {
+    if constexpr (decltype(stag)::value >= 4) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "u8×i8×{}\n", decltype(stag)::value);
+      run_simd_mixed(rng, stag);
+    }
+  });
+#endif
+}
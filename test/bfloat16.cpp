@@ -0,0 +1,210 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+using grex::bf16;
+using grex::f32;
+using grex::f64;
+using grex::u16;
+
+inline constexpr std::size_t repetitions = 4096;
+inline constexpr u16 max_finite = 0x7F7F;
+template<typename T>
+inline constexpr T inf = std::numeric_limits<T>::infinity();
+
+// reference for the value of a bfloat16 number
+inline f64 value_ref(u16 bits) {
+  const int expo = (bits >> 7U) & 0xFFU;
+  const int mant = bits & 0x7FU;
+  f64 out{};
+  if (expo == 0xFF) {
+    out = (mant == 0) ? inf<f64> : std::numeric_limits<f64>::quiet_NaN();
+  } else if (expo == 0) {
+    out = std::ldexp(f64(mant), -133);
+  } else {
+    out = std::ldexp(f64(mant + 0x80), expo - 134);
+  }
+  return ((bits & 0x8000U) != 0) ? -out : out;
+}
+template<typename T>
+inline u16 bits_of(T value) {
+  return grex::convert<bf16>(value).bits;
+}
+
+// all values are decoded exactly and encoded back to the same bits
+void run_scalar() {
+  fmt::print(fmt::fg(fmt::terminal_color::blue), "scalar\n");
+  for (std::size_t i = 0; i < 0x10000; ++i) {
+    const u16 bits = u16(i);
+    const f64 ref = value_ref(bits);
+    test::check([&] { return fmt::format("decode f32 {:04x}", i); },
+                grex::convert<f32>(bf16{bits}), f32(ref), false);
+    test::check([&] { return fmt::format("decode f64 {:04x}", i); },
+                grex::convert<f64>(bf16{bits}), ref, false);
+    if (std::isnan(ref)) {
+      test::check("quiet NaN", u16(bits_of(ref) & 0x7FC0U), u16{0x7FC0}, false);
+    } else {
+      test::check([&] { return fmt::format("encode f32 {:04x}", i); }, bits_of(f32(ref)), bits,
+                  false);
+      test::check([&] { return fmt::format("encode f64 {:04x}", i); }, bits_of(ref), bits, false);
+    }
+  }
+
+  // the midpoints between neighbouring values are rounded to even,
+  // the values just below and above them to the nearest value
+  for (u16 bits = 0; bits < max_finite; ++bits) {
+    const auto next = u16(bits + 1);
+    const f64 mid = (value_ref(bits) + value_ref(next)) / 2;
+    const u16 even = ((bits & 1U) == 0) ? bits : next;
+    auto label = [&] { return fmt::format("midpoint {:04x}", bits); };
+    test::check(label, bits_of(f32(mid)), even, false);
+    test::check(label, bits_of(mid), even, false);
+    test::check(label, bits_of(std::nextafter(f32(mid), 0.F)), bits, false);
+    test::check(label, bits_of(std::nextafter(mid, 0.)), bits, false);
+    test::check(label, bits_of(std::nextafter(f32(mid), inf<f32>)), next, false);
+    test::check(label, bits_of(std::nextafter(mid, inf<f64>)), next, false);
+  }
+
+  // overflow to infinity starts at the midpoint between the largest value and 2^128,
+  // which is itself finite in f32
+  const f64 overflow = std::ldexp(f64(0x1FF), 119);
+  test::check("overflow", bits_of(std::nextafter(f32(overflow), 0.F)), max_finite, false);
+  test::check("overflow", bits_of(f32(overflow)), u16{0x7F80}, false);
+  test::check("overflow", bits_of(-1e300), u16{0xFF80}, false);
+
+  // dot products of pairs
+  const std::array<bf16, 2> a{grex::convert<bf16>(1.5F), grex::convert<bf16>(-3.F)};
+  const std::array<bf16, 2> b{grex::convert<bf16>(2.F), grex::convert<bf16>(0.25F)};
+  test::check("dot_accumulate", grex::dot_accumulate(a.data(), b.data(), 1.F, grex::scalar_tag),
+              3.25F, false);
+}
+
+#if !GREX_BACKEND_SCALAR
+// values covering all exponents of bf16 as well as infinity and NaN,
+// and values next to the midpoints between bf16 values, which need to be rounded carefully
+template<typename T>
+inline T random_value(test::Rng& rng) {
+  std::uniform_int_distribution<int> kind_dist{0, 15};
+  std::uniform_int_distribution<u16> bits_dist{};
+  std::uniform_int_distribution<u16> finite_dist{0, u16(max_finite - 1)};
+  std::uniform_real_distribution<T> mant_dist{T(1), T(2)};
+  std::uniform_int_distribution<int> expo_dist{-135, 127};
+  const T sign = (kind_dist(rng) % 2 == 0) ? T(1) : T(-1);
+  switch (kind_dist(rng)) {
+    case 0: return sign * inf<T>;
+    case 1: return std::numeric_limits<T>::quiet_NaN();
+    case 2: return T(value_ref(bits_dist(rng)));
+    case 3: {
+      const u16 bits = finite_dist(rng);
+      const T mid = T((value_ref(bits) + value_ref(u16(bits + 1))) / 2);
+      return sign * std::nextafter(mid, (kind_dist(rng) % 2 == 0) ? T(0) : inf<T>);
+    }
+    default: return sign * std::ldexp(mant_dist(rng), expo_dist(rng));
+  }
+}
+
+template<typename T, std::size_t tSize>
+void run_simd(test::Rng& rng) {
+  using Vec = grex::Vector<T, tSize>;
+  std::uniform_int_distribution<u16> bits_dist{};
+  std::uniform_int_distribution<std::size_t> part_dist{0, tSize};
+
+  for (std::size_t r = 0; r < repetitions; ++r) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const std::array<bf16, tSize> values{bf16{(void(tIdxs), bits_dist(rng))}...};
+      const std::array<T, tSize> ref{grex::convert<T>(values[tIdxs])...};
+      test::VectorChecker<T, tSize>{Vec::load_bf16(values.data()), ref}.check("load_bf16",
+                                                                              false);
+
+      const std::size_t part = part_dist(rng);
+      test::VectorChecker<T, tSize>{Vec::load_part_bf16(values.data(), part), ref}.check(
+        "load_part_bf16", part, false);
+
+      const Vec v{(void(tIdxs), random_value<T>(rng))...};
+      const std::array<u16, tSize> bits_ref{bits_of(v[tIdxs])...};
+      std::array<bf16, tSize + 1> out{};
+      v.store_bf16(out.data());
+      test::check("store_bf16", std::array{out[tIdxs].bits...}, bits_ref, false);
+
+      // the values after the first `part` are not touched
+      out.fill(bf16{0xA5A5});
+      v.store_part_bf16(out.data(), part);
+      const std::array<u16, tSize + 1> part_ref{
+        (tIdxs < part ? bits_ref[tIdxs] : u16{0xA5A5})...,
+        u16{0xA5A5},
+      };
+      test::check("store_part_bf16", std::array{out[tIdxs].bits..., out[tSize].bits}, part_ref,
+                  false);
+    });
+  }
+}
+
+// small integers, for which all products and sums are exact independently of the hardware
+template<std::size_t tSize>
+void run_dot(test::Rng& rng) {
+  using Vec = grex::Vector<f32, tSize>;
+  std::uniform_int_distribution<int> int_dist{-16, 16};
+  std::uniform_int_distribution<std::size_t> part_dist{0, tSize};
+
+  for (std::size_t r = 0; r < repetitions; ++r) {
+    std::array<bf16, 2 * tSize> a{};
+    std::array<bf16, 2 * tSize> b{};
+    for (std::size_t i = 0; i < 2 * tSize; ++i) {
+      a[i] = grex::convert<bf16>(f32(int_dist(rng)));
+      b[i] = grex::convert<bf16>(f32(int_dist(rng)));
+    }
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const Vec acc{f32((void(tIdxs), int_dist(rng)))...};
+      const std::array<f32, tSize> ref{
+        grex::dot_accumulate(a.data() + 2 * tIdxs, b.data() + 2 * tIdxs, acc[tIdxs],
+                             grex::scalar_tag)...,
+      };
+      test::VectorChecker<f32, tSize>{grex::dot_accumulate(a.data(), b.data(), acc), ref}.check(
+        "dot_accumulate", false);
+
+      const std::size_t part = part_dist(rng);
+      test::VectorChecker<f32, tSize>{grex::dot_accumulate_part(a.data(), b.data(), acc, part),
+                                      ref}
+        .check("dot_accumulate_part", part, false);
+    });
+  }
+}
+#endif
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  run_scalar();
+#if !GREX_BACKEND_SCALAR
+  auto op = [&]<typename T>(grex::TypeTag<T> /*tag*/) {
+    test::for_each_size<T>([&]<std::size_t tSize>(auto /*vtag*/, grex::IndexTag<tSize> /*tag*/) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(), tSize);
+      run_simd<T, tSize>(rng);
+      if constexpr (std::same_as<T, f32>) {
+        run_dot<tSize>(rng);
+      }
+    });
+  };
+  op(grex::type_tag<f64>);
+  op(grex::type_tag<f32>);
+#endif
+}
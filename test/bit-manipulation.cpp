@@ -0,0 +1,144 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <array>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+// references using the standard library and a bit-by-bit reversal
+template<grex::IntVectorizable T>
+inline T popcount_ref(T v) {
+  return T(std::popcount(grex::UnsignedInt<sizeof(T)>(v)));
+}
+template<grex::IntVectorizable T>
+inline T countl_zero_ref(T v) {
+  return T(std::countl_zero(grex::UnsignedInt<sizeof(T)>(v)));
+}
+template<grex::IntVectorizable T>
+inline T countr_zero_ref(T v) {
+  return T(std::countr_zero(grex::UnsignedInt<sizeof(T)>(v)));
+}
+template<grex::IntVectorizable T>
+inline T byteswap_ref(T v) {
+  return T(std::byteswap(grex::UnsignedInt<sizeof(T)>(v)));
+}
+template<grex::IntVectorizable T>
+inline T bit_reverse_ref(T v) {
+  using U = grex::UnsignedInt<sizeof(T)>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  const auto u = U(v);
+  U out = 0;
+  for (std::size_t i = 0; i < bits; ++i) {
+    out = U(out | U(U(U(u >> i) & 1U) << (bits - 1 - i)));
+  }
+  return T(out);
+}
+
+// random values with a random number of leading and trailing zeros
+template<grex::IntVectorizable T>
+struct ValueDistribution {
+  using U = grex::UnsignedInt<sizeof(T)>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+
+  T operator()(test::Rng& rng) {
+    const auto v = U(dist(rng));
+    const std::size_t lead = shift_dist(rng);
+    const std::size_t trail = shift_dist(rng);
+    const auto masked = lead == bits ? U{0} : U(U(v << lead) >> lead);
+    return T(trail == bits ? U{0} : U(U(masked >> trail) << trail));
+  }
+
+  decltype(test::make_distribution<T>()) dist = test::make_distribution<T>();
+  std::uniform_int_distribution<std::size_t> shift_dist{0, bits};
+};
+
+#if !GREX_BACKEND_SCALAR
+template<grex::IntVectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+  ValueDistribution<T> dist{};
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+
+  auto check = [&](const VC& a) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const auto label = [&] { return fmt::format("{}", a.vec); };
+      VC{grex::popcount(a.vec), std::array{popcount_ref(a.ref[tIdxs])...}}.check(label, false);
+      VC{grex::countl_zero(a.vec), std::array{countl_zero_ref(a.ref[tIdxs])...}}.check(label,
+                                                                                       false);
+      VC{grex::countr_zero(a.vec), std::array{countr_zero_ref(a.ref[tIdxs])...}}.check(label,
+                                                                                       false);
+      VC{grex::byteswap(a.vec), std::array{byteswap_ref(a.ref[tIdxs])...}}.check(label, false);
+      VC{grex::bit_reverse(a.vec), std::array{bit_reverse_ref(a.ref[tIdxs])...}}.check(label,
+                                                                                       false);
+
+      // big-endian loads and stores agree with byte swaps of the memory contents
+      const std::array swapped{byteswap_ref(a.ref[tIdxs])...};
+      VC{grex::Vector<T, tSize>::load_big_endian(swapped.data()), a.ref}.check(label, false);
+      std::array<T, tSize> stored{};
+      a.vec.store_big_endian(stored.data());
+      VC{grex::Vector<T, tSize>::load(stored.data()), swapped}.check(label, false);
+    });
+  };
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() { check(VC{dval(tIdxs)...}); });
+  }
+  // edge cases
+  using Limits = std::numeric_limits<T>;
+  for (const T x : {T{0}, T{1}, T(-1), Limits::min(), Limits::max()}) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() { check(VC{(void(tIdxs), x)...}); });
+  }
+}
+#endif
+
+template<grex::IntVectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  ValueDistribution<T> dist{};
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T a = dist(rng);
+    const auto label = [&] { return fmt::format("{}", a); };
+    test::check(label, grex::popcount(a), popcount_ref(a), false);
+    test::check(label, grex::countl_zero(a), countl_zero_ref(a), false);
+    test::check(label, grex::countr_zero(a), countr_zero_ref(a), false);
+    test::check(label, grex::byteswap(a), byteswap_ref(a), false);
+    test::check(label, grex::bit_reverse(a), bit_reverse_ref(a), false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  test::for_each_integral([&]<typename T>(grex::TypeTag<T> tag) {
+#if !GREX_BACKEND_SCALAR
+    test::for_each_size<T>([&](auto vtag, auto stag) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(),
+                 decltype(stag)::value);
+      run_simd(rng, vtag, stag);
+    });
+#endif
+    fmt::print(fmt::fg(fmt::terminal_color::blue), "{}\n", test::type_name<T>());
+    run_scalar(rng, tag);
+  });
+}
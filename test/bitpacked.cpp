@@ -0,0 +1,151 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+using grex::u8;
+
+inline constexpr std::size_t repetitions = 256;
+// padding after the data, which bit-packed loads may read
+inline constexpr std::size_t padding = 80;
+// sentinel for the bytes which must not be touched by stores
+inline constexpr u8 sentinel = 0xA5;
+
+// references which read and write one bit at a time
+inline bool get_bit(const std::vector<u8>& buf, std::size_t i) {
+  return ((buf[i / 8] >> (i % 8)) & 1U) != 0;
+}
+inline void set_bit(std::vector<u8>& buf, std::size_t i, bool value) {
+  const auto bit = u8(1U << (i % 8));
+  buf[i / 8] = value ? u8(buf[i / 8] | bit) : u8(buf[i / 8] & ~bit);
+}
+template<typename T>
+inline T load_ref(const std::vector<u8>& buf, std::size_t first, std::size_t bits) {
+  T out = 0;
+  for (std::size_t i = 0; i < bits; ++i) {
+    out = T(out | (T(get_bit(buf, first + i)) << i));
+  }
+  return out;
+}
+template<typename T>
+inline void store_ref(std::vector<u8>& buf, std::size_t first, std::size_t bits, T value) {
+  for (std::size_t i = 0; i < bits; ++i) {
+    set_bit(buf, first + i, ((value >> i) & 1U) != 0);
+  }
+}
+
+inline std::vector<u8> random_bytes(test::Rng& rng, std::size_t size) {
+  std::uniform_int_distribution<unsigned> dist{0, 255};
+  std::vector<u8> out(size);
+  std::generate(out.begin(), out.end(), [&] { return u8(dist(rng)); });
+  return out;
+}
+inline std::byte* bytes(std::vector<u8>& buf) {
+  return reinterpret_cast<std::byte*>(buf.data());
+}
+
+#if !GREX_BACKEND_SCALAR
+template<typename T, std::size_t tSize, std::size_t tBits, std::size_t tFirst>
+void run_simd(test::Rng& rng) {
+  using VC = test::VectorChecker<T, tSize>;
+  static constexpr std::size_t byte_count = (tFirst + tSize * tBits + 7) / 8;
+  std::uniform_int_distribution<T> dist{};
+  const auto label = [] {
+    return fmt::format("{}×{}, {} bits from {}", test::type_name<T>(), tSize, tBits, tFirst);
+  };
+
+  for (std::size_t r = 0; r < repetitions; ++r) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      // loads ignore the bits around the values
+      std::vector<u8> buf = random_bytes(rng, byte_count + padding);
+      const auto loaded = grex::Vector<T, tSize>::load_bitpacked(
+        bytes(buf), grex::index_tag<tBits>, grex::index_tag<tFirst>);
+      VC{loaded, std::array{load_ref<T>(buf, tFirst + tIdxs * tBits, tBits)...}}.check(label,
+                                                                                        false);
+
+      // stores keep the bits before the first value, clear those after the last value
+      // in the same byte and do not touch any other bytes
+      const grex::Vector<T, tSize> v{(void(tIdxs), dist(rng))...};
+      std::vector<u8> ref(byte_count + padding, sentinel);
+      std::fill_n(ref.begin(), byte_count, u8{0});
+      ref[0] = u8(buf[0] & ((1U << tFirst) - 1U));
+      (..., store_ref(ref, tFirst + tIdxs * tBits, tBits, v[tIdxs]));
+      std::vector<u8> out(byte_count + padding, sentinel);
+      out[0] = buf[0];
+      v.store_bitpacked(bytes(out), grex::index_tag<tBits>, grex::index_tag<tFirst>);
+      test::check(label, out, ref, false);
+    });
+  }
+}
+#endif
+
+template<typename T, std::size_t tBits, std::size_t tNum>
+void run_block(test::Rng& rng) {
+  static constexpr std::size_t byte_count = tNum * tBits / 8;
+  std::uniform_int_distribution<T> dist{};
+  const auto label = [] {
+    return fmt::format("{} block of {} × {} bits", test::type_name<T>(), tNum, tBits);
+  };
+
+  for (std::size_t r = 0; r < repetitions / 16; ++r) {
+    std::vector<T> values(tNum);
+    std::generate(values.begin(), values.end(), [&] { return dist(rng); });
+    std::vector<u8> ref(byte_count + padding, sentinel);
+    std::vector<T> ref_values(tNum);
+    for (std::size_t i = 0; i < tNum; ++i) {
+      store_ref(ref, i * tBits, tBits, values[i]);
+      ref_values[i] = load_ref<T>(ref, i * tBits, tBits);
+    }
+
+    std::vector<u8> out(byte_count + padding, sentinel);
+    grex::store_bitpacked_block(bytes(out), values.data(), grex::index_tag<tBits>,
+                                grex::index_tag<tNum>);
+    test::check(label, out, ref, false);
+
+    std::vector<T> loaded(tNum);
+    grex::load_bitpacked_block(bytes(out), loaded.data(), grex::index_tag<tBits>,
+                               grex::index_tag<tNum>);
+    test::check(label, loaded, ref_values, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  auto op = [&]<typename T>(grex::TypeTag<T> /*tag*/) {
+#if !GREX_BACKEND_SCALAR
+    test::for_each_size<T>([&]<std::size_t tSize>(auto /*vtag*/, grex::IndexTag<tSize> /*tag*/) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(), tSize);
+      grex::static_apply<1, 33>([&]<std::size_t... tBits>() {
+        (..., run_simd<T, tSize, tBits, 0>(rng));
+        (..., run_simd<T, tSize, tBits, tBits % 7 + 1>(rng));
+      });
+    });
+#endif
+    fmt::print(fmt::fg(fmt::terminal_color::blue), "{} blocks\n", test::type_name<T>());
+    grex::static_apply<1, 33>([&]<std::size_t... tBits>() {
+      (..., run_block<T, tBits, 128>(rng));
+      (..., run_block<T, tBits, 256>(rng));
+    });
+  };
+  op(grex::type_tag<grex::u64>);
+  op(grex::type_tag<grex::u32>);
+}
@@ -0,0 +1,104 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+using grex::u8;
+inline constexpr std::size_t repetitions = 256;
+
+template<auto... tChars>
+void run(test::Rng& rng) {
+  static constexpr std::array<u8, sizeof...(tChars)> chars{u8(tChars)...};
+  fmt::print(fmt::fg(fmt::terminal_color::blue) | fmt::text_style(fmt::emphasis::bold), "{}\n",
+             chars);
+  const grex::ByteClassifier<tChars...> classifier{};
+  auto ref = [](u8 c) { return std::ranges::find(chars, c) != chars.end(); };
+
+  // bytes which are one of the characters with probability `1 / (1 + misses)`
+  std::uniform_int_distribution<std::size_t> cdist{0, chars.size() - 1};
+  std::uniform_int_distribution<unsigned> bdist{0, 255};
+  auto byte = [&](std::size_t misses) {
+    std::uniform_int_distribution<std::size_t> mdist{0, misses};
+    return (mdist(rng) == 0) ? chars[cdist(rng)] : u8(bdist(rng));
+  };
+
+  for (unsigned c = 0; c < 256; ++c) {
+    test::check("matches", classifier.matches(u8(c)), ref(u8(c)), false);
+    test::check("matches scalar", classifier.matches(u8(c), grex::scalar_tag), ref(u8(c)), false);
+  }
+
+#if !GREX_BACKEND_SCALAR
+  auto op = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
+    std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+    for (std::size_t r = 0; r < repetitions; ++r) {
+      grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+        const test::VectorChecker<u8, tSize> v{(void(tIdxs), byte(1))...};
+        test::MaskChecker<u8, tSize>{classifier.matches(v.vec), {ref(v.ref[tIdxs])...}}.check(
+          "matches vector", false);
+        test::MaskChecker<u8, tSize>{classifier.matches(v.vec, grex::full_tag<tSize>),
+                                     {ref(v.ref[tIdxs])...}}
+          .check("matches full", false);
+        const std::size_t part = pdist(rng);
+        test::MaskChecker<u8, tSize>{classifier.matches(v.vec, grex::part_tag<tSize>(part)),
+                                     {(tIdxs < part && ref(v.ref[tIdxs]))...}}
+          .check("matches part", false);
+      });
+    }
+  };
+  op(grex::index_tag<2>);
+  op(grex::index_tag<16>);
+  op(grex::index_tag<grex::max_native_size<u8>>);
+  op(grex::index_tag<2 * grex::max_native_size<u8>>);
+#endif
+
+  // arrays of all lengths up to four of the largest vectors (64 bytes without vectors),
+  // with matches at all positions
+#if GREX_BACKEND_SCALAR
+  static constexpr std::size_t max_num = 64;
+#else
+  static constexpr std::size_t max_num = 4 * grex::max_native_size<u8>;
+#endif
+  std::vector<u8> data{};
+  for (std::size_t num = 0; num <= max_num; ++num) {
+    for (std::size_t r = 0; r < 16; ++r) {
+      data.resize(num);
+      for (u8& c : data) {
+        c = byte(4 * num);
+      }
+      const auto it = std::ranges::find_first_of(data, chars);
+      test::check("find_first_of", grex::find_first_of(data.data(), num, classifier),
+                  std::size_t(it - data.begin()), false);
+    }
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+  // CSV delimiters
+  run<',', '"', '\n', '\r'>(rng);
+  // JSON structural characters and whitespace
+  run<'{', '}', '[', ']', ':', ',', '"', '\\', ' ', '\t', '\n', '\r'>(rng);
+  // bytes with the most significant bit set
+  run<u8{0x80}, u8{0xFF}, u8{0xC3}, '\0'>(rng);
+  // ten distinct sets of low nibbles, requiring the sets of high nibbles to be used instead
+  run<u8{0x00}, u8{0x11}, u8{0x20}, u8{0x21}, u8{0x32}, u8{0x40}, u8{0x42}, u8{0x51}, u8{0x52},
+      u8{0x60}, u8{0x61}, u8{0x62}, u8{0x73}, u8{0x80}, u8{0x83}, u8{0x91}, u8{0x93}>(rng);
+}
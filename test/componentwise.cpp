@@ -4,10 +4,12 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include <climits>
 #include <cstddef>
 #include <functional>
 #include <limits>
 #include <random>
+#include <type_traits>
 
 #include <fmt/base.h>
 #include <fmt/format.h>
@@ -20,9 +22,17 @@
 namespace test = grex::test;
 inline constexpr std::size_t repetitions = 4096;
 
+// the upper half of the double-width product computed using 128-bit integers
+__extension__ typedef __int128 Int128; // NOLINT
+__extension__ typedef unsigned __int128 UInt128; // NOLINT
+template<grex::IntVectorizable T>
+inline T multiply_high_ref(T a, T b) {
+  using Wide = std::conditional_t<grex::is_signed<T>, Int128, UInt128>;
+  return T((Wide{a} * Wide{b}) >> (sizeof(T) * CHAR_BIT));
+}
+
 #if !GREX_BACKEND_SCALAR
 #include <array>
-#include <climits>
 
 template<grex::Vectorizable T, std::size_t tSize>
 void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
@@ -74,6 +84,12 @@ void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*
         if constexpr (grex::FloatVectorizable<T>) {
           vv2v("divides", std::divides{});
         }
+        if constexpr (grex::IntVectorizable<T>) {
+          vv2vx(
+            "multiply_high", [](auto a, auto b) { return grex::multiply_high(a, b); },
+            [](auto a, auto b) { return multiply_high_ref(a, b); });
+          vv2v("multiply_high", [](auto a, auto b) { return grex::multiply_high(a, b); });
+        }
 
         if constexpr (grex::IntVectorizable<T>) {
           auto f = [&](grex::AnyIndexTag auto offset) {
@@ -311,6 +327,13 @@ void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
         v2v("sqrt", [](auto a) { return grex::sqrt(a); }, [](auto a) { return std::sqrt(a); });
       }
 
+      // multiply_high
+      if constexpr (grex::IntVectorizable<T>) {
+        vv2v(
+          "multiply_high", [](auto a, auto b) { return grex::multiply_high(a, b); },
+          [](auto a, auto b) { return multiply_high_ref(a, b); });
+      }
+
       // min/max
       vv2v(
         "min", [](auto a, auto b) { return grex::min(a, b); },
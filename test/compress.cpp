@@ -0,0 +1,138 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <utility>
+
+#include <fmt/base.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+  using MC = test::MaskChecker<T, tSize>;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  std::uniform_int_distribution<int> bdist{0, 1};
+  auto bval = [&](std::size_t /*dummy*/) { return bool(bdist(rng)); };
+  std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+
+  // the reference: the selected values in order, followed by zeros
+  auto reference = [](const MC& m, const VC& v) {
+    std::array<T, tSize> out{};
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < tSize; ++i) {
+      if (m.ref[i]) {
+        out[j++] = v.ref[i];
+      }
+    }
+    return std::make_pair(out, j);
+  };
+  // check compress_store: the selected values are written and nothing else is touched
+  auto check_store = [&](const auto& label, auto op, const MC& m, const VC& v) {
+    const auto [ref, num] = reference(m, v);
+    const T sentinel = dval(0);
+    std::array<T, tSize + 1> out{};
+    out.fill(sentinel);
+    const std::size_t written = op(out.data());
+    test::check(label, written, num, false);
+    std::array<T, tSize + 1> expected{};
+    expected.fill(sentinel);
+    std::copy_n(ref.begin(), num, expected.begin());
+    test::check(label, out, expected, false);
+  };
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const VC v{dval(tIdxs)...};
+      const MC m{bval(tIdxs)...};
+      const auto label = [&] { return fmt::format("compress({}, {})", m.mask, v.vec); };
+
+      // full
+      {
+        const auto ref = reference(m, v).first;
+        VC{grex::compress(m.mask, v.vec), ref}.check(label, false);
+        VC{grex::compress(m.mask, v.vec, grex::full_tag<tSize>), ref}.check(label, false);
+        check_store(label, [&](T* dst) { return grex::compress_store(dst, m.mask, v.vec); }, m, v);
+        check_store(
+          label,
+          [&](T* dst) { return grex::compress_store(dst, m.mask, v.vec, grex::full_tag<tSize>); },
+          m, v);
+      }
+      // part
+      {
+        const std::size_t part = pdist(rng);
+        const MC pm{(m.ref[tIdxs] && tIdxs < part)...};
+        const auto ref = reference(pm, v).first;
+        VC{grex::compress(m.mask, v.vec, grex::part_tag<tSize>(part)), ref}.check(label, false);
+        check_store(
+          label,
+          [&](T* dst) {
+            return grex::compress_store(dst, m.mask, v.vec, grex::part_tag<tSize>(part));
+          },
+          pm, v);
+      }
+      // masked
+      {
+        const MC mm{bval(tIdxs)...};
+        const MC pm{(m.ref[tIdxs] && mm.ref[tIdxs])...};
+        const auto ref = reference(pm, v).first;
+        VC{grex::compress(m.mask, v.vec, grex::typed_masked_tag(mm.mask)), ref}.check(label,
+                                                                                      false);
+        check_store(
+          label,
+          [&](T* dst) {
+            return grex::compress_store(dst, m.mask, v.vec, grex::typed_masked_tag(mm.mask));
+          },
+          pm, v);
+      }
+    });
+  }
+}
+#endif
+
+template<grex::Vectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+  std::uniform_int_distribution<int> bdist{0, 1};
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T value = dist(rng);
+    const bool mask = bool(bdist(rng));
+    const auto label = [&] { return fmt::format("compress({}, {})", mask, value); };
+    test::check(label, grex::compress(mask, value, grex::scalar_tag), mask ? value : T{}, false);
+
+    const T sentinel = dist(rng);
+    T out = sentinel;
+    const std::size_t written = grex::compress_store(&out, mask, value, grex::scalar_tag);
+    test::check(label, written, std::size_t{mask}, false);
+    test::check(label, out, mask ? value : sentinel, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+  test::run_types([&](auto tag) { run_scalar(rng, tag); });
+}
@@ -0,0 +1,153 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+
+// the quotient and remainder using the built-in operators, wrapping around for min / -1
+template<grex::IntVectorizable T>
+inline std::pair<T, T> divmod_ref(T x, T d) {
+  if constexpr (grex::is_signed<T>) {
+    if (x == std::numeric_limits<T>::min() && d == T(-1)) {
+      return {x, T{0}};
+    }
+  }
+  return {T(x / d), T(x % d)};
+}
+
+// Random values with a bias towards the edge cases: powers of two, their neighbours,
+// and the extreme values
+template<grex::IntVectorizable T>
+inline T sample(test::Rng& rng) {
+  using Limits = std::numeric_limits<T>;
+  static constexpr int bits = sizeof(T) * CHAR_BIT;
+  const auto choice = std::uniform_int_distribution<int>{0, 3}(rng);
+  if (choice == 0) {
+    const auto expo = std::uniform_int_distribution<int>{0, bits - 1}(rng);
+    const auto offset = std::uniform_int_distribution<int>{-1, 1}(rng);
+    const auto value = T(T(T{1} << expo) + T(offset));
+    return std::uniform_int_distribution<int>{0, 1}(rng) ? value : T(T{0} - value);
+  }
+  if (choice == 1) {
+    static constexpr std::array specials{Limits::min(), T(Limits::min() + 1), Limits::max(),
+                                         T(Limits::max() - 1)};
+    return specials[std::uniform_int_distribution<std::size_t>{0, specials.size() - 1}(rng)];
+  }
+  return test::make_distribution<T>()(rng);
+}
+template<grex::IntVectorizable T>
+inline T sample_divisor(test::Rng& rng) {
+  T d = sample<T>(rng);
+  while (d == 0) {
+    d = sample<T>(rng);
+  }
+  return d;
+}
+
+template<grex::IntVectorizable T>
+void check_scalar(const grex::Divider<T>& div, T x) {
+  const auto label = [&] { return fmt::format("{} / {}", x, div.divisor()); };
+  const auto [q, r] = divmod_ref(x, div.divisor());
+  test::check(label, grex::divide(x, div), q, false);
+  test::check(label, grex::modulo(x, div), r, false);
+  test::check(label, grex::divmod(x, div).first, q, false);
+  test::check(label, grex::divmod(x, div).second, r, false);
+  test::check(label, grex::divide(x, div, grex::scalar_tag), q, false);
+  test::check(label, grex::modulo(x, div, grex::scalar_tag), r, false);
+}
+
+#if !GREX_BACKEND_SCALAR
+template<grex::IntVectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+  auto xval = [&](std::size_t /*dummy*/) { return sample<T>(rng); };
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const grex::Divider<T> div{sample_divisor<T>(rng)};
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const VC x{xval(tIdxs)...};
+      const auto label = [&] { return fmt::format("{} / {}", x.vec, div.divisor()); };
+      const std::array refs{divmod_ref(x.ref[tIdxs], div.divisor())...};
+      const std::array<T, tSize> q{refs[tIdxs].first...};
+      const std::array<T, tSize> r{refs[tIdxs].second...};
+
+      VC{grex::divide(x.vec, div), q}.check(label, false);
+      VC{grex::modulo(x.vec, div), r}.check(label, false);
+      const auto [vq, vr] = grex::divmod(x.vec, div);
+      VC{vq, q}.check(label, false);
+      VC{vr, r}.check(label, false);
+      VC{grex::divide(x.vec, div, grex::full_tag<tSize>), q}.check(label, false);
+      VC{grex::modulo(x.vec, div, grex::full_tag<tSize>), r}.check(label, false);
+    });
+  }
+}
+#endif
+
+template<grex::IntVectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  using Limits = std::numeric_limits<T>;
+  if constexpr (sizeof(T) == 1) {
+    // exhaustive
+    for (int d = Limits::min(); d <= Limits::max(); ++d) {
+      if (d != 0) {
+        const grex::Divider<T> div{T(d)};
+        for (int x = Limits::min(); x <= Limits::max(); ++x) {
+          check_scalar(div, T(x));
+        }
+      }
+    }
+  } else if constexpr (sizeof(T) == 2) {
+    // all divisors
+    for (int d = Limits::min(); d <= Limits::max(); ++d) {
+      if (d != 0) {
+        const grex::Divider<T> div{T(d)};
+        for (std::size_t i = 0; i < 64; ++i) {
+          check_scalar(div, sample<T>(rng));
+        }
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const grex::Divider<T> div{sample_divisor<T>(rng)};
+      for (std::size_t j = 0; j < 64; ++j) {
+        check_scalar(div, sample<T>(rng));
+      }
+    }
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  test::for_each_integral([&]<typename T>(grex::TypeTag<T> tag) {
+#if !GREX_BACKEND_SCALAR
+    test::for_each_size<T>([&](auto vtag, auto stag) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(),
+                 decltype(stag)::value);
+      run_simd(rng, vtag, stag);
+    });
+#endif
+    fmt::print(fmt::fg(fmt::terminal_color::blue), "{}\n", test::type_name<T>());
+    run_scalar(rng, tag);
+  });
+}
@@ -113,6 +113,51 @@ void run_simd(test::Rng& rng, grex::TypeTag<TValue> /*tag*/) {
   };
   test::for_each_integral(outer);
 }
+
+// tiny data, which exercises the handling of indices close to the end of the data
+template<grex::Vectorizable TValue>
+void run_simd_small(test::Rng& rng, grex::TypeTag<TValue> /*tag*/) {
+  auto vdist = test::make_distribution<TValue>();
+  std::uniform_int_distribution<int> mdist{0, 1};
+  auto mval = [&](std::size_t /*dummy*/) { return bool(mdist(rng)); };
+
+  for (std::size_t data_size = 1; data_size <= 9; ++data_size) {
+    const auto data = std::make_unique<TValue[]>(data_size);
+    for (std::size_t i = 0; i < data_size; ++i) {
+      data[i] = vdist(rng);
+    }
+    const std::span<const TValue> sdata{data.get(), data_size};
+    std::uniform_int_distribution<std::size_t> idist{0, data_size - 1};
+
+    auto outer = [&]<grex::Vectorizable TIndex>(grex::TypeTag<TIndex> /*tag*/) {
+      auto ival = [&](std::size_t /*dummy*/) { return TIndex(idist(rng)); };
+      auto op = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
+        for (std::size_t i = 0; i < repetitions / 64; ++i) {
+          grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+            test::VectorChecker<TIndex, tSize> idxs{ival(tIdxs)...};
+            test::VectorChecker<TValue, tSize>{
+              grex::gather(sdata, idxs.vec),
+              {sdata[std::size_t(idxs.ref[tIdxs])]...},
+            }
+              .check("gather small", false);
+            test::MaskChecker<TValue, tSize> m{mval(tIdxs)...};
+            test::VectorChecker<TValue, tSize>{
+              grex::mask_gather(sdata, m.mask, idxs.vec),
+              {(m.ref[tIdxs] ? sdata[std::size_t(idxs.ref[tIdxs])] : TValue{})...},
+            }
+              .check("mask_gather small", false);
+          });
+        }
+      };
+
+      constexpr std::size_t size =
+        std::min(grex::max_native_size<TValue>, grex::max_native_size<TIndex>);
+      grex::static_apply<1, std::bit_width(size) + 2>(
+        [&]<std::size_t... tSizes> { (..., op(grex::index_tag<1ULL << tSizes>)); });
+    };
+    test::for_each_integral(outer);
+  }
+}
 #endif
 template<grex::Vectorizable TValue>
 void run_scalar(test::Rng& rng, grex::TypeTag<TValue> /*tag*/) {
@@ -161,6 +206,7 @@ int main() {
   test::Rng rng{seed_source};
   test::for_each_type([&](auto tag) {
 #if !GREX_BACKEND_SCALAR
+    run_simd_small(rng, tag);
     run_simd(rng, tag);
 #endif
     run_scalar(rng, tag);
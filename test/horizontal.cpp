@@ -4,8 +4,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <cstddef>
 #include <random>
+#include <vector>
 
 #include <fmt/base.h>
 #include <fmt/format.h>
@@ -16,9 +18,10 @@
 #include "defs.hpp"
 
 #if !GREX_BACKEND_SCALAR
-#include <algorithm>
+#include <array>
 #include <functional>
 #include <limits>
+#include <utility>
 #endif
 
 namespace test = grex::test;
@@ -32,6 +35,8 @@ void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*
 
   auto dist = test::make_distribution<T>();
   auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  std::uniform_int_distribution<int> sdist{0, 3};
+  auto sval = [&](std::size_t /*dummy*/) { return T(sdist(rng)); };
   std::uniform_int_distribution<int> bdist{0, 1};
   auto bval = [&](std::size_t /*dummy*/) { return bool(bdist(rng)); };
 
@@ -77,6 +82,70 @@ void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*
         cmp(grex::horizontal_add(checker.vec, grex::typed_masked_tag(mchecker.mask)),
             T((... + ((mchecker.ref[tIdxs]) ? checker.ref[tIdxs] : T{}))));
       }
+      {
+        auto hsum_dist = [&] {
+          if constexpr (grex::FloatVectorizable<T>) {
+            return std::uniform_real_distribution<T>(T(0.5), T(1));
+          } else {
+            return dist;
+          }
+        }();
+        auto hsum_val = [&](std::size_t /*dummy*/) { return hsum_dist(rng); };
+        auto cmp = [&](auto label, T val, T ref) {
+          if constexpr (grex::FloatVectorizable<T>) {
+            // the same tolerance as for horizontal_add
+            const bool same = test::are_equivalent(val, ref, T(tSize)).result;
+            test::check_msg(label, same, val, ref, false);
+          } else {
+            test::check(label, val, ref, false);
+          }
+        };
+
+        const VC a{hsum_val(tIdxs)...};
+        const VC b{hsum_val(tIdxs)...};
+        auto product = [&](std::size_t j) { return T(a.ref[j] * b.ref[j]); };
+        const T dref = T((... + product(tIdxs)));
+        const auto dlabel = [&] { return fmt::format("dot({}, {})", a.vec, b.vec); };
+        cmp(dlabel, grex::dot(a.vec, b.vec), dref);
+        cmp(dlabel, grex::dot(a.vec, b.vec, grex::full_tag<tSize>), dref);
+        // the inactive lanes of `b` contain non-finite values, which must not affect the result
+        auto inactive = [&](std::size_t k) {
+          if constexpr (grex::FloatVectorizable<T>) {
+            using Limits = std::numeric_limits<T>;
+            return (k % 2 == 0) ? Limits::quiet_NaN() : Limits::infinity();
+          } else {
+            return dval(k);
+          }
+        };
+        for (std::size_t j = 0; j <= tSize; ++j) {
+          T pref{};
+          for (std::size_t k = 0; k < j; ++k) {
+            pref = T(pref + product(k));
+          }
+          const grex::Vector<T, tSize> bpart{((tIdxs < j) ? b.ref[tIdxs] : inactive(tIdxs))...};
+          cmp(dlabel, grex::dot(a.vec, bpart, grex::part_tag<tSize>(j)), pref);
+        }
+        const MC mchecker{bval(tIdxs)...};
+        const grex::Vector<T, tSize> bmasked{
+          (mchecker.ref[tIdxs] ? b.ref[tIdxs] : inactive(tIdxs))...};
+        cmp(dlabel, grex::dot(a.vec, bmasked, grex::typed_masked_tag(mchecker.mask)),
+            T((... + (mchecker.ref[tIdxs] ? product(tIdxs) : T{}))));
+
+        // the sums of 2 and 4 vectors, as well as of as many vectors as there are lanes
+        const VC c{hsum_val(tIdxs)...};
+        const VC d{hsum_val(tIdxs)...};
+        const auto mlabel = [&] { return fmt::format("horizontal_add_many({}, …)", a.vec); };
+        auto check_many = [&](auto sums, auto... vcs) {
+          const std::array refs{grex::horizontal_add(vcs.vec)...};
+          for (std::size_t j = 0; j < refs.size(); ++j) {
+            cmp(mlabel, sums[j], refs[j]);
+          }
+        };
+        check_many(grex::horizontal_add_many(a.vec, b.vec), a, b);
+        check_many(grex::horizontal_add_many(a.vec, b.vec, c.vec, d.vec), a, b, c, d);
+        const std::array<VC, 4> abcd{a, b, c, d};
+        check_many(grex::horizontal_add_many(abcd[tIdxs % 4].vec...), abcd[tIdxs % 4]...);
+      }
       {
         const VC checker{dval(tIdxs)...};
         const auto ref = std::ranges::min(checker.ref);
@@ -91,6 +160,51 @@ void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*
         test::check(label, grex::horizontal_max(checker.vec), ref, false);
         test::check(label, grex::horizontal_max(checker.vec, grex::full_tag<tSize>), ref, false);
       }
+      {
+        // values from a small range as well, where the first of several equal lanes is found
+        const VC checker{(i % 2 == 0 ? dval(tIdxs) : sval(tIdxs))...};
+        const auto min_it = std::ranges::min_element(checker.ref);
+        const auto max_it = std::ranges::max_element(checker.ref);
+        const auto min_ref = std::make_pair(*min_it, std::size_t(min_it - checker.ref.begin()));
+        const auto max_ref = std::make_pair(*max_it, std::size_t(max_it - checker.ref.begin()));
+        auto check_arg = [&](const auto& label, auto val, auto ref) {
+          test::check(label, val.first, ref.first, false);
+          test::check(label, val.second, ref.second, false);
+        };
+        const auto min_label = [&] { return fmt::format("horizontal_argmin({})", checker.vec); };
+        check_arg(min_label, grex::horizontal_argmin(checker.vec), min_ref);
+        check_arg(min_label, grex::horizontal_argmin(checker.vec, grex::full_tag<tSize>), min_ref);
+        const auto max_label = [&] { return fmt::format("horizontal_argmax({})", checker.vec); };
+        check_arg(max_label, grex::horizontal_argmax(checker.vec), max_ref);
+        check_arg(max_label, grex::horizontal_argmax(checker.vec, grex::full_tag<tSize>), max_ref);
+
+        // the first extremum among the active lanes, or the padding and `tSize` if there are none
+        using Limits = std::numeric_limits<T>;
+        auto arg_ref = [&](auto is_active, bool is_max) {
+          const T pad = Limits::has_infinity ? (is_max ? -Limits::infinity() : Limits::infinity())
+                                             : (is_max ? Limits::lowest() : Limits::max());
+          std::pair<T, std::size_t> best{pad, tSize};
+          for (std::size_t j = 0; j < tSize; ++j) {
+            if (is_active(j) && (best.second == tSize || (is_max ? best.first < checker.ref[j]
+                                                                  : checker.ref[j] < best.first))) {
+              best = {checker.ref[j], j};
+            }
+          }
+          return best;
+        };
+        for (std::size_t j = 0; j <= tSize; ++j) {
+          auto is_active = [&](std::size_t k) { return k < j; };
+          check_arg(min_label, grex::horizontal_argmin(checker.vec, grex::part_tag<tSize>(j)),
+                    arg_ref(is_active, false));
+          check_arg(max_label, grex::horizontal_argmax(checker.vec, grex::part_tag<tSize>(j)),
+                    arg_ref(is_active, true));
+        }
+        const MC mchecker{bval(tIdxs)...};
+        auto is_active = [&](std::size_t k) { return mchecker.ref[k]; };
+        const auto mtag = grex::typed_masked_tag(mchecker.mask);
+        check_arg(min_label, grex::horizontal_argmin(checker.vec, mtag), arg_ref(is_active, false));
+        check_arg(max_label, grex::horizontal_argmax(checker.vec, mtag), arg_ref(is_active, true));
+      }
     });
     grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
       {
@@ -134,12 +248,22 @@ void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
       test::check([&] { return fmt::format("horizontal_add({})", value); },
                   grex::horizontal_add(value, grex::scalar_tag), value, false);
     }
+    {
+      const T a = dist(rng);
+      const T b = dist(rng);
+      test::check([&] { return fmt::format("dot({}, {})", a, b); },
+                  grex::dot(a, b, grex::scalar_tag), T(a * b), false);
+    }
     {
       const T value = dist(rng);
       test::check([&] { return fmt::format("horizontal_min({})", value); },
                   grex::horizontal_min(value, grex::scalar_tag), value, false);
       test::check([&] { return fmt::format("horizontal_max({})", value); },
                   grex::horizontal_max(value, grex::scalar_tag), value, false);
+      test::check([&] { return fmt::format("horizontal_argmin({})", value); },
+                  grex::horizontal_argmin(value, grex::scalar_tag).first, value, false);
+      test::check([&] { return fmt::format("horizontal_argmax({})", value); },
+                  grex::horizontal_argmax(value, grex::scalar_tag).first, value, false);
     }
     {
       const bool value = bool(bdist(rng));
@@ -149,6 +273,31 @@ void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
   }
 }
 
+// arrays of all lengths up to a few vectors, as well as long arrays of values from a small range,
+// which consist of several chunks for 8-bit integers
+template<grex::Vectorizable T>
+void run_array(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+  std::uniform_int_distribution<std::size_t> num_dist{0, 4 * grex::max_native_size<T> + 3};
+  std::uniform_int_distribution<std::size_t> long_dist{0, 1 << 16};
+  std::uniform_int_distribution<int> small_dist{0, 100};
+
+  for (std::size_t i = 0; i < 1024; ++i) {
+    const bool is_long = i % 16 == 0;
+    const std::size_t num = is_long ? long_dist(rng) : num_dist(rng);
+    std::vector<T> data(num);
+    for (T& value : data) {
+      value = is_long ? T(small_dist(rng)) : dist(rng);
+    }
+    const auto min_ref = std::size_t(std::ranges::min_element(data) - data.begin());
+    const auto max_ref = std::size_t(std::ranges::max_element(data) - data.begin());
+    test::check([&] { return fmt::format("argmin {}", num); }, grex::argmin(data.data(), num),
+                min_ref, false);
+    test::check([&] { return fmt::format("argmax {}", num); }, grex::argmax(data.data(), num),
+                max_ref, false);
+  }
+}
+
 int main() {
   pcg_extras::seed_seq_from<std::random_device> seed_source{};
   test::Rng rng{seed_source};
@@ -156,5 +305,8 @@ int main() {
 #if !GREX_BACKEND_SCALAR
   test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
 #endif
-  test::run_types([&](auto tag) { run_scalar(rng, tag); });
+  test::run_types([&](auto tag) {
+    run_scalar(rng, tag);
+    run_array(rng, tag);
+  });
 }
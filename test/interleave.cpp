@@ -0,0 +1,139 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 1024;
+
+#if !GREX_BACKEND_SCALAR
+template<std::size_t tK, grex::Vectorizable T, std::size_t tSize>
+void run_simd_k(test::Rng& rng, grex::IndexTag<tK> /*k*/, grex::TypeTag<T> /*tag*/,
+                grex::IndexTag<tSize> /*tag*/) {
+  using Vec = grex::Vector<T, tSize>;
+  using VC = test::VectorChecker<T, tSize>;
+  static constexpr std::size_t num = tK * tSize;
+
+  auto dist = test::make_distribution<T>();
+  std::uniform_int_distribution<std::size_t> part_dist{0, tSize};
+  // one sentinel past the end to detect writes beyond the tuples that are stored
+  const T sentinel = dist(rng);
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+    for (std::size_t r = 0; r < repetitions; ++r) {
+      std::array<T, num + 1> data{};
+      for (T& x : data) {
+        x = dist(rng);
+      }
+
+      // loading
+      {
+        const std::array<Vec, tK> vs = Vec::template load_interleaved<tK>(data.data());
+        const auto vst = grex::load_interleaved<tK>(data.data(), grex::full_tag<tSize>);
+        for (std::size_t j = 0; j < tK; ++j) {
+          VC{vs[j], {data[tIdxs * tK + j]...}}.check("load_interleaved", false);
+          VC{vst[j], {data[tIdxs * tK + j]...}}.check("load_interleaved tagged", false);
+        }
+      }
+      {
+        const std::size_t part = part_dist(rng);
+        auto masked = [&](const Vec& v) {
+          return std::array{(tIdxs < part ? v[tIdxs] : T{})...};
+        };
+        const std::array<Vec, tK> vs = Vec::template load_part_interleaved<tK>(data.data(), part);
+        const auto vst = grex::load_interleaved<tK>(data.data(), grex::part_tag<tSize>(part));
+        for (std::size_t j = 0; j < tK; ++j) {
+          const std::array ref{(tIdxs < part ? data[tIdxs * tK + j] : T{})...};
+          test::check("load_part_interleaved", masked(vs[j]), ref, false);
+          test::check("load_interleaved part", masked(vst[j]), ref, false);
+        }
+      }
+
+      // storing
+      const std::array<Vec, tK> srcs = grex::static_apply<tK>([&]<std::size_t... tJs> {
+        return std::array{(void(tJs), Vec{(void(tIdxs), dist(rng))...})...};
+      });
+      auto tuple_value = [&](std::size_t i) { return srcs[i % tK][i / tK]; };
+      {
+        std::array<T, num + 1> dst{};
+        dst[num] = sentinel;
+        grex::static_apply<tK>(
+          [&]<std::size_t... tJs> { grex::store_interleaved(dst.data(), srcs[tJs]...); });
+        for (std::size_t i = 0; i < num; ++i) {
+          test::check("store_interleaved", dst[i], tuple_value(i), false);
+        }
+        test::check("store_interleaved sentinel", dst[num], sentinel, false);
+
+        std::array<T, num + 1> dstt{};
+        dstt[num] = sentinel;
+        grex::store_interleaved(dstt.data(), srcs, grex::full_tag<tSize>);
+        test::check("store_interleaved tagged", dstt, dst, false);
+      }
+      {
+        const std::size_t part = part_dist(rng);
+        std::array<T, num + 1> dst{};
+        dst.fill(sentinel);
+        std::array<T, num + 1> dstt = dst;
+        grex::static_apply<tK>([&]<std::size_t... tJs> {
+          grex::store_part_interleaved(dst.data(), part, srcs[tJs]...);
+        });
+        grex::store_interleaved(dstt.data(), srcs, grex::part_tag<tSize>(part));
+        for (std::size_t i = 0; i < num + 1; ++i) {
+          const T ref = (i < part * tK) ? tuple_value(i) : sentinel;
+          test::check("store_part_interleaved", dst[i], ref, false);
+          test::check("store_interleaved part", dstt[i], ref, false);
+        }
+      }
+
+      // round trip
+      {
+        std::array<T, num> dst{};
+        grex::store_interleaved(dst.data(), Vec::template load_interleaved<tK>(data.data()));
+        for (std::size_t i = 0; i < num; ++i) {
+          test::check("interleave round trip", dst[i], data[i], false);
+        }
+      }
+    }
+  });
+}
+#endif
+
+template<std::size_t tK, grex::Vectorizable T>
+void run_scalar_k(test::Rng& rng, grex::IndexTag<tK> /*k*/, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+  for (std::size_t r = 0; r < repetitions; ++r) {
+    std::array<T, tK> data{};
+    for (T& x : data) {
+      x = dist(rng);
+    }
+    test::check("load_interleaved scalar", grex::load_interleaved<tK>(data.data(), grex::scalar_tag),
+                data, false);
+    std::array<T, tK> dst{};
+    grex::store_interleaved(dst.data(), data, grex::scalar_tag);
+    test::check("store_interleaved scalar", dst, data, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+  grex::static_apply<2, 5>([&]<std::size_t... tKs> {
+#if !GREX_BACKEND_SCALAR
+    test::run_types_sizes([&](auto vtag, auto stag) {
+      (..., run_simd_k(rng, grex::index_tag<tKs>, vtag, stag));
+    });
+#endif
+    test::run_types([&](auto tag) { (..., run_scalar_k(rng, grex::index_tag<tKs>, tag)); });
+  });
+}
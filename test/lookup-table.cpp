@@ -0,0 +1,82 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 256;
+
+template<grex::Vectorizable T, std::size_t tTableSize>
+void run(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tTableSize> /*tag*/) {
+  fmt::print(fmt::fg(fmt::terminal_color::blue) | fmt::text_style(fmt::emphasis::bold), "{}×{}\n",
+             test::type_name<T>(), tTableSize);
+  auto dist = test::make_distribution<T>();
+  std::array<T, tTableSize> data{};
+  for (T& v : data) {
+    v = dist(rng);
+  }
+  const grex::LookupTable<T, tTableSize> table{data};
+
+  auto inner = [&]<grex::UnsignedIntVectorizable TIdx>(grex::TypeTag<TIdx> /*tag*/) {
+    std::uniform_int_distribution<TIdx> idist{0, TIdx(tTableSize - 1)};
+    auto ival = [&](std::size_t /*dummy*/) { return idist(rng); };
+
+    for (std::size_t r = 0; r < repetitions; ++r) {
+      const TIdx i = ival(0);
+      test::check("lookup", table.lookup(std::size_t{i}), data[i], false);
+      test::check("lookup scalar", table.lookup(i, grex::scalar_tag), data[i], false);
+    }
+
+#if !GREX_BACKEND_SCALAR
+    auto op = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
+      std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+      for (std::size_t r = 0; r < repetitions; ++r) {
+        grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+          const test::VectorChecker<TIdx, tSize> idxs{ival(tIdxs)...};
+          test::VectorChecker<T, tSize>{
+            table.lookup(idxs.vec, grex::full_tag<tSize>),
+            {data[idxs.ref[tIdxs]]...},
+          }
+            .check("lookup full", false);
+          const std::size_t part = pdist(rng);
+          test::VectorChecker<T, tSize>{
+            table.lookup(idxs.vec, grex::part_tag<tSize>(part)),
+            {((tIdxs < part) ? data[idxs.ref[tIdxs]] : T{})...},
+          }
+            .check("lookup part", false);
+        });
+      }
+    };
+    op(grex::index_tag<grex::max_native_size<T>>);
+    op(grex::index_tag<2 * grex::max_native_size<T>>);
+#endif
+  };
+  inner(grex::type_tag<grex::u8>);
+  inner(grex::type_tag<grex::u16>);
+  inner(grex::type_tag<grex::u32>);
+  inner(grex::type_tag<grex::u64>);
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+  // tables within a single register, across several registers, and beyond the shuffle limit
+  test::for_each_type([&](auto tag) {
+    run(rng, tag, grex::index_tag<16>);
+    run(rng, tag, grex::index_tag<128>);
+    run(rng, tag, grex::index_tag<256>);
+  });
+}
@@ -0,0 +1,135 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+// the reference values of the queries for the given lanes
+template<std::size_t tSize>
+struct Queries {
+  std::size_t count = 0;
+  std::optional<std::size_t> first{};
+  std::optional<std::size_t> last{};
+
+  explicit Queries(const std::array<bool, tSize>& lanes) {
+    for (std::size_t i = 0; i < tSize; ++i) {
+      if (lanes[i]) {
+        ++count;
+        first = first.value_or(i);
+        last = i;
+      }
+    }
+  }
+};
+
+// fmt cannot format std::optional without fmt/std.h
+inline long long opt_index(std::optional<std::size_t> idx) {
+  return idx.has_value() ? static_cast<long long>(*idx) : -1;
+}
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using MC = test::MaskChecker<T, tSize>;
+  using Mask = grex::Mask<T, tSize>;
+
+  // vary the density to cover empty and full masks
+  std::uniform_real_distribution<double> ddist{0.0, 1.0};
+  std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    std::bernoulli_distribution bdist{ddist(rng)};
+    auto bval = [&](std::size_t /*dummy*/) { return bdist(rng); };
+
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const MC m{bval(tIdxs)...};
+      const auto label = [&] { return fmt::format("mask queries({})", m.mask); };
+      auto check = [&](const auto& mask, auto tag, const std::array<bool, tSize>& lanes) {
+        const Queries<tSize> ref{lanes};
+        test::check(label, grex::count_true(mask, tag), ref.count, false);
+        test::check(label, grex::horizontal_or(mask, tag), ref.count > 0, false);
+        test::check(label, grex::none(mask, tag), ref.count == 0, false);
+        test::check(label, opt_index(grex::first_true(mask, tag)), opt_index(ref.first), false);
+        test::check(label, opt_index(grex::last_true(mask, tag)), opt_index(ref.last), false);
+      };
+
+      // untagged
+      {
+        const Queries<tSize> ref{m.ref};
+        test::check(label, grex::count_true(m.mask), ref.count, false);
+        test::check(label, grex::horizontal_or(m.mask), ref.count > 0, false);
+        test::check(label, grex::none(m.mask), ref.count == 0, false);
+        test::check(label, opt_index(grex::first_true(m.mask)), opt_index(ref.first), false);
+        test::check(label, opt_index(grex::last_true(m.mask)), opt_index(ref.last), false);
+      }
+      // bit masks
+      if constexpr (tSize <= 64) {
+        const grex::u64 bits = (... | (grex::u64{m.ref[tIdxs]} << tIdxs));
+        test::check(label, m.mask.to_bits(), bits, false);
+        MC{Mask::from_bits(bits), m.ref}.check(label, false);
+        // bits beyond the size are ignored
+        if constexpr (tSize < 64) {
+          MC{Mask::from_bits(bits | (~grex::u64{} << tSize)), m.ref}.check(label, false);
+        }
+      }
+      // full
+      check(m.mask, grex::full_tag<tSize>, m.ref);
+      // part
+      {
+        const std::size_t part = pdist(rng);
+        check(m.mask, grex::part_tag<tSize>(part), {(m.ref[tIdxs] && tIdxs < part)...});
+      }
+      // masked
+      {
+        const MC mm{bval(tIdxs)...};
+        check(m.mask, grex::typed_masked_tag(mm.mask), {(m.ref[tIdxs] && mm.ref[tIdxs])...});
+      }
+    });
+  }
+}
+#endif
+
+template<grex::Vectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  std::uniform_int_distribution<int> bdist{0, 1};
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const bool mask = bool(bdist(rng));
+    const auto label = [&] { return fmt::format("mask queries({})", mask); };
+    const Queries<1> ref{{mask}};
+    test::check(label, grex::count_true(mask, grex::scalar_tag), ref.count, false);
+    test::check(label, grex::horizontal_or(mask, grex::scalar_tag), mask, false);
+    test::check(label, grex::none(mask, grex::scalar_tag), !mask, false);
+    test::check(label, opt_index(grex::first_true(mask, grex::scalar_tag)), opt_index(ref.first),
+                false);
+    test::check(label, opt_index(grex::last_true(mask, grex::scalar_tag)), opt_index(ref.last),
+                false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+  test::run_types([&](auto tag) { run_scalar(rng, tag); });
+}
@@ -0,0 +1,106 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 16384;
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+  using MC = test::MaskChecker<T, tSize>;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  std::uniform_int_distribution<int> bdist{0, 1};
+  auto bval = [&](std::size_t /*dummy*/) { return bool(bdist(rng)); };
+  std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+
+  // the reference: the leading values in the selected lanes, zeros elsewhere
+  auto reference = [](const VC& v, const MC& m) {
+    std::array<T, tSize> out{};
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < tSize; ++i) {
+      if (m.ref[i]) {
+        out[i] = v.ref[j++];
+      }
+    }
+    return out;
+  };
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+      const VC v{dval(tIdxs)...};
+      const MC m{bval(tIdxs)...};
+      const auto label = [&] { return fmt::format("mask_expand({}, {})", v.vec, m.mask); };
+      const T* src = v.ref.data();
+
+      // full
+      {
+        const auto ref = reference(v, m);
+        VC{grex::mask_expand(v.vec, m.mask), ref}.check(label, false);
+        VC{grex::mask_expand(v.vec, m.mask, grex::full_tag<tSize>), ref}.check(label, false);
+        VC{grex::mask_expand_load(src, m.mask), ref}.check(label, false);
+        VC{grex::mask_expand_load(src, m.mask, grex::full_tag<tSize>), ref}.check(label, false);
+      }
+      // part
+      {
+        const std::size_t part = pdist(rng);
+        const auto tag = grex::part_tag<tSize>(part);
+        const auto ref = reference(v, MC{(m.ref[tIdxs] && tIdxs < part)...});
+        VC{grex::mask_expand(v.vec, m.mask, tag), ref}.check(label, false);
+        VC{grex::mask_expand_load(src, m.mask, tag), ref}.check(label, false);
+      }
+      // masked
+      {
+        const MC mm{bval(tIdxs)...};
+        const auto tag = grex::typed_masked_tag(mm.mask);
+        const auto ref = reference(v, MC{(m.ref[tIdxs] && mm.ref[tIdxs])...});
+        VC{grex::mask_expand(v.vec, m.mask, tag), ref}.check(label, false);
+        VC{grex::mask_expand_load(src, m.mask, tag), ref}.check(label, false);
+      }
+    });
+  }
+}
+#endif
+
+template<grex::Vectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+  std::uniform_int_distribution<int> bdist{0, 1};
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T value = dist(rng);
+    const bool mask = bool(bdist(rng));
+    const auto label = [&] { return fmt::format("mask_expand({}, {})", value, mask); };
+    const T ref = mask ? value : T{};
+    test::check(label, grex::mask_expand(value, mask, grex::scalar_tag), ref, false);
+    test::check(label, grex::mask_expand_load(&value, mask, grex::scalar_tag), ref, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+  test::run_types([&](auto tag) { run_scalar(rng, tag); });
+}
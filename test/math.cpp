@@ -0,0 +1,202 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <type_traits>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <bit>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+
+// long double has 11 more mantissa bits than f64, which suffices as a reference
+using Ref = long double;
+
+// the error of `val` in units of the last place of the exact result `ref`
+template<grex::FloatVectorizable T>
+double ulp_error(T val, Ref ref) {
+  using Limits = std::numeric_limits<T>;
+  if (std::isnan(ref) || std::isnan(val)) {
+    return (std::isnan(ref) && std::isnan(val)) ? 0.0 : Limits::infinity();
+  }
+  if (std::isinf(T(ref)) || std::isinf(val)) {
+    return (T(ref) == val) ? 0.0 : Limits::infinity();
+  }
+  int expo = 0;
+  std::frexp(ref, &expo);
+  const Ref ulp = std::ldexp(Ref{1}, std::max(expo, Limits::min_exponent) - Limits::digits);
+  return double(std::abs(Ref(val) - ref) / ulp);
+}
+
+// Random arguments mixing special values, arbitrary magnitudes and the interesting range,
+// restricted to |x| <= limit
+template<grex::FloatVectorizable T>
+struct Arguments {
+  using Limits = std::numeric_limits<T>;
+  static constexpr std::array specials{
+    T{0},
+    -T{0},
+    T{1},
+    -T{1},
+    Limits::infinity(),
+    -Limits::infinity(),
+    Limits::quiet_NaN(),
+    Limits::denorm_min(),
+    -Limits::denorm_min(),
+    Limits::min() / T{3},
+    Limits::min(),
+    Limits::max(),
+    -Limits::max(),
+    Limits::epsilon(),
+  };
+
+  T lo;
+  T hi;
+  T limit = Limits::infinity();
+
+  T sample(test::Rng& rng) const {
+    const auto choice = std::uniform_int_distribution<int>{0, 7}(rng);
+    if (choice == 0) {
+      return specials[std::uniform_int_distribution<std::size_t>{0, specials.size() - 1}(rng)];
+    }
+    if (choice <= 3) {
+      return test::make_distribution<T>()(rng);
+    }
+    return std::uniform_real_distribution<T>{lo, hi}(rng);
+  }
+  T operator()(test::Rng& rng) const {
+    T x = sample(rng);
+    while (std::abs(x) > limit) {
+      x = sample(rng);
+    }
+    return x;
+  }
+};
+
+template<grex::FloatVectorizable T>
+void run(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  fmt::print(fmt::fg(fmt::terminal_color::magenta) | fmt::text_style(fmt::emphasis::bold), "{}\n",
+             test::type_name<T>());
+
+  // the documented bounds hold with FMA, emulating it can add one ULP
+  const double slack = grex::has_fma ? 0.0 : 1.0;
+
+  auto op = [&]<std::size_t tArity>(const auto& label, auto fun, auto ref,
+                                    const std::array<Arguments<T>, tArity>& args, double bound) {
+    double max_err = 0;
+    auto check = [&](const std::array<T, tArity>& xs, T val) {
+      const double err =
+        ulp_error(val, std::apply([&](auto... x) { return ref(Ref(x)...); }, xs));
+      max_err = std::max(max_err, err);
+      if (!(err <= bound + slack)) {
+        fmt::print(fmt::fg(fmt::terminal_color::red), "{}({}) = {} has an error of {} ULP\n",
+                   label, fmt::join(xs, ", "), val, err);
+        std::exit(EXIT_FAILURE);
+      }
+    };
+
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      std::array<T, tArity> xs{};
+      for (std::size_t j = 0; j < tArity; ++j) {
+        xs[j] = args[j](rng);
+      }
+      const T val = std::apply(fun, xs);
+      check(xs, val);
+      test::check(
+        label, std::apply([&](auto... x) { return fun(x..., grex::scalar_tag); }, xs), val,
+        false);
+    }
+#if !GREX_BACKEND_SCALAR
+    auto vop = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
+      auto xval = [&](std::size_t j, std::size_t /*dummy*/) { return args[j](rng); };
+      for (std::size_t i = 0; i < repetitions; ++i) {
+        grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+          std::array<test::VectorChecker<T, tSize>, tArity> xs{};
+          for (std::size_t j = 0; j < tArity; ++j) {
+            xs[j] = test::VectorChecker<T, tSize>{xval(j, tIdxs)...};
+          }
+          grex::static_apply<tArity>([&]<std::size_t... tArgs> {
+            const auto val = fun(xs[tArgs].vec...);
+            for (std::size_t k = 0; k < tSize; ++k) {
+              check({xs[tArgs].ref[k]...}, val[k]);
+            }
+            test::check(label, fun(xs[tArgs].vec..., grex::full_tag<tSize>).as_array(),
+                        val.as_array(), false);
+          });
+        });
+      }
+    };
+    grex::static_apply<1, std::bit_width(grex::max_native_size<T>) + 2>(
+      [&]<std::size_t... tSizes> { (..., vop(grex::index_tag<1ULL << tSizes>)); });
+#endif
+    fmt::print("{}: {} ULP\n", label, max_err);
+  };
+
+#define GREX_MATH_OP(NAME, LO, HI, BOUND) \
+  op(#NAME, [](auto... x) { return grex::NAME(x...); }, [](Ref x) { return std::NAME(x); }, \
+     std::array{Arguments<T>{T(LO), T(HI)}}, BOUND)
+  const T exp_lo = std::is_same_v<T, grex::f32> ? T{-110} : T{-750};
+  const T exp_hi = -exp_lo;
+  GREX_MATH_OP(exp, exp_lo, exp_hi, 1.0);
+  GREX_MATH_OP(exp2, 1.5 * exp_lo, 1.5 * exp_hi, 1.0);
+  GREX_MATH_OP(expm1, exp_lo, exp_hi, 2.0);
+  GREX_MATH_OP(log, 0, 4, 1.0);
+  GREX_MATH_OP(log2, 0, 4, 1.5);
+  GREX_MATH_OP(log1p, -1, 2, 1.0);
+#undef GREX_MATH_OP
+
+  using enum grex::MathAccuracy;
+  // the fast trigonometric functions are only accurate for moderately-sized arguments
+  const T trig_limit = std::is_same_v<T, grex::f32> ? T{4096} : T{0x1p20};
+  const double tan_bound = std::is_same_v<T, grex::f32> ? 1.0 : 1.5;
+#define GREX_TRIG_OP(NAME, ACCURACY, FUN, REF, LIMIT, BOUND) \
+  op(#NAME " (" #ACCURACY ")", [](auto... x) { return FUN; }, [](auto... x) { return REF; }, \
+     std::array{Arguments<T>{-trig_limit, trig_limit, LIMIT}}, BOUND)
+#define GREX_TRIG_OPS(ACCURACY, LIMIT, BOUND, TAN_BOUND) \
+  GREX_TRIG_OP(sin, ACCURACY, grex::sin<ACCURACY>(x...), std::sin(x...), LIMIT, BOUND); \
+  GREX_TRIG_OP(cos, ACCURACY, grex::cos<ACCURACY>(x...), std::cos(x...), LIMIT, BOUND); \
+  GREX_TRIG_OP(sincos.sin, ACCURACY, grex::sincos<ACCURACY>(x...).first, std::sin(x...), LIMIT, \
+               BOUND); \
+  GREX_TRIG_OP(sincos.cos, ACCURACY, grex::sincos<ACCURACY>(x...).second, std::cos(x...), \
+               LIMIT, BOUND); \
+  GREX_TRIG_OP(tan, ACCURACY, grex::tan<ACCURACY>(x...), std::tan(x...), LIMIT, TAN_BOUND); \
+  GREX_TRIG_OP(atan, ACCURACY, grex::atan<ACCURACY>(x...), std::atan(x...), \
+               std::numeric_limits<T>::infinity(), BOUND); \
+  op("atan2 (" #ACCURACY ")", [](auto... x) { return grex::atan2<ACCURACY>(x...); }, \
+     [](Ref y, Ref x) { return std::atan2(y, x); }, \
+     std::array{Arguments<T>{-trig_limit, trig_limit}, Arguments<T>{-trig_limit, trig_limit}}, \
+     BOUND)
+  GREX_TRIG_OPS(precise, std::numeric_limits<T>::infinity(), 1.0, tan_bound);
+  GREX_TRIG_OPS(fast, trig_limit, 4.0, 4.0);
+#undef GREX_TRIG_OPS
+#undef GREX_TRIG_OP
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+  run(rng, grex::type_tag<grex::f64>);
+  run(rng, grex::type_tag<grex::f32>);
+}
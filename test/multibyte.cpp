@@ -4,8 +4,11 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cstddef>
+#include <cstring>
 #include <limits>
 #include <random>
 
@@ -20,15 +23,26 @@
 
 #include "defs.hpp"
 
-#if !GREX_BACKEND_SCALAR
-#include <array>
-#endif
-
 namespace test = grex::test;
+using grex::u8;
 
 inline constexpr std::size_t mbi_size = 1UL << 15UL;
 inline constexpr std::size_t repetitions = 4096;
 
+// sentinel for the bytes which must not be touched by stores
+inline constexpr u8 sentinel = 0xA5;
+
+// reference for a big-endian integer assembled byte by byte
+template<std::size_t tSrc>
+inline grex::UnsignedInt<std::bit_ceil(tSrc)> load_big_endian_ref(const std::byte* data) {
+  using Dst = grex::UnsignedInt<std::bit_ceil(tSrc)>;
+  Dst out{};
+  for (std::size_t i = 0; i < tSrc; ++i) {
+    out = Dst((std::size_t{out} << 8U) | std::to_integer<std::size_t>(data[i]));
+  }
+  return out;
+}
+
 #if !GREX_BACKEND_SCALAR
 template<std::size_t tSrc>
 void run_simd(test::Rng& rng, grex::IndexTag<tSrc> /*tag*/) {
@@ -52,6 +66,16 @@ void run_simd(test::Rng& rng, grex::IndexTag<tSrc> /*tag*/) {
   auto op = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
     fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<Dst>(), tSize);
     std::uniform_int_distribution<std::size_t> idist{0, mbi_size - tSize};
+    std::uniform_int_distribution<std::size_t> ndist{0, tSize};
+    std::uniform_int_distribution<Dst> full_dist{};
+    // the stored bytes, followed by sentinel bytes
+    using Buffer = std::array<u8, tSize * src_bytes + padding>;
+    auto make_buffer = [] {
+      Buffer buf{};
+      buf.fill(sentinel);
+      return buf;
+    };
+    auto bytes = [](Buffer& buf) { return reinterpret_cast<std::byte*>(buf.data()); };
 
     grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
       for (std::size_t r = 0; r < repetitions; ++r) {
@@ -79,6 +103,47 @@ void run_simd(test::Rng& rng, grex::IndexTag<tSrc> /*tag*/) {
           };
           checker.check("load_multibyte tagged vector/tagged scalar", false);
         }
+        {
+          // the same bytes interpreted as big-endian integers
+          const std::byte* raw = it.raw();
+          test::VectorChecker<Dst, tSize> checker{
+            grex::Vector<Dst, tSize>::load_multibyte_big_endian(raw, grex::index_tag<tSrc>),
+            std::array{load_big_endian_ref<tSrc>(raw + tIdxs * tSrc)...},
+          };
+          checker.check("load_multibyte_big_endian vector/reference", false);
+        }
+        {
+          const std::byte* raw = it.raw();
+          test::VectorChecker<Dst, tSize> checker{
+            grex::load_multibyte_big_endian(raw, grex::index_tag<tSrc>, grex::full_tag<tSize>),
+            std::array{grex::load_multibyte_big_endian(raw + tIdxs * tSrc, grex::index_tag<tSrc>,
+                                                       grex::scalar_tag)...},
+          };
+          checker.check("load_multibyte_big_endian tagged vector/tagged scalar", false);
+        }
+        {
+          // stores keep the lower bytes of arbitrary values
+          const grex::Vector<Dst, tSize> v{(void(tIdxs), full_dist(rng))...};
+          const std::size_t num = ndist(rng);
+          Buffer ref = make_buffer();
+          (..., grex::store_multibyte(bytes(ref) + tIdxs * tSrc, v[tIdxs], grex::index_tag<tSrc>,
+                                      grex::scalar_tag));
+          Buffer ref_part = make_buffer();
+          std::copy_n(ref.begin(), num * tSrc, ref_part.begin());
+
+          Buffer out = make_buffer();
+          v.store_multibyte(bytes(out), grex::index_tag<tSrc>);
+          test::check("store_multibyte vector/tagged scalar", out, ref, false);
+          out = make_buffer();
+          grex::store_multibyte(bytes(out), v, grex::index_tag<tSrc>, grex::full_tag<tSize>);
+          test::check("store_multibyte tagged vector/tagged scalar", out, ref, false);
+          out = make_buffer();
+          v.store_multibyte_part(bytes(out), num, grex::index_tag<tSrc>);
+          test::check("store_multibyte_part vector/tagged scalar", out, ref_part, false);
+          out = make_buffer();
+          grex::store_multibyte(bytes(out), v, grex::index_tag<tSrc>, grex::part_tag<tSize>(num));
+          test::check("store_multibyte part-tagged vector/tagged scalar", out, ref_part, false);
+        }
       }
     });
   };
@@ -114,6 +179,19 @@ void run_scalar(test::Rng& rng, grex::IndexTag<tSrc> /*tag*/) {
     const auto c = it[0];
     test::check("load_multibyte", a, b, false);
     test::check("load_multibyte", a, c, false);
+    const auto d =
+      grex::load_multibyte_big_endian(it.raw(), grex::index_tag<tSrc>, grex::scalar_tag);
+    test::check("load_multibyte_big_endian", d, load_big_endian_ref<tSrc>(it.raw()), false);
+
+    // storing the loaded value reproduces the original bytes
+    std::array<u8, src_bytes + 1> out{};
+    out.fill(sentinel);
+    grex::store_multibyte(reinterpret_cast<std::byte*>(out.data()), a,
+                          grex::index_tag<tSrc>, grex::scalar_tag);
+    std::array<u8, src_bytes + 1> ref{};
+    ref.fill(sentinel);
+    std::memcpy(ref.data(), it.raw(), src_bytes);
+    test::check("store_multibyte", out, ref, false);
   }
 }
 
@@ -0,0 +1,140 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <fmt/base.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+
+// floating-point sums are only exact independently of their order for small integers
+template<grex::Vectorizable T>
+inline auto make_sum_distribution() {
+  if constexpr (grex::FloatVectorizable<T>) {
+    return [](test::Rng& rng) { return T(std::uniform_int_distribution<int>{-1000, 1000}(rng)); };
+  } else {
+    return test::make_distribution<T>();
+  }
+}
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  auto sdist = make_sum_distribution<T>();
+  auto sval = [&](std::size_t /*dummy*/) { return sdist(rng); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      {
+        const VC base{sval(tIdxs)...};
+        const T carry = sdist(rng);
+        std::array<T, tSize> inc{};
+        std::array<T, tSize> exc{};
+        T sum = carry;
+        for (std::size_t j = 0; j < tSize; ++j) {
+          exc[j] = sum;
+          sum = grex::detail::wrapping_add(sum, base.ref[j]);
+          inc[j] = grex::detail::wrapping_subtract(sum, carry);
+        }
+        VC{grex::prefix_sum(base.vec), inc}.check("prefix_sum", false);
+        VC{grex::prefix_sum(base.vec, grex::full_tag<tSize>), inc}.check("prefix_sum tagged",
+                                                                        false);
+        VC{grex::exclusive_prefix_sum(base.vec, carry), exc}.check("exclusive_prefix_sum", false);
+        VC{grex::exclusive_prefix_sum(base.vec, carry, grex::full_tag<tSize>), exc}.check(
+          "exclusive_prefix_sum tagged", false);
+      }
+      {
+        const VC base{dval(tIdxs)...};
+        std::array<T, tSize> mins{};
+        std::array<T, tSize> maxs{};
+        for (std::size_t j = 0; j < tSize; ++j) {
+          mins[j] = (j == 0) ? base.ref[0] : std::min(mins[j - 1], base.ref[j]);
+          maxs[j] = (j == 0) ? base.ref[0] : std::max(maxs[j - 1], base.ref[j]);
+        }
+        VC{grex::prefix_min(base.vec), mins}.check("prefix_min", false);
+        VC{grex::prefix_max(base.vec), maxs}.check("prefix_max", false);
+        VC{grex::prefix_min(base.vec, grex::full_tag<tSize>), mins}.check("prefix_min tagged",
+                                                                         false);
+        VC{grex::prefix_max(base.vec, grex::full_tag<tSize>), maxs}.check("prefix_max tagged",
+                                                                         false);
+      }
+    }
+  });
+}
+#endif
+
+template<grex::Vectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T value = dist(rng);
+    const T carry = dist(rng);
+    test::check("prefix_sum", grex::prefix_sum(value, grex::scalar_tag), value, false);
+    test::check("exclusive_prefix_sum", grex::exclusive_prefix_sum(value, carry, grex::scalar_tag),
+                carry, false);
+    test::check("prefix_min", grex::prefix_min(value, grex::scalar_tag), value, false);
+    test::check("prefix_max", grex::prefix_max(value, grex::scalar_tag), value, false);
+  }
+}
+
+// arrays of all lengths up to a few vectors, both out-of-place and in-place
+template<grex::Vectorizable T>
+void run_array(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto sdist = make_sum_distribution<T>();
+  std::uniform_int_distribution<std::size_t> num_dist{0, 4 * grex::max_native_size<T> + 3};
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const std::size_t num = num_dist(rng);
+    std::vector<T> in(num);
+    std::ranges::generate(in, [&] { return sdist(rng); });
+    const T carry = sdist(rng);
+
+    std::vector<T> ref(num);
+    T sum = carry;
+    for (std::size_t j = 0; j < num; ++j) {
+      sum = grex::detail::wrapping_add(sum, in[j]);
+      ref[j] = sum;
+    }
+
+    // one more value, which must not be touched
+    std::vector<T> out(num + 1, T{1});
+    const auto label = [&] { return fmt::format("prefix_sum array {}", num); };
+    test::check(label, grex::prefix_sum(in.data(), out.data(), num, carry), sum, false);
+    test::check(label, std::vector(out.begin(), out.begin() + std::ptrdiff_t(num)), ref, false);
+    test::check(label, out[num], T{1}, false);
+
+    test::check(label, grex::prefix_sum(in.data(), in.data(), num, carry), sum, false);
+    test::check(label, in, ref, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+  test::run_types([&](auto tag) {
+    run_scalar(rng, tag);
+    run_array(rng, tag);
+  });
+}
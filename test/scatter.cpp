@@ -0,0 +1,185 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <span>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/ranges.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <bit>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+// small enough for duplicate indices to be common, which checks the lane order
+inline constexpr std::size_t data_size = 64;
+
+template<grex::Vectorizable TValue>
+using Data = std::array<TValue, data_size>;
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable TValue>
+void run_simd(test::Rng& rng, grex::TypeTag<TValue> /*tag*/) {
+  fmt::print(fmt::fg(fmt::terminal_color::magenta) | fmt::text_style(fmt::emphasis::bold),
+             "value: {}\n", test::type_name<TValue>());
+  auto vdist = test::make_distribution<TValue>();
+  auto vval = [&](std::size_t /*dummy*/) { return vdist(rng); };
+
+  auto outer = [&]<grex::Vectorizable TIndex>(grex::TypeTag<TIndex> /*tag*/) {
+    fmt::print(fmt::fg(fmt::terminal_color::blue) | fmt::text_style(fmt::emphasis::bold),
+               "index: {}\n", test::type_name<TIndex>());
+
+    const auto imax = std::size_t(std::numeric_limits<TIndex>::max());
+    std::uniform_int_distribution<TIndex> idist{0, TIndex(std::min(data_size - 1, imax))};
+    auto ival = [&](std::size_t /*dummy*/) { return idist(rng); };
+    std::uniform_int_distribution<int> mdist{0, 1};
+    auto mval = [&](std::size_t /*dummy*/) { return bool(mdist(rng)); };
+
+    auto op = [&]<std::size_t tSize>(grex::IndexTag<tSize> /*tag*/) {
+      std::uniform_int_distribution<std::size_t> pdist{0, tSize};
+
+      // scatter into a copy of `base` and compare with sequential stores of the selected lanes
+      auto check = [&](const auto& label, const Data<TValue>& base, auto op,
+                       const test::VectorChecker<TIndex, tSize>& idxs,
+                       const test::VectorChecker<TValue, tSize>& vals, auto selected) {
+        Data<TValue> data = base;
+        op(std::span{data});
+        Data<TValue> ref = base;
+        for (std::size_t i = 0; i < tSize; ++i) {
+          if (selected(i)) {
+            ref[std::size_t(idxs.ref[i])] = vals.ref[i];
+          }
+        }
+        test::check(label, data, ref, false);
+      };
+
+      for (std::size_t i = 0; i < repetitions; ++i) {
+        grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+          Data<TValue> base{};
+          std::ranges::generate(base, [&] { return vval(0); });
+          const test::VectorChecker<TIndex, tSize> idxs{ival(tIdxs)...};
+          const test::VectorChecker<TValue, tSize> vals{vval(tIdxs)...};
+          const test::MaskChecker<TValue, tSize> m{mval(tIdxs)...};
+          auto all = [](std::size_t /*i*/) { return true; };
+          auto masked = [&](std::size_t j) { return m.ref[j]; };
+
+          // scatter
+          check(
+            "scatter", base, [&](auto data) { grex::scatter(data, idxs.vec, vals.vec); }, idxs,
+            vals, all);
+          check(
+            "scatter tagged", base,
+            [&](auto data) {
+              grex::scatter(data, idxs.vec, vals.vec, grex::typed_full_tag<TValue, tSize>);
+            },
+            idxs, vals, all);
+          // mask_scatter
+          check(
+            "mask_scatter", base,
+            [&](auto data) { grex::mask_scatter(data, m.mask, idxs.vec, vals.vec); }, idxs, vals,
+            masked);
+          {
+            const std::size_t part = pdist(rng);
+            check(
+              "scatter part tagged", base,
+              [&](auto data) {
+                grex::scatter(data, idxs.vec, vals.vec, grex::part_tag<tSize>(part));
+              },
+              idxs, vals, [&](std::size_t j) { return j < part; });
+          }
+          check(
+            "scatter masked tagged", base,
+            [&](auto data) {
+              grex::scatter(data, idxs.vec, vals.vec, grex::typed_masked_tag(m.mask));
+            },
+            idxs, vals, masked);
+          {
+            const test::MaskChecker<TValue, tSize> m2{mval(tIdxs)...};
+            check(
+              "mask_scatter masked tagged", base,
+              [&](auto data) {
+                grex::mask_scatter(data, m.mask, idxs.vec, vals.vec,
+                                   grex::typed_masked_tag(m2.mask));
+              },
+              idxs, vals, [&](std::size_t j) { return m.ref[j] && m2.ref[j]; });
+          }
+        });
+      }
+    };
+
+    constexpr std::size_t size =
+      std::min(grex::max_native_size<TValue>, grex::max_native_size<TIndex>);
+    grex::static_apply<1, std::bit_width(size) + 2>(
+      [&]<std::size_t... tSizes> { (..., op(grex::index_tag<1ULL << tSizes>)); });
+  };
+  test::for_each_integral(outer);
+}
+#endif
+template<grex::Vectorizable TValue>
+void run_scalar(test::Rng& rng, grex::TypeTag<TValue> /*tag*/) {
+  fmt::print(fmt::fg(fmt::terminal_color::magenta) | fmt::text_style(fmt::emphasis::bold),
+             "value: {}\n", test::type_name<TValue>());
+  auto vdist = test::make_distribution<TValue>();
+
+  auto outer = [&]<grex::Vectorizable TIndex>(grex::TypeTag<TIndex> /*tag*/) {
+    fmt::print(fmt::fg(fmt::terminal_color::blue) | fmt::text_style(fmt::emphasis::bold),
+               "index: {}\n", test::type_name<TIndex>());
+
+    const auto imax = std::size_t(std::numeric_limits<TIndex>::max());
+    std::uniform_int_distribution<TIndex> idist{0, TIndex(std::min(data_size - 1, imax))};
+    std::uniform_int_distribution<int> bdist{0, 1};
+
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      Data<TValue> base{};
+      std::ranges::generate(base, [&] { return vdist(rng); });
+      const TIndex idx = idist(rng);
+      const TValue value = vdist(rng);
+      // scatter
+      {
+        Data<TValue> data = base;
+        grex::scatter(std::span{data}, idx, value, grex::scalar_tag);
+        Data<TValue> ref = base;
+        ref[std::size_t(idx)] = value;
+        test::check("scatter scalar", data, ref, false);
+      }
+      // mask_scatter
+      {
+        const bool m = bool(bdist(rng));
+        Data<TValue> data = base;
+        grex::mask_scatter(std::span{data}, m, idx, value, grex::scalar_tag);
+        Data<TValue> ref = base;
+        if (m) {
+          ref[std::size_t(idx)] = value;
+        }
+        test::check("mask_scatter scalar", data, ref, false);
+      }
+    }
+  };
+  test::for_each_integral(outer);
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+  test::for_each_type([&](auto tag) {
+#if !GREX_BACKEND_SCALAR
+    run_simd(rng, tag);
+#endif
+    run_scalar(rng, tag);
+  });
+}
@@ -0,0 +1,147 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <random>
+
+#include <fmt/base.h>
+#include <fmt/color.h>
+#include <fmt/format.h>
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+#if !GREX_BACKEND_SCALAR
+#include <array>
+#endif
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+
+// references using the built-in operators, offsets are smaller than the number of bits
+template<grex::IntVectorizable T>
+inline T shift_left_ref(T v, std::size_t offset) {
+  return T(grex::UnsignedInt<sizeof(T)>(v) << offset);
+}
+template<grex::IntVectorizable T>
+inline T shift_right_ref(T v, std::size_t offset) {
+  return T(v >> offset);
+}
+template<grex::IntVectorizable T>
+inline T rotate_left_ref(T v, std::size_t offset) {
+  return T(std::rotl(grex::UnsignedInt<sizeof(T)>(v), int(offset % (sizeof(T) * CHAR_BIT))));
+}
+template<grex::IntVectorizable T>
+inline T rotate_right_ref(T v, std::size_t offset) {
+  return T(std::rotr(grex::UnsignedInt<sizeof(T)>(v), int(offset % (sizeof(T) * CHAR_BIT))));
+}
+
+#if !GREX_BACKEND_SCALAR
+template<grex::IntVectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using U = grex::UnsignedInt<sizeof(T)>;
+  using VC = test::VectorChecker<T, tSize>;
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+
+  auto dist = test::make_distribution<T>();
+  auto dval = [&](std::size_t /*dummy*/) { return dist(rng); };
+  std::uniform_int_distribution<std::size_t> odist{0, bits - 1};
+  // rotations reduce the offsets modulo the number of bits
+  std::uniform_int_distribution<std::size_t> rdist{0, 4 * bits};
+  auto oval = [&](std::size_t /*dummy*/) { return U(odist(rng)); };
+  auto rval = [&](std::size_t /*dummy*/) { return U(rdist(rng)); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs>() {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const VC a{dval(tIdxs)...};
+
+      // per-lane offsets
+      const std::array<U, tSize> offs{oval(tIdxs)...};
+      const grex::Vector<U, tSize> voffs{offs[tIdxs]...};
+      const auto label = [&] { return fmt::format("({}, {})", a.vec, voffs); };
+      VC{grex::shift_left(a.vec, voffs), std::array{shift_left_ref(a.ref[tIdxs], offs[tIdxs])...}}
+        .check(label, false);
+      VC{grex::shift_right(a.vec, voffs),
+         std::array{shift_right_ref(a.ref[tIdxs], offs[tIdxs])...}}
+        .check(label, false);
+
+      const std::array<U, tSize> roffs{rval(tIdxs)...};
+      const grex::Vector<U, tSize> vroffs{roffs[tIdxs]...};
+      const auto rlabel = [&] { return fmt::format("({}, {})", a.vec, vroffs); };
+      VC{grex::rotate_left(a.vec, vroffs),
+         std::array{rotate_left_ref(a.ref[tIdxs], roffs[tIdxs])...}}
+        .check(rlabel, false);
+      VC{grex::rotate_right(a.vec, vroffs),
+         std::array{rotate_right_ref(a.ref[tIdxs], roffs[tIdxs])...}}
+        .check(rlabel, false);
+
+      // runtime offsets shared by all lanes
+      const std::size_t off = odist(rng);
+      const std::size_t roff = rdist(rng);
+      const auto slabel = [&] { return fmt::format("({}, {}, {})", a.vec, off, roff); };
+      VC{grex::shift_left(a.vec, off), std::array{shift_left_ref(a.ref[tIdxs], off)...}}.check(
+        slabel, false);
+      VC{grex::shift_right(a.vec, off), std::array{shift_right_ref(a.ref[tIdxs], off)...}}.check(
+        slabel, false);
+      VC{grex::rotate_left(a.vec, roff), std::array{rotate_left_ref(a.ref[tIdxs], roff)...}}
+        .check(slabel, false);
+      VC{grex::rotate_right(a.vec, roff), std::array{rotate_right_ref(a.ref[tIdxs], roff)...}}
+        .check(slabel, false);
+    }
+
+    // compile-time offsets, including a full rotation
+    const VC a{dval(tIdxs)...};
+    auto f = [&](grex::AnyIndexTag auto offset) {
+      VC{grex::rotate_left(a.vec, offset),
+         std::array{rotate_left_ref(a.ref[tIdxs], offset.value)...}}
+        .check("rotate_left", false);
+      VC{grex::rotate_right(a.vec, offset),
+         std::array{rotate_right_ref(a.ref[tIdxs], offset.value)...}}
+        .check("rotate_right", false);
+    };
+    grex::static_apply<bits + 1>([&]<std::size_t... tOffs>() { (..., f(grex::index_tag<tOffs>)); });
+  });
+}
+#endif
+
+template<grex::IntVectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  static constexpr std::size_t bits = sizeof(T) * CHAR_BIT;
+  auto dist = test::make_distribution<T>();
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T a = dist(rng);
+    for (std::size_t off = 0; off < 2 * bits; ++off) {
+      const auto label = [&] { return fmt::format("({}, {})", a, off); };
+      if (off < bits) {
+        test::check(label, grex::shift_left(a, off), shift_left_ref(a, off), false);
+        test::check(label, grex::shift_right(a, off), shift_right_ref(a, off), false);
+      }
+      test::check(label, grex::rotate_left(a, off), rotate_left_ref(a, off), false);
+      test::check(label, grex::rotate_right(a, off), rotate_right_ref(a, off), false);
+    }
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+
+  test::for_each_integral([&]<typename T>(grex::TypeTag<T> tag) {
+#if !GREX_BACKEND_SCALAR
+    test::for_each_size<T>([&](auto vtag, auto stag) {
+      fmt::print(fmt::fg(fmt::terminal_color::blue), "{}×{}\n", test::type_name<T>(),
+                 decltype(stag)::value);
+      run_simd(rng, vtag, stag);
+    });
+#endif
+    fmt::print(fmt::fg(fmt::terminal_color::blue), "{}\n", test::type_name<T>());
+    run_scalar(rng, tag);
+  });
+}
@@ -0,0 +1,107 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 4096;
+
+#if !GREX_BACKEND_SCALAR
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/) {
+  using VC = test::VectorChecker<T, tSize>;
+  using Limits = std::numeric_limits<T>;
+
+  // values from a small set as well, which contain many duplicates
+  auto dist = test::make_distribution<T>();
+  const std::array<T, 4> few{T(1), T(-1), T(0), Limits::max()};
+  std::uniform_int_distribution<std::size_t> few_dist{0, few.size() - 1};
+  std::uniform_int_distribution<std::size_t> part_dist{0, tSize};
+  auto val = [&](bool use_few) { return use_few ? few[few_dist(rng)] : dist(rng); };
+
+  grex::static_apply<tSize>([&]<std::size_t... tIdxs> {
+    for (std::size_t i = 0; i < repetitions; ++i) {
+      const bool use_few = i % 2 == 1;
+      const VC a{(void(tIdxs), val(use_few))...};
+      const VC b{(void(tIdxs), val(use_few))...};
+
+      std::array<T, tSize> asc = a.ref;
+      std::ranges::sort(asc);
+      std::array<T, tSize> desc = a.ref;
+      std::ranges::sort(desc, std::greater{});
+      VC{grex::sort(a.vec), asc}.check("sort", false);
+      VC{grex::sort_descending(a.vec), desc}.check("sort_descending", false);
+      VC{grex::sort(a.vec, grex::full_tag<tSize>), asc}.check("sort tagged", false);
+      VC{grex::sort_descending(a.vec, grex::full_tag<tSize>), desc}.check(
+        "sort_descending tagged", false);
+
+      // the inactive lanes are moved to the end
+      {
+        const std::size_t part = part_dist(rng);
+        std::array<T, tSize> pasc = a.ref;
+        std::array<T, tSize> pdesc = a.ref;
+        std::ranges::sort(pasc.begin(), pasc.begin() + std::ptrdiff_t(part));
+        std::ranges::sort(pdesc.begin(), pdesc.begin() + std::ptrdiff_t(part), std::greater{});
+        const auto tag = grex::part_tag<tSize>(part);
+        const auto pasc_vec = grex::sort(a.vec, tag);
+        const auto pdesc_vec = grex::sort_descending(a.vec, tag);
+        test::check("sort part", std::array{(tIdxs < part ? pasc_vec[tIdxs] : T{})...},
+                    std::array{(tIdxs < part ? pasc[tIdxs] : T{})...}, false);
+        test::check("sort_descending part",
+                    std::array{(tIdxs < part ? pdesc_vec[tIdxs] : T{})...},
+                    std::array{(tIdxs < part ? pdesc[tIdxs] : T{})...}, false);
+      }
+
+      std::array<T, 2 * tSize> merged{};
+      std::ranges::copy(asc, merged.begin());
+      std::ranges::copy(b.ref, merged.begin() + tSize);
+      std::ranges::sort(merged);
+      {
+        const auto [lo, hi] = grex::merge_sorted(grex::sort(a.vec), grex::sort(b.vec));
+        VC{lo, {merged[tIdxs]...}}.check("merge_sorted lower", false);
+        VC{hi, {merged[tSize + tIdxs]...}}.check("merge_sorted upper", false);
+      }
+      {
+        const auto [hi, lo] =
+          grex::merge_sorted_descending(grex::sort_descending(a.vec), grex::sort_descending(b.vec));
+        VC{hi, {merged[2 * tSize - 1 - tIdxs]...}}.check("merge_sorted_descending upper", false);
+        VC{lo, {merged[tSize - 1 - tIdxs]...}}.check("merge_sorted_descending lower", false);
+      }
+    }
+  });
+}
+#endif
+
+template<grex::Vectorizable T>
+void run_scalar(test::Rng& rng, grex::TypeTag<T> /*tag*/) {
+  auto dist = test::make_distribution<T>();
+
+  for (std::size_t i = 0; i < repetitions; ++i) {
+    const T value = dist(rng);
+    test::check("sort", grex::sort(value, grex::scalar_tag), value, false);
+    test::check("sort_descending", grex::sort_descending(value, grex::scalar_tag), value, false);
+  }
+}
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+  test::run_types([&](auto tag) { run_scalar(rng, tag); });
+}
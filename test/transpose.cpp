@@ -0,0 +1,65 @@
+// This file is part of https://github.com/KurtBoehm/grex.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include <pcg_extras.hpp>
+
+#include "grex/grex.hpp"
+
+#include "defs.hpp"
+
+namespace test = grex::test;
+inline constexpr std::size_t repetitions = 256;
+
+#if !GREX_BACKEND_SCALAR
+// transpose `tNum` vectors with `tSize` lanes each
+template<grex::Vectorizable T, std::size_t tSize, std::size_t tNum>
+void run_transpose(test::Rng& rng, grex::TypeTag<T> /*tag*/, grex::IndexTag<tSize> /*tag*/,
+                   grex::IndexTag<tNum> /*tag*/) {
+  using VC = test::VectorChecker<T, tNum>;
+  auto dist = test::make_distribution<T>();
+
+  for (std::size_t r = 0; r < repetitions; ++r) {
+    const auto vcs = grex::static_apply<tNum>([&]<std::size_t... tIdxs>() {
+      auto make = [&]() {
+        return grex::static_apply<tSize>([&]<std::size_t... tLanes>() {
+          return test::VectorChecker<T, tSize>{(void(tLanes), dist(rng))...};
+        });
+      };
+      return std::array{(void(tIdxs), make())...};
+    });
+    const auto ts = grex::static_apply<tNum>(
+      [&]<std::size_t... tIdxs>() { return grex::transpose(std::array{vcs[tIdxs].vec...}); });
+    grex::static_apply<tNum>([&]<std::size_t... tIdxs>() {
+      for (std::size_t j = 0; j < tSize; ++j) {
+        VC{ts[j], {vcs[tIdxs].ref[j]...}}.check("transpose", false);
+      }
+    });
+  }
+}
+
+template<grex::Vectorizable T, std::size_t tSize>
+void run_simd(test::Rng& rng, grex::TypeTag<T> tag, grex::IndexTag<tSize> size) {
+  run_transpose(rng, tag, size, size);
+  if constexpr (tSize >= 4) {
+    run_transpose(rng, tag, size, grex::index_tag<tSize / 2>);
+  }
+  if constexpr (tSize <= grex::max_native_size<T>) {
+    run_transpose(rng, tag, size, grex::index_tag<tSize * 2>);
+  }
+}
+#endif
+
+int main() {
+  pcg_extras::seed_seq_from<std::random_device> seed_source{};
+  test::Rng rng{seed_source};
+#if !GREX_BACKEND_SCALAR
+  test::run_types_sizes([&](auto vtag, auto stag) { run_simd(rng, vtag, stag); });
+#endif
+}